@@ -33,6 +33,16 @@
         "src/vortex_ring.cpp",
         "src/vorticity_dynamics.cpp",
         "src/sst_gravity.cpp",
+        "src/ode_integrators.cpp",
+        "src/filament_remesh.cpp",
+        "src/local_induction.cpp",
+        "src/filament_system.cpp",
+        "src/trajectory_writer.cpp",
+        "src/checkpoint.cpp",
+        "src/cell_list.cpp",
+        "src/thread_pool.cpp",
+        "src/job_system.cpp",
+        "src/profiler.cpp",
         "build_node/generated/knot_files_embedded.cpp"
       ],
       "include_dirs": [
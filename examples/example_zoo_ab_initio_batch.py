@@ -0,0 +1,50 @@
+"""
+SSTcore: parallel ab initio batch over the SST Master Dictionary.
+
+Every entry is built from the ideal database, relaxed, and its core (+ optional
+tail) energy converted to a mass. Work runs on native threads with the GIL
+released; results stream back through on_result as they finish.
+
+Usage:
+    python example_zoo_ab_initio_batch.py [max_seconds_per_entry]
+"""
+
+import sys
+import time
+
+try:
+    import sstcore
+except ImportError:
+    import sstbindings as sstcore
+
+
+def main():
+    cfg = sstcore.ZooAbInitioConfig()
+    cfg.resolution = 400
+    cfg.relax_iterations = 600
+    cfg.include_tail = True
+    cfg.time_budget_s = float(sys.argv[1]) if len(sys.argv) > 1 else 0.0  # 0 = unlimited
+
+    cancel = sstcore.ZooCancelToken()
+    t0 = time.perf_counter()
+
+    def on_result(r):
+        if r.status == "ok":
+            print(f"  [{r.index:3d}] {r.identifier:<32s} ({r.ab_id:>8s})  "
+                  f"M_ab = {r.mass_mev_ab_initio:12.4f} MeV  "
+                  f"M_nls = {r.golden_nls_mass_mev:12.4f} MeV  ({r.elapsed_s:.2f}s)")
+        else:
+            print(f"  [{r.index:3d}] {r.identifier:<32s} {r.status}: {r.message}")
+
+    try:
+        results = sstcore.ZooEvaluator.evaluate_all_ab_initio(cfg, on_result, cancel)
+    except KeyboardInterrupt:
+        print("interrupted")
+        return
+
+    ok = sum(1 for r in results if r.status == "ok")
+    print(f"\n{ok}/{len(results)} entries evaluated in {time.perf_counter() - t0:.2f}s")
+
+
+if __name__ == "__main__":
+    main()
@@ -15,6 +15,17 @@ export interface FrenetFrames {
     B: Float64Array;
 }
 
+export interface BishopFrames {
+    T: Float64Array;
+    U: Float64Array;
+    V: Float64Array;
+    curvature: number[];
+    torsion: number[];
+    arclength: number[];
+    length: number;
+    holonomy: number;
+}
+
 export interface CurvatureTorsion {
     curvature: number[];
     torsion: number[];
@@ -32,6 +43,13 @@ export interface BiotSavartModule {
      */
     computeVelocity(curve: Vec3Array, gridPoints: Vec3Array): Float64Array;
 
+    /**
+     * computeVelocity on the libuv thread pool; resolves with the same result.
+     * Float64Array inputs are read in place and must not be modified until the
+     * Promise settles. Argument errors reject instead of throwing.
+     */
+    computeVelocityAsync(curve: Vec3Array, gridPoints: Vec3Array): Promise<Float64Array>;
+
     /**
      * Compute vorticity from velocity field on a regular grid
      * @param velocity Velocity field as Float64Array (flat)
@@ -41,6 +59,9 @@ export interface BiotSavartModule {
      */
     computeVorticity(velocity: Vec3Array, shape: [number, number, number], spacing: number): Float64Array;
 
+    /** computeVorticity off the main thread (see computeVelocityAsync) */
+    computeVorticityAsync(velocity: Vec3Array, shape: [number, number, number], spacing: number): Promise<Float64Array>;
+
     /**
      * Extract cubic interior field subset
      * @param field Field as Float64Array (flat)
@@ -50,6 +71,9 @@ export interface BiotSavartModule {
      */
     extractInterior(field: Vec3Array, shape: [number, number, number], margin: number): Float64Array;
 
+    /** extractInterior off the main thread (see computeVelocityAsync) */
+    extractInteriorAsync(field: Vec3Array, shape: [number, number, number], margin: number): Promise<Float64Array>;
+
     /**
      * Compute invariants (H_charge, H_mass, a_mu)
      * @param vSub Velocity subset
@@ -59,6 +83,9 @@ export interface BiotSavartModule {
      */
     computeInvariants(vSub: Vec3Array, wSub: Vec3Array, rSq: number[]): BiotSavartInvariants;
 
+    /** computeInvariants off the main thread (see computeVelocityAsync) */
+    computeInvariantsAsync(vSub: Vec3Array, wSub: Vec3Array, rSq: number[]): Promise<BiotSavartInvariants>;
+
     /**
      * Compute velocity at a single point due to a filament
      * @param r Point [x, y, z]
@@ -76,6 +103,9 @@ export interface BiotSavartModule {
      * @returns Float64Array of velocities (flat, length = grid.length*3)
      */
     biotSavartVelocityGrid(polyline: Vec3Array, grid: Vec3Array): Float64Array;
+
+    /** biotSavartVelocityGrid off the main thread (see computeVelocityAsync) */
+    biotSavartVelocityGridAsync(polyline: Vec3Array, grid: Vec3Array): Promise<Float64Array>;
 }
 
 /**
@@ -92,17 +122,26 @@ export interface FluidDynamicsModule {
      */
     computeVelocityMagnitude(velocity: Vec3Array): number[];
 
+    /** computeVelocityMagnitude on the libuv thread pool */
+    computeVelocityMagnitudeAsync(velocity: Vec3Array): Promise<number[]>;
+
     /**
      * Euler-step update of particle positions
      * @returns Updated positions
      */
     evolvePositionsEuler(positions: Vec3Array, velocity: Vec3Array, dt: number): Float64Array;
 
+    /** evolvePositionsEuler on the libuv thread pool */
+    evolvePositionsEulerAsync(positions: Vec3Array, velocity: Vec3Array, dt: number): Promise<Float64Array>;
+
     /**
      * Compute helicity H = ∫ v · ω dV over a discretized field (with volume element)
      */
     computeHelicityField(velocity: Vec3Array, vorticity: Vec3Array, dV: number): number;
 
+    /** computeHelicityField on the libuv thread pool */
+    computeHelicityFieldAsync(velocity: Vec3Array, vorticity: Vec3Array, dV: number): Promise<number>;
+
     /**
      * Swirl clock rate: 0.5 * (dv/dx - du/dy)
      */
@@ -112,6 +151,9 @@ export interface FluidDynamicsModule {
      * Compute kinetic energy E = (1/2) * ρ * ∑ |v|^2
      */
     computeKineticEnergy(velocity: Vec3Array, rhoAe: number): number;
+
+    /** computeKineticEnergy on the libuv thread pool */
+    computeKineticEnergyAsync(velocity: Vec3Array, rhoAe: number): Promise<number>;
 }
 
 /**
@@ -123,25 +165,54 @@ export interface FrenetHelicityModule {
      */
     computeFrenetFrames(X: Vec3Array): FrenetFrames;
 
+    /** computeFrenetFrames on the libuv thread pool */
+    computeFrenetFramesAsync(X: Vec3Array): Promise<FrenetFrames>;
+
+    /**
+     * Parallel-transport frames of a closed curve with holonomy correction,
+     * curvature and torsion in one pass
+     */
+    computeBishopFrames(X: Vec3Array): BishopFrames;
+
+    /** computeBishopFrames on the libuv thread pool */
+    computeBishopFramesAsync(X: Vec3Array): Promise<BishopFrames>;
+
     /**
      * Compute curvature and torsion from tangent and normal vectors
      */
     computeCurvatureTorsion(T: Vec3Array, N: Vec3Array): CurvatureTorsion;
 
+    /** computeCurvatureTorsion on the libuv thread pool */
+    computeCurvatureTorsionAsync(T: Vec3Array, N: Vec3Array): Promise<CurvatureTorsion>;
+
     /**
      * Compute helicity H = ∫ v · ω dV
      */
     computeHelicity(velocity: Vec3Array, vorticity: Vec3Array): number;
 
+    /** computeHelicity on the libuv thread pool */
+    computeHelicityAsync(velocity: Vec3Array, vorticity: Vec3Array): Promise<number>;
+
     /**
-     * Evolve vortex knot filaments using Biot-Savart dynamics
+     * Evolve vortex knot filaments using Biot-Savart dynamics (one rk4Integrate step)
      */
     evolveVortexKnot(positions: Vec3Array, tangents: Vec3Array, dt: number, gamma?: number): Float64Array;
 
+    /** evolveVortexKnot on the libuv thread pool */
+    evolveVortexKnotAsync(positions: Vec3Array, tangents: Vec3Array, dt: number, gamma?: number): Promise<Float64Array>;
+
     /**
-     * Runge-Kutta 4th order time integrator
+     * One RK4 step of a closed filament moving with its own Biot-Savart velocity
+     * (O(N^2) per stage; segment vectors are rebuilt from each stage's positions).
+     *
+     * Behaviour change: this used to return the O(N) advection
+     * positions + dt * gamma * tangents. `tangents` must still match `positions`
+     * in length but no longer affects the result.
      */
     rk4Integrate(positions: Vec3Array, tangents: Vec3Array, dt: number, gamma?: number): Float64Array;
+
+    /** rk4Integrate on the libuv thread pool */
+    rk4IntegrateAsync(positions: Vec3Array, tangents: Vec3Array, dt: number, gamma?: number): Promise<Float64Array>;
 }
 
 /**
@@ -161,6 +232,11 @@ export interface SwirlStringCore {
     computeInvariants: BiotSavartModule['computeInvariants'];
     biotSavartVelocity: BiotSavartModule['biotSavartVelocity'];
     biotSavartVelocityGrid: BiotSavartModule['biotSavartVelocityGrid'];
+    computeVelocityAsync: BiotSavartModule['computeVelocityAsync'];
+    computeVorticityAsync: BiotSavartModule['computeVorticityAsync'];
+    extractInteriorAsync: BiotSavartModule['extractInteriorAsync'];
+    computeInvariantsAsync: BiotSavartModule['computeInvariantsAsync'];
+    biotSavartVelocityGridAsync: BiotSavartModule['biotSavartVelocityGridAsync'];
 
     // Fluid dynamics functions
     computePressureField: FluidDynamicsModule['computePressureField'];
@@ -169,13 +245,24 @@ export interface SwirlStringCore {
     computeHelicityField: FluidDynamicsModule['computeHelicityField'];
     swirlClockRate: FluidDynamicsModule['swirlClockRate'];
     computeKineticEnergy: FluidDynamicsModule['computeKineticEnergy'];
+    computeVelocityMagnitudeAsync: FluidDynamicsModule['computeVelocityMagnitudeAsync'];
+    evolvePositionsEulerAsync: FluidDynamicsModule['evolvePositionsEulerAsync'];
+    computeHelicityFieldAsync: FluidDynamicsModule['computeHelicityFieldAsync'];
+    computeKineticEnergyAsync: FluidDynamicsModule['computeKineticEnergyAsync'];
 
     // Frenet helicity functions
     computeFrenetFrames: FrenetHelicityModule['computeFrenetFrames'];
+    computeBishopFrames: FrenetHelicityModule['computeBishopFrames'];
     computeCurvatureTorsion: FrenetHelicityModule['computeCurvatureTorsion'];
     computeHelicity: FrenetHelicityModule['computeHelicity'];
     evolveVortexKnot: FrenetHelicityModule['evolveVortexKnot'];
     rk4Integrate: FrenetHelicityModule['rk4Integrate'];
+    computeFrenetFramesAsync: FrenetHelicityModule['computeFrenetFramesAsync'];
+    computeBishopFramesAsync: FrenetHelicityModule['computeBishopFramesAsync'];
+    computeCurvatureTorsionAsync: FrenetHelicityModule['computeCurvatureTorsionAsync'];
+    computeHelicityAsync: FrenetHelicityModule['computeHelicityAsync'];
+    evolveVortexKnotAsync: FrenetHelicityModule['evolveVortexKnotAsync'];
+    rk4IntegrateAsync: FrenetHelicityModule['rk4IntegrateAsync'];
 
     // Placeholder flags for modules not yet implemented
     fieldKernelsAvailable?: boolean;
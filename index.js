@@ -26,6 +26,15 @@ function loadNativeModule() {
     }
 }
 
+// The Emscripten build is a MODULARIZE factory (createSSTcoreModule) that
+// resolves to the module once the wasm is compiled and its workers started.
+function instantiateWasm(factory) {
+    return factory().then(module => {
+        wasmModule = module;
+        return module;
+    });
+}
+
 // Try to load WASM module
 function loadWasmModule() {
     if (isBrowser) {
@@ -35,8 +44,10 @@ function loadWasmModule() {
             // Dynamic import for ES modules (using Function to avoid syntax error in non-ESM contexts)
             const dynamicImport = new Function('specifier', 'return import(specifier)');
             return dynamicImport('./dist/swirl_string_core_wasm.js').then(module => {
-                wasmModule = module;
-                return module;
+                // ES6 build (SST_WASM_ES6=ON) exports the factory as default;
+                // the UMD build defines it globally when loaded by <script>.
+                const factory = module.default || globalThis.createSSTcoreModule;
+                return instantiateWasm(factory);
             }).catch(err => {
                 console.warn('WASM module not available:', err.message);
                 return null;
@@ -48,8 +59,7 @@ function loadWasmModule() {
     } else if (isNode) {
         // In Node.js, can load WASM as fallback
         try {
-            wasmModule = require('./dist/swirl_string_core_wasm.js');
-            return wasmModule;
+            return instantiateWasm(require('./dist/swirl_string_core_wasm.js'));
         } catch (err) {
             console.warn('WASM module not available:', err.message);
             return null;
@@ -84,7 +94,7 @@ if (!loadedModule) {
     exportsObj.isWasm = false;
     module.exports = exportsObj;
 } else if (typeof loadedModule.then === 'function') {
-    // Async module (WASM in browser) - return a promise
+    // Async module (WASM factory in browser or Node.js) - return a promise
     // For synchronous access, provide a stub
     exportsObj.version = '0.1.3';
     exportsObj.isAvailable = false;
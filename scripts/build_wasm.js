@@ -7,6 +7,13 @@ const path = require('path');
 
 console.log('Building WASM module with Emscripten...');
 
+// Prefer the vendored SDK (emsdk/) when it has been installed and activated
+const vendoredEmscripten = path.join(__dirname, '..', 'emsdk', 'upstream', 'emscripten');
+if (fs.existsSync(path.join(vendoredEmscripten, 'emcc'))) {
+    process.env.PATH = `${vendoredEmscripten}${path.delimiter}${process.env.PATH}`;
+    process.env.EMSCRIPTEN = process.env.EMSCRIPTEN || vendoredEmscripten;
+}
+
 // Check if Emscripten is available
 try {
     execSync('emcc --version', { stdio: 'ignore' });
@@ -29,8 +36,10 @@ if (!fs.existsSync(buildDir)) {
 }
 
 try {
-    // Configure with Emscripten
-    execSync(`cmake -DCMAKE_TOOLCHAIN_FILE=${process.env.EMSCRIPTEN}/cmake/Modules/Platform/Emscripten.cmake -DCMAKE_BUILD_TYPE=Release ..`, {
+    // Configure with Emscripten. SST_WASM_THREADS=OFF gives a single-threaded
+    // build for pages that cannot be cross-origin isolated.
+    const threads = process.env.SST_WASM_THREADS === 'OFF' ? 'OFF' : 'ON';
+    execSync(`emcmake cmake -S .. -B . -DCMAKE_BUILD_TYPE=Release -DSST_WASM_THREADS=${threads}`, {
         cwd: buildDir,
         stdio: 'inherit'
     });
@@ -41,7 +50,7 @@ try {
         stdio: 'inherit'
     });
     
-    console.log('WASM build completed successfully!');
+    console.log('WASM build completed successfully! Test with: npm run test:wasm');
 } catch (err) {
     console.error('WASM build failed:', err.message);
     process.exit(1);
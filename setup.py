@@ -46,7 +46,8 @@ class CustomBuildExt(build_ext):
             if os.path.abspath(src_dir) not in ext_include_dirs:
                 ext.include_dirs.insert(0, src_dir)
             ext_sources = [os.path.abspath(s) if os.path.isabs(s) else os.path.abspath(os.path.join(base_dir, s)) for s in ext.sources]
-            if abs_source not in ext_sources:
+            # sstbindings only re-exports sstcore: keep the embedded tables in one module
+            if ext.name != "sstbindings" and abs_source not in ext_sources:
                 ext.sources.append(rel_source)
         
         # Add compiler-specific flags for better compatibility (apply to all extensions)
@@ -326,12 +327,21 @@ header_file, source_file = generate_embedded_knot_files()
 # Get all source files (must match CMakeLists sstcore_lib)
 src_files = [
     "src/ab_initio_mass.cpp",
+    "src/trefoil_closure_kernels.cpp",
+    "src/trefoil_closure_state.cpp",
+    "src/cell_list.cpp",
     "src/biot_savart.cpp",
     "src/fluid_dynamics.cpp",
     "src/field_kernels.cpp",
     "src/frenet_helicity.cpp",
     "src/potential_timefield.cpp",
     "src/magnus_integrator.cpp",
+    "src/ode_integrators.cpp",
+    "src/filament_remesh.cpp",
+    "src/local_induction.cpp",
+    "src/filament_system.cpp",
+    "src/trajectory_writer.cpp",
+    "src/checkpoint.cpp",
     "src/hyperbolic_volume.cpp",
     "src/knot_dynamics.cpp",
     "src/radiation_flow.cpp",
@@ -343,6 +353,9 @@ src_files = [
     "src/sst_gravity.cpp",
     "src/sst_extensions.cpp",
     "src/sst_integrator.cpp",
+    "src/thread_pool.cpp",
+    "src/job_system.cpp",
+    "src/profiler.cpp",
 ]
 
 # Generated embedded files will be added by CustomBuildExt during build
@@ -371,13 +384,14 @@ ext_modules = [
         define_macros=[('VERSION_INFO', __version__), ('KNOT_FILES_EMBEDDED_H', '1')],
         language='c++',
     ),
-    # Backwards compatibility module
+    # Backwards compatibility module: a thin alias that re-exports sstcore,
+    # so the core (and its embedded resources) is compiled and loaded once.
     Pybind11Extension(
         "sstbindings",
-        sources=["src/module_sstbindings.cpp"] + binding_files + src_files,
+        sources=["src/module_sstbindings.cpp"],
         include_dirs=include_dirs,
         cxx_std=cxx_std,
-        define_macros=[('VERSION_INFO', __version__), ('KNOT_FILES_EMBEDDED_H', '1')],
+        define_macros=[('VERSION_INFO', __version__)],
         language='c++',
     ),
 ]
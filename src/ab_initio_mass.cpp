@@ -3,8 +3,11 @@
 #include "../include/SST_Master_Dictionary.h"
 #include "knot_files_embedded.h"
 #include "biot_savart.h"
+#include "checkpoint.h"
 #include "frenet_helicity.h"
 #include "potential_timefield.h"
+#include "profiler.h"
+#include "thread_pool.h"
 #include <algorithm>
 #include <chrono>
 #include <cmath>
@@ -13,6 +16,9 @@
 #include <iomanip>
 #include <iostream>
 #include <knot_dynamics.h>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <sstream>
 #include <stdexcept>
@@ -46,23 +52,63 @@ namespace sst {
         return "";
     }
 
-    ParticleEvaluator::ParticleEvaluator(const std::string& knot_ab_id, int resolution) {
-        std::string db_content;
-        auto embedded_files = get_embedded_knot_files();
-        for (const auto& pair : embedded_files) {
-            if (pair.first.find("ideal_database.txt") != std::string::npos) {
-                db_content = pair.second;
-                break;
+    // Ideal database loaded once per process and indexed by AB Id, so repeated
+    // ParticleEvaluator construction (batch sweeps) skips the reload and the
+    // linear tag search. A failed load is not cached: env/cwd may change.
+    namespace {
+        struct IdealDatabaseIndex {
+            std::string content;
+            std::map<std::string, std::pair<std::size_t, std::size_t>> blocks; // id -> [start, end incl. </AB>)
+        };
+
+        std::shared_ptr<const IdealDatabaseIndex> shared_ideal_database() {
+            static std::mutex mtx;
+            static std::shared_ptr<const IdealDatabaseIndex> cached;
+            std::lock_guard<std::mutex> lk(mtx);
+            if (cached) return cached;
+
+            auto db = std::make_shared<IdealDatabaseIndex>();
+            auto embedded_files = get_embedded_knot_files();
+            for (const auto& pair : embedded_files) {
+                if (pair.first.find("ideal_database.txt") != std::string::npos) {
+                    db->content = pair.second;
+                    break;
+                }
             }
+            if (db->content.empty()) {
+                db->content = load_ideal_database_from_file();
+            }
+            if (db->content.empty()) return nullptr;
+
+            const std::string open_tag = "<AB Id=\"";
+            const std::string close_tag = "</AB>";
+            std::size_t pos = 0;
+            while ((pos = db->content.find(open_tag, pos)) != std::string::npos) {
+                const std::size_t id_start = pos + open_tag.size();
+                const std::size_t id_end = db->content.find('"', id_start);
+                const std::size_t end = db->content.find(close_tag, pos);
+                if (id_end == std::string::npos || end == std::string::npos) break;
+                // First occurrence wins, same as the former find()-based lookup.
+                db->blocks.emplace(db->content.substr(id_start, id_end - id_start),
+                                   std::make_pair(pos, end + close_tag.size()));
+                pos = end;
+            }
+            cached = std::move(db);
+            return cached;
         }
-        if (db_content.empty()) {
-            db_content = load_ideal_database_from_file();
-        }
-        if (db_content.empty()) {
+    }
+
+    ParticleEvaluator::ParticleEvaluator(const std::string& knot_ab_id, int resolution) {
+        auto db = shared_ideal_database();
+        if (!db) {
             throw std::runtime_error("[!] SSTcore: ideal_database.txt niet gevonden.");
         }
 
-        if (!extract_and_build_filament(db_content, knot_ab_id, resolution)) {
+        auto it = db->blocks.find(knot_ab_id);
+        if (it == db->blocks.end() ||
+            !extract_and_build_filament(
+                db->content.substr(it->second.first, it->second.second - it->second.first),
+                knot_ab_id, resolution)) {
             throw std::runtime_error("[!] SSTcore: Knoop ID " + knot_ab_id + " niet gevonden in database.");
         }
     }
@@ -144,40 +190,71 @@ namespace sst {
     void ParticleEvaluator::relax_hamiltonian(int iterations, double timestep, std::function<void()> interrupt_callback) {
         if (filaments.empty()) return;
 
+        relax_ = RelaxProgress{};
+        relax_.active = true;
+        relax_.iterations = iterations;
+        relax_.timestep = timestep;
+        relax_.velocities.resize(filaments.size());
+        for (size_t f = 0; f < filaments.size(); ++f) {
+            relax_.velocities[f].resize(filaments[f].size(), {0.0, 0.0, 0.0});
+        }
+        run_relaxation(interrupt_callback);
+    }
+
+    void ParticleEvaluator::resume_relaxation(std::function<void()> interrupt_callback) {
+        if (!relax_.active || filaments.empty()) return;
+        run_relaxation(interrupt_callback);
+    }
+
+    void ParticleEvaluator::run_relaxation(const std::function<void()>& interrupt_callback) {
         double k_spring = 25.0;
         double k_pressure = 15.0;
         double k_repulsion = 0.5;
         double repulsion_radius = 0.2;
         double damping = 0.70;
 
-        std::vector<std::vector<Vec3>> velocities(filaments.size());
-        for (size_t f = 0; f < filaments.size(); ++f) {
-            velocities[f].resize(filaments[f].size(), {0.0, 0.0, 0.0});
-        }
+        // Velocities and the iteration count live in relax_ so a snapshot
+        // taken between iterations can continue the run exactly.
+        auto& velocities = relax_.velocities;
+        const double timestep = relax_.timestep;
 
         auto start_time = std::chrono::high_resolution_clock::now();
+        SST_PROFILE_SCOPE("relax.run");
 
-        for (int iter = 0; iter < iterations; ++iter) {
+        while (relax_.iteration < relax_.iterations) {
             // --- Console Output logica hier (overslaan voor beknoptheid) ---
+            // Interrupt hook (Ctrl-C from Python, batch budgets): may throw to abort.
+            if (interrupt_callback) interrupt_callback();
 
             // 1. Bereken globaal zwaartepunt van ALLE draden samen
             Vec3 global_centroid = {0.0, 0.0, 0.0};
             size_t total_points = 0;
-            for (const auto& fil : filaments) {
-                for (const auto& pt : fil) {
-                    global_centroid[0] += pt[0]; global_centroid[1] += pt[1]; global_centroid[2] += pt[2];
+            {
+                SST_PROFILE_SCOPE("relax.centroid");
+                for (const auto& fil : filaments) {
+                    for (const auto& pt : fil) {
+                        global_centroid[0] += pt[0]; global_centroid[1] += pt[1]; global_centroid[2] += pt[2];
+                    }
+                    total_points += fil.size();
                 }
-                total_points += fil.size();
+                global_centroid[0] /= total_points; global_centroid[1] /= total_points; global_centroid[2] /= total_points;
             }
-            global_centroid[0] /= total_points; global_centroid[1] /= total_points; global_centroid[2] /= total_points;
 
             std::vector<std::vector<Vec3>> forces = velocities; // init met 0
             for (auto& row : forces) std::fill(row.begin(), row.end(), Vec3{0,0,0});
 
-            #pragma omp parallel for
-            for (int f = 0; f < (int)filaments.size(); ++f) {
-                int N = filaments[f].size();
-                for (int i = 0; i < N; ++i) {
+            {
+            SST_PROFILE_SCOPE_PAIRS("relax.forces", total_points * total_points);
+            // Every point only writes its own force: split the points of all
+            // filaments over the shared pool.
+            std::vector<size_t> first_point(filaments.size() + 1, 0);
+            for (size_t f = 0; f < filaments.size(); ++f) first_point[f + 1] = first_point[f] + filaments[f].size();
+            parallel_for(0, total_points, 16, [&](size_t lo, size_t hi) {
+                size_t f = std::upper_bound(first_point.begin(), first_point.end(), lo) - first_point.begin() - 1;
+                for (size_t p = lo; p < hi; ++p) {
+                    while (p >= first_point[f + 1]) ++f;
+                    int N = filaments[f].size();
+                    int i = static_cast<int>(p - first_point[f]);
                     int prev = (i - 1 + N) % N;
                     int next = (i + 1) % N;
                     Vec3 pt = filaments[f][i];
@@ -213,9 +290,12 @@ namespace sst {
                         }
                     }
                 }
+            });
             }
 
             // Toepassen snelheden
+            {
+            SST_PROFILE_SCOPE("relax.integrate");
             for (size_t f = 0; f < filaments.size(); ++f) {
                 for (size_t i = 0; i < filaments[f].size(); ++i) {
                     velocities[f][i][0] = (velocities[f][i][0] + forces[f][i][0] * timestep) * damping;
@@ -227,9 +307,18 @@ namespace sst {
                     filaments[f][i][2] += velocities[f][i][2] * timestep;
                 }
             }
+            }
+
+            ++relax_.iteration;
+            if (relax_checkpoint_every_ > 0 && relax_.iteration % relax_checkpoint_every_ == 0 &&
+                relax_.iteration < relax_.iterations) {
+                SST_PROFILE_SCOPE("relax.checkpoint");
+                save_checkpoint(relax_checkpoint_path_);
+            }
         }
 
         // --- HORN TORUS SCHALING (Multi-Component) ---
+        SST_PROFILE_SCOPE("relax.horn_scaling");
         Vec3 global_centroid = {0.0, 0.0, 0.0};
         size_t total_points = 0;
         double max_dist_sq = 0.0;
@@ -264,6 +353,75 @@ namespace sst {
                 pt[2] = global_centroid[2] + (pt[2] - global_centroid[2]) * scale;
             }
         }
+        relax_ = RelaxProgress{};
+    }
+
+    void ParticleEvaluator::set_checkpointing(const std::string& path, int every) {
+        if (every > 0 && path.empty()) {
+            throw std::invalid_argument("set_checkpointing: path must not be empty");
+        }
+        relax_checkpoint_path_ = path;
+        relax_checkpoint_every_ = every > 0 ? every : 0;
+    }
+
+    void ParticleEvaluator::save_checkpoint(const std::string& path) const {
+        SnapshotWriter out(SnapshotKind::ParticleRelaxation);
+        out.u64(filaments.size());
+        for (const auto& fil : filaments) out.points(fil);
+        out.boolean(relax_.active);
+        out.u64(static_cast<std::uint64_t>(relax_.iteration));
+        out.u64(static_cast<std::uint64_t>(relax_.iterations));
+        out.f64(relax_.timestep);
+        out.u64(relax_.velocities.size());
+        for (const auto& vel : relax_.velocities) out.points(vel);
+        out.boolean(tail_cfg_.enabled);
+        out.u64(static_cast<std::uint64_t>(tail_cfg_.radial_samples));
+        out.u64(static_cast<std::uint64_t>(tail_cfg_.azimuth_samples));
+        out.f64(tail_cfg_.r_min_factor);
+        out.f64(tail_cfg_.r_max_factor);
+        out.f64(tail_cfg_.exclusion_ds_factor);
+        out.boolean(tail_cfg_.use_log_shell_weight);
+        out.str(relax_checkpoint_path_);
+        out.u64(static_cast<std::uint64_t>(relax_checkpoint_every_));
+        out.commit(path);
+    }
+
+    void ParticleEvaluator::load_checkpoint(const std::string& path) {
+        SnapshotReader in(path, SnapshotKind::ParticleRelaxation);
+        std::vector<std::vector<Vec3>> fils(static_cast<size_t>(in.u64()));
+        for (auto& fil : fils) fil = in.points();
+        RelaxProgress relax;
+        relax.active = in.boolean();
+        relax.iteration = static_cast<int>(in.u64());
+        relax.iterations = static_cast<int>(in.u64());
+        relax.timestep = in.f64();
+        relax.velocities.resize(static_cast<size_t>(in.u64()));
+        for (auto& vel : relax.velocities) vel = in.points();
+        TailApproxConfig tail;
+        tail.enabled = in.boolean();
+        tail.radial_samples = static_cast<int>(in.u64());
+        tail.azimuth_samples = static_cast<int>(in.u64());
+        tail.r_min_factor = in.f64();
+        tail.r_max_factor = in.f64();
+        tail.exclusion_ds_factor = in.f64();
+        tail.use_log_shell_weight = in.boolean();
+        std::string ckpt_path = in.str();
+        const int ckpt_every = static_cast<int>(in.u64());
+        in.finish();
+        if (relax.active && relax.velocities.size() != fils.size()) {
+            throw std::runtime_error("load_checkpoint: '" + path + "' has inconsistent relaxation state");
+        }
+        filaments = std::move(fils);
+        relax_ = std::move(relax);
+        tail_cfg_ = tail;
+        relax_checkpoint_path_ = std::move(ckpt_path);
+        relax_checkpoint_every_ = ckpt_every;
+    }
+
+    ParticleEvaluator ParticleEvaluator::from_checkpoint(const std::string& path) {
+        ParticleEvaluator pe(std::vector<std::vector<Vec3>>{});
+        pe.load_checkpoint(path);
+        return pe;
     }
 
     double ParticleEvaluator::get_dimless_ropelength(double stretch_lambda) const {
@@ -372,30 +530,8 @@ namespace sst {
         return v_mul(a, 1.0 / n);
     }
 
-    void ParticleEvaluator::local_frame_at_index(std::size_t f, std::size_t i,
-                                                 Vec3& t_hat, Vec3& n_hat, Vec3& b_hat) const {
-        if (filaments.empty() || f >= filaments.size()) {
-            t_hat = {1, 0, 0}; n_hat = {0, 1, 0}; b_hat = {0, 0, 1};
-            return;
-        }
-        const auto& fil = filaments[f];
-        const size_t N = fil.size();
-        if (N < 3) {
-            t_hat = {1, 0, 0}; n_hat = {0, 1, 0}; b_hat = {0, 0, 1};
-            return;
-        }
-
-        size_t im1 = (i + N - 1) % N;
-        size_t ip1 = (i + 1) % N;
-        Vec3 t = v_sub(fil[ip1], fil[im1]);
-        t_hat = v_unit(t);
-
-        // Stable reference not parallel to tangent
-        Vec3 ref = (std::abs(t_hat[2]) < 0.9) ? Vec3{0, 0, 1} : Vec3{0, 1, 0};
-        n_hat = v_unit(v_cross(ref, t_hat));
-        if (v_norm(n_hat) < 1e-12) n_hat = {1, 0, 0};
-        b_hat = v_unit(v_cross(t_hat, n_hat));
-        n_hat = v_cross(b_hat, t_hat);
+    void ParticleEvaluator::local_frames(std::size_t f, BishopFrames& frames) const {
+        FrenetHelicity::compute_bishop_frames(filaments[f], frames);
     }
 
     Vec3 ParticleEvaluator::induced_velocity_bs_surrogate(const Vec3& p,
@@ -455,6 +591,7 @@ namespace sst {
         }
 
         double E_tail = 0.0;
+        BishopFrames frames;
         for (size_t f = 0; f < filaments.size(); ++f) {
             const auto& fil = filaments[f];
             const size_t N = fil.size();
@@ -470,9 +607,10 @@ namespace sst {
             const double ds_mean = Ltot / static_cast<double>(N);
             const double exclusion_len_m = tail_cfg_.exclusion_ds_factor * ds_mean;
 
+            local_frames(f, frames);
             for (size_t i = 0; i < N; ++i) {
-                Vec3 t_hat, n_hat, b_hat;
-                local_frame_at_index(f, i, t_hat, n_hat, b_hat);
+                const Vec3& n_hat = frames.U[i];
+                const Vec3& b_hat = frames.V[i];
                 const Vec3 c = fil[i];
                 const double dsi = ds[i];
 
@@ -505,13 +643,16 @@ namespace sst {
         metrics.helicity = 0.0;
         metrics.core_time_dilation = 1.0;
 
-        if (filaments.empty() || filaments[0].empty()) return metrics;
+        if (filaments.empty() || filaments[0].size() < 3) return metrics;
 
         const auto& fil = filaments[0];
         size_t N = fil.size();
 
-        std::vector<Vec3> T, N_vec, B;
-        FrenetHelicity::compute_frenet_frames(fil, T, N_vec, B);
+        // The filament is closed: the open-curve Frenet frames would copy
+        // the end tangents and break at straight segments.
+        BishopFrames frames;
+        FrenetHelicity::compute_bishop_frames(fil, frames);
+        const std::vector<Vec3>& T = frames.T;
 
         std::vector<Vec3> velocity(N);
         std::vector<Vec3> vorticity(N);
@@ -596,4 +737,134 @@ namespace sst {
         return static_cast<double>((mass_kg * c2) / MeV_J);
     }
 
+    // -------------------------------------------------------------------------
+    // ZooEvaluator: full ab initio pipeline, batched on a work-stealing pool
+    // -------------------------------------------------------------------------
+    std::string ZooEvaluator::dictionary_ab_id(const std::string& identifier) {
+        if (identifier == "Unknot") return "0:1:1";
+        if (identifier == "Unlink") return "0:2:1";
+
+        std::string token;
+        for (const char* prefix : {"Knot ", "Link "}) {
+            if (identifier.rfind(prefix, 0) == 0) {
+                token = identifier.substr(std::char_traits<char>::length(prefix));
+                break;
+            }
+        }
+        if (token.empty()) return identifier;
+        token = token.substr(0, token.find(' '));
+
+        // Rolfsen notation: C_I (knot) or C^N_I (N-component link) -> "C:N:I"
+        const std::size_t us = token.find('_');
+        if (us != std::string::npos) {
+            const std::size_t caret = token.find('^');
+            if (caret != std::string::npos && caret < us) {
+                return token.substr(0, caret) + ":" + token.substr(caret + 1, us - caret - 1) + ":" + token.substr(us + 1);
+            }
+            return token.substr(0, us) + ":1:" + token.substr(us + 1);
+        }
+        // Hoste-Thistlethwaite notation (e.g. 12a1202) as used by the <HT Id="K..."> databases
+        return "K" + token;
+    }
+
+    namespace {
+        struct EntryStopped {
+            const char* status;
+        };
+    }
+
+    std::vector<ZooEvaluator::AbInitioResult> ZooEvaluator::evaluate_all_ab_initio(
+            const AbInitioConfig& cfg, const ResultCallback& on_result, const CancelToken* cancel) {
+        std::vector<std::string> ids = cfg.identifiers;
+        if (ids.empty()) {
+            ids.reserve(SST_MASTER_DICTIONARY.size());
+            for (const auto& entry : SST_MASTER_DICTIONARY) ids.push_back(entry.first);
+        }
+
+        std::vector<AbInitioResult> results(ids.size());
+        if (ids.empty()) return results;
+
+        // Warm the shared database index before fanning out.
+        shared_ideal_database();
+
+        const double MeV_J = 1.602176634e-13;
+        std::atomic<bool> aborted{false};
+        std::mutex callback_mtx;
+        auto stop_requested = [&]() {
+            return aborted.load(std::memory_order_relaxed) || (cancel && cancel->cancelled());
+        };
+
+        auto evaluate = [&](std::size_t k) {
+            AbInitioResult& r = results[k];
+            r.index = k;
+            r.identifier = ids[k];
+            r.ab_id = SST_MASTER_DICTIONARY.count(ids[k]) ? dictionary_ab_id(ids[k]) : ids[k];
+            r.golden_nls_mass_mev = get_entry_mass(ids[k]);
+
+            using clock = std::chrono::steady_clock;
+            const auto t0 = clock::now();
+            const bool budgeted = cfg.time_budget_s > 0.0;
+            const auto deadline = t0 + std::chrono::duration_cast<clock::duration>(
+                std::chrono::duration<double>(budgeted ? cfg.time_budget_s : 0.0));
+            auto checkpoint = [&]() {
+                if (stop_requested()) throw EntryStopped{"cancelled"};
+                if (budgeted && clock::now() > deadline) throw EntryStopped{"timeout"};
+            };
+
+            try {
+                checkpoint();
+                ParticleEvaluator particle(r.ab_id, cfg.resolution);
+                particle.relax_hamiltonian(cfg.relax_iterations, cfg.relax_timestep, checkpoint);
+                r.ropelength_dimless = particle.get_dimless_ropelength(1.0);
+                r.core_energy_J = particle.compute_core_energy_J();
+                if (cfg.include_tail) {
+                    checkpoint();
+                    ParticleEvaluator::TailApproxConfig tail = cfg.tail_cfg;
+                    tail.enabled = true;
+                    particle.set_tail_approx_config(tail);
+                    r.tail_energy_J = particle.compute_tail_energy_J(true);
+                }
+                r.mass_mev_ab_initio = (r.core_energy_J + r.tail_energy_J) / MeV_J;
+                if (cfg.compute_metrics) {
+                    checkpoint();
+                    const auto metrics = particle.compute_relativistic_metrics(cfg.circulation);
+                    r.helicity = metrics.helicity;
+                    r.core_time_dilation = metrics.core_time_dilation;
+                }
+                r.status = "ok";
+            } catch (const EntryStopped& stopped) {
+                r.status = stopped.status;
+            } catch (const std::exception& e) {
+                r.status = "error";
+                r.message = e.what();
+            }
+            r.elapsed_s = std::chrono::duration<double>(clock::now() - t0).count();
+
+            if (on_result) {
+                std::lock_guard<std::mutex> lk(callback_mtx);
+                if (aborted.load(std::memory_order_relaxed)) return;
+                try {
+                    on_result(r);
+                } catch (...) {
+                    // A failing consumer (e.g. KeyboardInterrupt) stops the batch;
+                    // parallel_for rethrows it once the running entries end.
+                    aborted.store(true, std::memory_order_relaxed);
+                    throw;
+                }
+            }
+        };
+
+        // Entries run on the shared pool, so the batch follows set_num_threads()
+        // and each entry's own kernels run inline (nested). num_threads caps how
+        // many entries are in flight: that many slots pull the next index.
+        const std::size_t slots = cfg.num_threads ? std::min(cfg.num_threads, ids.size()) : ids.size();
+        std::atomic<std::size_t> next{0};
+        parallel_for(0, slots, 1, [&](std::size_t, std::size_t) {
+            for (std::size_t k; (k = next.fetch_add(1, std::memory_order_relaxed)) < ids.size();) {
+                evaluate(k);
+            }
+        });
+        return results;
+    }
+
 }
\ No newline at end of file
@@ -11,11 +11,14 @@
 #include <vector>
 #include <string>
 #include <array>
+#include <atomic>
 #include <functional>
 
 namespace sst {
 using Vec3 = std::array<double, 3>;
 
+struct BishopFrames;
+
 class ParticleEvaluator {
 private:
   // --- SST Canon Invariants ---
@@ -39,6 +42,19 @@ public:
 
   void relax_hamiltonian(int iterations, double timestep, std::function<void()> interrupt_callback = nullptr);
 
+  // Checkpoint/restart of relax_hamiltonian: the snapshot holds filaments,
+  // velocities, iteration counters, timestep and tail config (checkpoint.h).
+  // With set_checkpointing(path, every) a snapshot is written every `every`
+  // iterations; from_checkpoint() + resume_relaxation() then finish the run
+  // bit-identically, including the final horn-torus scaling.
+  void set_checkpointing(const std::string& path, int every);
+  void save_checkpoint(const std::string& path) const;
+  void load_checkpoint(const std::string& path);
+  static ParticleEvaluator from_checkpoint(const std::string& path);
+  bool has_pending_relaxation() const { return relax_.active; }
+  int relaxation_iteration() const { return relax_.iteration; }
+  void resume_relaxation(std::function<void()> interrupt_callback = nullptr);
+
   // Existing API
   double get_dimless_ropelength(double stretch_lambda = 1.0) const;
 
@@ -94,6 +110,19 @@ public:
 private:
   TailApproxConfig tail_cfg_{};
 
+  struct RelaxProgress {
+    bool active = false;   // between relax_hamiltonian() start and its final scaling
+    int iteration = 0;     // completed iterations
+    int iterations = 0;
+    double timestep = 0.0;
+    std::vector<std::vector<Vec3>> velocities;
+  };
+  RelaxProgress relax_{};
+  std::string relax_checkpoint_path_;
+  int relax_checkpoint_every_ = 0;
+
+  void run_relaxation(const std::function<void()>& interrupt_callback);
+
   // Vector helpers for Biot–Savart surrogate
   static Vec3 v_add(const Vec3& a, const Vec3& b);
   static Vec3 v_sub(const Vec3& a, const Vec3& b);
@@ -103,9 +132,9 @@ private:
   static double v_norm(const Vec3& a);
   static Vec3 v_unit(const Vec3& a);
 
-  // Build local orthonormal frame (t,n,b) at polyline index i
-  void local_frame_at_index(std::size_t f, std::size_t i,
-                            Vec3& t_hat, Vec3& n_hat, Vec3& b_hat) const;
+  // Closed-curve frames (t, n, b) = (T, U, V) for every node of filament f,
+  // built in one pass (frenet_helicity.h) and reused across the tail rings.
+  void local_frames(std::size_t f, BishopFrames& frames) const;
 
   // Return relaxed polyline in physical coordinates [m]
   std::vector<Vec3> get_relaxed_polyline_m() const;
@@ -139,6 +168,68 @@ public:
      * @brief Returns the Golden NLS mass for a specific dictionary entry.
      */
     static double get_entry_mass(const std::string& identifier);
+
+    // ------------------------------------------------------------
+    // Full ab initio pipeline over the dictionary (native batch)
+    // ------------------------------------------------------------
+    struct AbInitioConfig {
+        std::vector<std::string> identifiers; // dictionary names or raw AB ids; empty -> whole dictionary
+        int resolution = 1000;
+        int relax_iterations = 1200;
+        double relax_timestep = 0.005;
+        bool include_tail = false;
+        ParticleEvaluator::TailApproxConfig tail_cfg{};
+        bool compute_metrics = true;
+        double circulation = 9.683619203e-9;
+        double time_budget_s = 0.0;       // per-entry wall-clock budget; <= 0 disables
+        std::size_t num_threads = 0;      // max entries at once; 0 -> get_num_threads()
+    };
+
+    struct AbInitioResult {
+        std::size_t index = 0;            // position in the evaluated identifier list
+        std::string identifier;
+        std::string ab_id;
+        std::string status;               // "ok", "timeout", "cancelled", "error"
+        std::string message;
+        double golden_nls_mass_mev = -1.0;
+        double ropelength_dimless = 0.0;
+        double core_energy_J = 0.0;
+        double tail_energy_J = 0.0;
+        double mass_mev_ab_initio = 0.0;
+        double helicity = 0.0;
+        double core_time_dilation = 1.0;
+        double elapsed_s = 0.0;
+    };
+
+    // Cooperative cancellation flag, safe to flip from any thread.
+    class CancelToken {
+    public:
+        void cancel() { flag_.store(true, std::memory_order_relaxed); }
+        bool cancelled() const { return flag_.load(std::memory_order_relaxed); }
+    private:
+        std::atomic<bool> flag_{false};
+    };
+
+    using ResultCallback = std::function<void(const AbInitioResult&)>;
+
+    /**
+     * @brief Runs ParticleEvaluator (build, relax, core + tail energy, relativistic
+     * metrics) for every entry on a work-stealing pool. The ideal database is
+     * parsed once and shared by all entries. on_result is invoked (serialized)
+     * as soon as each entry finishes, in completion order; the returned vector
+     * is in input order. Budget and cancellation are checked once per relax
+     * iteration and between pipeline stages.
+     */
+    static std::vector<AbInitioResult> evaluate_all_ab_initio(const AbInitioConfig& cfg,
+                                                              const ResultCallback& on_result = nullptr,
+                                                              const CancelToken* cancel = nullptr);
+
+    /**
+     * @brief Maps a dictionary name to its ideal-database AB id
+     * ("Knot 3_1 (Trefoil)" -> "3:1:1", "Link 4^2_1 (Solomon's)" -> "4:2:1",
+     * "Unknot" -> "0:1:1"). Unrecognized names are returned unchanged.
+     */
+    static std::string dictionary_ab_id(const std::string& identifier);
 };
 
 } // namespace sst
@@ -2,10 +2,21 @@
 #include <pybind11/stl.h>
 #include <pybind11/functional.h>
 #include "ab_initio_mass.h"
+#include "vec3_numpy.h"
 
 namespace py = pybind11;
 using namespace sst;
 
+namespace {
+// Interrupt callback for relaxations running with the GIL released.
+void check_signals() {
+    py::gil_scoped_acquire gil;
+    if (PyErr_CheckSignals() != 0) {
+        throw py::error_already_set();
+    }
+}
+} // namespace
+
 void bind_ab_initio(py::module_& m) {
     py::class_<ParticleEvaluator::TailApproxConfig>(m, "TailApproxConfig")
         .def(py::init<>())
@@ -26,51 +37,78 @@ void bind_ab_initio(py::module_& m) {
     py::class_<ParticleEvaluator>(m, "ParticleEvaluator")
         // 1. The old String-based constructor
         .def(py::init<const std::string &, int>(),
-             py::arg("knot_ab_id"), py::arg("resolution") = 4000)
+             py::arg("knot_ab_id"), py::arg("resolution") = 4000,
+             py::call_guard<py::gil_scoped_release>())
 
-        // 2. The new Array-based constructor
-        .def(py::init<const std::vector<std::vector<std::array<double, 3>>> &>(),
+        // 2. The new Array-based constructor: a sequence of (N,3) arrays (or
+        //    lists of triples); each is read as one block, not point by point.
+        .def(py::init([](const py::sequence& input_filaments) {
+                 std::vector<std::vector<std::array<double, 3>>> filaments;
+                 filaments.reserve(py::len(input_filaments));
+                 for (const auto& item : input_filaments) {
+                     auto arr = item.cast<sst::Vec3ArrayArg>();
+                     auto rows = sst::as_vec3_span(arr, "ParticleEvaluator");
+                     filaments.emplace_back(rows.begin(), rows.end());
+                 }
+                 py::gil_scoped_release release;
+                 return ParticleEvaluator(filaments);
+             }),
              py::arg("input_filaments"))
 
+        // 3. Resume constructor: ParticleEvaluator(checkpoint="relax.sstsnap")
+        .def(py::init([](const std::string& checkpoint) { return ParticleEvaluator::from_checkpoint(checkpoint); }),
+             py::arg("checkpoint"), py::call_guard<py::gil_scoped_release>())
+
+        // relax() runs without the GIL so other Python threads keep going; the
+        // per-iteration Ctrl-C check takes it back just long enough to poll.
+        // A single evaluator must not be relaxed from two threads at once.
         .def("relax", [](ParticleEvaluator& self, int iterations, double timestep) {
-            self.relax_hamiltonian(iterations, timestep, []() {
-                if (PyErr_CheckSignals() != 0) {
-                    throw py::error_already_set();
-                }
-            });
+            py::gil_scoped_release release;
+            self.relax_hamiltonian(iterations, timestep, check_signals);
         }, py::arg("iterations") = 1000, py::arg("timestep") = 0.01)
 
+        // Checkpoint/restart of relax()
+        .def("set_checkpointing", &ParticleEvaluator::set_checkpointing, py::arg("path"), py::arg("every"),
+             "Write a snapshot every `every` relax() iterations (0 disables).")
+        .def("save_checkpoint", &ParticleEvaluator::save_checkpoint, py::arg("path"))
+        .def("load_checkpoint", &ParticleEvaluator::load_checkpoint, py::arg("path"))
+        .def_property_readonly("has_pending_relaxation", &ParticleEvaluator::has_pending_relaxation)
+        .def_property_readonly("relaxation_iteration", &ParticleEvaluator::relaxation_iteration)
+        .def("resume_relaxation", [](ParticleEvaluator& self) {
+            py::gil_scoped_release release;
+            self.resume_relaxation(check_signals);
+        }, "Finish a relax() interrupted by Ctrl-C or restored from a checkpoint.")
+
         // Expose the stretch_lambda parameter to Python
         .def("get_dimless_ropelength", &ParticleEvaluator::get_dimless_ropelength, py::arg("stretch_lambda") = 1.0)
 
         // NEW: expose ab initio core-energy mass path
         .def("get_physical_length_m", &ParticleEvaluator::get_physical_length_m)
-        .def("compute_core_energy_J", &ParticleEvaluator::compute_core_energy_J)
-        .def("compute_tail_energy_J", &ParticleEvaluator::compute_tail_energy_J, py::arg("include_tail") = false)
-        .def("get_mass_mev_ab_initio", &ParticleEvaluator::get_mass_mev_ab_initio, py::arg("include_tail") = false)
+        .def("compute_core_energy_J", &ParticleEvaluator::compute_core_energy_J,
+             py::call_guard<py::gil_scoped_release>())
+        .def("compute_tail_energy_J", &ParticleEvaluator::compute_tail_energy_J, py::arg("include_tail") = false,
+             py::call_guard<py::gil_scoped_release>())
+        .def("get_mass_mev_ab_initio", &ParticleEvaluator::get_mass_mev_ab_initio, py::arg("include_tail") = false,
+             py::call_guard<py::gil_scoped_release>())
         .def("get_core_mass_mev_only", &ParticleEvaluator::get_core_mass_mev_only)
 
         // Tail-energy surrogate
         .def("set_tail_approx_config", &ParticleEvaluator::set_tail_approx_config)
         .def("get_tail_approx_config", &ParticleEvaluator::get_tail_approx_config)
-        .def("compute_tail_energy_surrogate_J", &ParticleEvaluator::compute_tail_energy_surrogate_J)
+        .def("compute_tail_energy_surrogate_J", &ParticleEvaluator::compute_tail_energy_surrogate_J,
+             py::call_guard<py::gil_scoped_release>())
 
         .def("compute_relativistic_metrics", &ParticleEvaluator::compute_relativistic_metrics,
-             py::arg("circulation") = 9.683619203e-9)
+             py::arg("circulation") = 9.683619203e-9, py::call_guard<py::gil_scoped_release>())
         .def_static("print_canonical_derivation", &ParticleEvaluator::print_canonical_derivation,
                             "Prints the dynamic fluid derivation of the core density.")
         .def("get_filaments", [](const ParticleEvaluator& self) {
-            std::vector<std::vector<std::array<double, 3>>> py_filaments;
+            py::list py_filaments;
             for (const auto& fil : self.filaments) {
-                std::vector<std::array<double, 3>> py_fil;
-                py_fil.reserve(fil.size());
-                for (const auto& pt : fil) {
-                    py_fil.push_back({pt[0], pt[1], pt[2]});
-                }
-                py_filaments.push_back(py_fil);
+                py_filaments.append(sst::vec3_array(fil));
             }
             return py_filaments;
-        }, "Export the 3D coordinates of all present vortex rings.");
+        }, "Export the 3D coordinates of all present vortex rings as a list of (N,3) arrays.");
 
     // ZooEvaluator: batch Golden NLS mass from SST_MASTER_DICTIONARY
     py::class_<ZooEvaluator::Result>(m, "ZooResult")
@@ -79,9 +117,69 @@ void bind_ab_initio(py::module_& m) {
         .def_readonly("bridge_b", &ZooEvaluator::Result::bridge_b)
         .def_readonly("genus_g", &ZooEvaluator::Result::genus_g);
 
+    py::class_<ZooEvaluator::AbInitioConfig>(m, "ZooAbInitioConfig")
+        .def(py::init<>())
+        .def_readwrite("identifiers", &ZooEvaluator::AbInitioConfig::identifiers)
+        .def_readwrite("resolution", &ZooEvaluator::AbInitioConfig::resolution)
+        .def_readwrite("relax_iterations", &ZooEvaluator::AbInitioConfig::relax_iterations)
+        .def_readwrite("relax_timestep", &ZooEvaluator::AbInitioConfig::relax_timestep)
+        .def_readwrite("include_tail", &ZooEvaluator::AbInitioConfig::include_tail)
+        .def_readwrite("tail_cfg", &ZooEvaluator::AbInitioConfig::tail_cfg)
+        .def_readwrite("compute_metrics", &ZooEvaluator::AbInitioConfig::compute_metrics)
+        .def_readwrite("circulation", &ZooEvaluator::AbInitioConfig::circulation)
+        .def_readwrite("time_budget_s", &ZooEvaluator::AbInitioConfig::time_budget_s)
+        .def_readwrite("num_threads", &ZooEvaluator::AbInitioConfig::num_threads);
+
+    py::class_<ZooEvaluator::AbInitioResult>(m, "ZooAbInitioResult")
+        .def_readonly("index", &ZooEvaluator::AbInitioResult::index)
+        .def_readonly("identifier", &ZooEvaluator::AbInitioResult::identifier)
+        .def_readonly("ab_id", &ZooEvaluator::AbInitioResult::ab_id)
+        .def_readonly("status", &ZooEvaluator::AbInitioResult::status)
+        .def_readonly("message", &ZooEvaluator::AbInitioResult::message)
+        .def_readonly("golden_nls_mass_mev", &ZooEvaluator::AbInitioResult::golden_nls_mass_mev)
+        .def_readonly("ropelength_dimless", &ZooEvaluator::AbInitioResult::ropelength_dimless)
+        .def_readonly("core_energy_J", &ZooEvaluator::AbInitioResult::core_energy_J)
+        .def_readonly("tail_energy_J", &ZooEvaluator::AbInitioResult::tail_energy_J)
+        .def_readonly("mass_mev_ab_initio", &ZooEvaluator::AbInitioResult::mass_mev_ab_initio)
+        .def_readonly("helicity", &ZooEvaluator::AbInitioResult::helicity)
+        .def_readonly("core_time_dilation", &ZooEvaluator::AbInitioResult::core_time_dilation)
+        .def_readonly("elapsed_s", &ZooEvaluator::AbInitioResult::elapsed_s);
+
+    py::class_<ZooEvaluator::CancelToken>(m, "ZooCancelToken")
+        .def(py::init<>())
+        .def("cancel", &ZooEvaluator::CancelToken::cancel)
+        .def_property_readonly("cancelled", &ZooEvaluator::CancelToken::cancelled);
+
     py::class_<ZooEvaluator>(m, "ZooEvaluator")
         .def_static("evaluate_all_golden_nls", &ZooEvaluator::evaluate_all_golden_nls,
             "Run ab initio Golden NLS mass evaluation for the entire SST Master Dictionary.")
         .def_static("get_entry_mass", &ZooEvaluator::get_entry_mass,
-            py::arg("identifier"), "Get the mass of a specific knot by its dictionary ID.");
+            py::arg("identifier"), "Get the mass of a specific knot by its dictionary ID.")
+        .def_static("dictionary_ab_id", &ZooEvaluator::dictionary_ab_id,
+            py::arg("identifier"), "Map a dictionary name (e.g. 'Knot 3_1 (Trefoil)') to its ideal-database AB id.")
+        .def_static("evaluate_all_ab_initio",
+            [](const ZooEvaluator::AbInitioConfig& cfg,
+               const ZooEvaluator::ResultCallback& on_result,
+               const ZooEvaluator::CancelToken* cancel) {
+                ZooEvaluator::ResultCallback cb;
+                if (on_result) {
+                    // pybind's std::function wrapper takes the GIL for the call itself;
+                    // also surface Ctrl-C so a long batch stays interruptible.
+                    cb = [on_result](const ZooEvaluator::AbInitioResult& r) {
+                        on_result(r);
+                        py::gil_scoped_acquire gil;
+                        if (PyErr_CheckSignals() != 0) {
+                            throw py::error_already_set();
+                        }
+                    };
+                }
+                py::gil_scoped_release release;
+                return ZooEvaluator::evaluate_all_ab_initio(cfg, cb, cancel);
+            },
+            py::arg("config") = ZooEvaluator::AbInitioConfig{},
+            py::arg("on_result") = nullptr,
+            py::arg("cancel") = nullptr,
+            "Full ab initio pipeline (build, relax, core+tail energy, relativistic metrics) over the\n"
+            "SST Master Dictionary on native worker threads. on_result(ZooAbInitioResult) streams each\n"
+            "entry as it finishes; cancel (ZooCancelToken) and config.time_budget_s stop work early.");
 }
\ No newline at end of file
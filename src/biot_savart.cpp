@@ -1,4 +1,6 @@
 #include "biot_savart.h"
+#include "profiler.h"
+#include "thread_pool.h"
 #include <algorithm>
 #include <cmath>
 #include <numeric>
@@ -6,18 +8,19 @@
 namespace sst {
 
     std::vector<Vec3> BiotSavart::computeVelocity(
-        const std::vector<Vec3>& curve,
-        const std::vector<Vec3>& grid_points
+        std::span<const Vec3> curve,
+        std::span<const Vec3> grid_points
     ) {
       // Preserve historical behavior exactly: Gamma = 1.0
       return computeVelocity(curve, grid_points, 1.0);
     }
 
     std::vector<Vec3> BiotSavart::computeVelocity(
-        const std::vector<Vec3>& curve,
-        const std::vector<Vec3>& grid_points,
+        std::span<const Vec3> curve,
+        std::span<const Vec3> grid_points,
         double Gamma
     ) {
+      SST_PROFILE_SCOPE_PAIRS("biot_savart.velocity", curve.size() * grid_points.size());
       std::vector<Vec3> vel(grid_points.size(), {0.0, 0.0, 0.0});
 
       if (curve.size() < 2 || grid_points.empty()) {
@@ -27,27 +30,42 @@ namespace sst {
       const size_t N = curve.size();
       const double factor = Gamma / (4.0 * M_PI);
 
+      std::vector<Vec3> dl(N), mid(N);
       for (size_t i = 0; i < N; ++i) {
         const Vec3& r0 = curve[i];
         const Vec3& r1 = curve[(i + 1) % N];
-        Vec3 dl = { r1[0] - r0[0], r1[1] - r0[1], r1[2] - r0[2] };
-        Vec3 mid = { 0.5*(r0[0] + r1[0]), 0.5*(r0[1] + r1[1]), 0.5*(r0[2] + r1[2]) };
-
-        for (size_t g = 0; g < grid_points.size(); ++g) {
-          Vec3 R = { grid_points[g][0] - mid[0],
-                    grid_points[g][1] - mid[1],
-                    grid_points[g][2] - mid[2] };
-
-          double normR = std::pow(R[0]*R[0] + R[1]*R[1] + R[2]*R[2], 1.5) + 1e-12;
-          Vec3 cross = {
-              dl[1]*R[2] - dl[2]*R[1],
-              dl[2]*R[0] - dl[0]*R[2],
-              dl[0]*R[1] - dl[1]*R[0]
-          };
-          vel[g][0] += cross[0] / normR;
-          vel[g][1] += cross[1] / normR;
-          vel[g][2] += cross[2] / normR;
+        dl[i] = { r1[0] - r0[0], r1[1] - r0[1], r1[2] - r0[2] };
+        mid[i] = { 0.5*(r0[0] + r1[0]), 0.5*(r0[1] + r1[1]), 0.5*(r0[2] + r1[2]) };
+      }
+
+      // Grid points are independent; each sums the segments in curve order,
+      // so the result does not depend on the thread count.
+      auto points = [&](size_t lo, size_t hi) {
+        for (size_t g = lo; g < hi; ++g) {
+          Vec3 acc = {0.0, 0.0, 0.0};
+          for (size_t i = 0; i < N; ++i) {
+            Vec3 R = { grid_points[g][0] - mid[i][0],
+                      grid_points[g][1] - mid[i][1],
+                      grid_points[g][2] - mid[i][2] };
+
+            double normR = std::pow(R[0]*R[0] + R[1]*R[1] + R[2]*R[2], 1.5) + 1e-12;
+            Vec3 cross = {
+                dl[i][1]*R[2] - dl[i][2]*R[1],
+                dl[i][2]*R[0] - dl[i][0]*R[2],
+                dl[i][0]*R[1] - dl[i][1]*R[0]
+            };
+            acc[0] += cross[0] / normR;
+            acc[1] += cross[1] / normR;
+            acc[2] += cross[2] / normR;
+          }
+          vel[g] = acc;
         }
+      };
+      constexpr size_t kPointGrain = 64;
+      if (grid_points.size() <= kPointGrain) {
+        points(0, grid_points.size());
+      } else {
+        parallel_for(0, grid_points.size(), kPointGrain, points);
       }
 
       for (auto& v : vel) {
@@ -57,10 +75,11 @@ namespace sst {
     }
 
     std::vector<Vec3> BiotSavart::computeVorticity(
-        const std::vector<Vec3>& velocity,
+        std::span<const Vec3> velocity,
         const std::array<int, 3>& shape,
         double spacing
     ) {
+      SST_PROFILE_SCOPE("biot_savart.vorticity");
       int nx = shape[0], ny = shape[1], nz = shape[2];
       auto idx = [&](int i, int j, int k) {
         return ((i + nx) % nx) * ny * nz + ((j + ny) % ny) * nz + ((k + nz) % nz);
@@ -90,7 +109,7 @@ namespace sst {
     }
 
     std::vector<Vec3> BiotSavart::extractInterior(
-        const std::vector<Vec3>& field,
+        std::span<const Vec3> field,
         const std::array<int, 3>& shape,
         int margin
     ) {
@@ -107,10 +126,11 @@ namespace sst {
     }
 
     std::tuple<double,double,double> BiotSavart::computeInvariants(
-        const std::vector<Vec3>& v_sub,
-        const std::vector<Vec3>& w_sub,
+        std::span<const Vec3> v_sub,
+        std::span<const Vec3> w_sub,
         const std::vector<double>& r_sq
     ) {
+      SST_PROFILE_SCOPE("biot_savart.invariants");
       double Hc = 0.0;
       for (size_t i = 0; i < v_sub.size(); ++i) {
         Hc += v_sub[i][0]*w_sub[i][0] + v_sub[i][1]*w_sub[i][1] + v_sub[i][2]*w_sub[i][2];
@@ -160,6 +180,29 @@ namespace sst {
         return v;
     }
 
+    void BiotSavart::self_velocities(const std::vector<Vec3>& X,
+                                     const std::vector<Vec3>& T,
+                                     double Gamma,
+                                     std::vector<Vec3>& out)
+    {
+        const std::size_t n = X.size();
+        out.resize(n);
+        // Below a few hundred nodes the pool hand-off costs more than the rows.
+        constexpr std::size_t kSerialNodes = 256;
+        constexpr std::size_t kNodeGrain = 16;
+        if (n < kSerialNodes) {
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = velocity(X[i], X, T, Gamma);
+            }
+            return;
+        }
+        parallel_for(0, n, kNodeGrain, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t i = lo; i < hi; ++i) {
+                out[i] = velocity(X[i], X, T, Gamma);
+            }
+        });
+    }
+
     std::vector<double> bs_cutoff_energy_scan(
         const double* p,
         const double* t,
@@ -168,6 +211,7 @@ namespace sst {
         const double* a_values,
         std::size_t m)
     {
+        SST_PROFILE_SCOPE_PAIRS("biot_savart.cutoff_energy_scan", n * n);
         std::vector<double> cutoffs(m);
         for (std::size_t k = 0; k < m; ++k) {
             cutoffs[k] = a_values[k];
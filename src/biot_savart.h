@@ -7,6 +7,7 @@
 
 #pragma once
 #include <array>
+#include <span>
 #include <vector>
 #include <tuple>
 
@@ -20,40 +21,43 @@ namespace sst {
         class BiotSavart {
         public:
 
+          // Point and field buffers are taken as spans so the Python layer can
+          // pass (N,3) NumPy arrays without copying; std::vector converts implicitly.
+
           // Backward-compatible overload:
           // Compute Biot–Savart velocity field from a closed curve (points)
           // at given grid points using the historical default circulation Gamma = 1.
           static std::vector<Vec3> computeVelocity(
-              const std::vector<Vec3>& curve,
-              const std::vector<Vec3>& grid_points
+              std::span<const Vec3> curve,
+              std::span<const Vec3> grid_points
           );
 
           // New overload:
           // Same computation, but with explicit circulation Gamma.
           static std::vector<Vec3> computeVelocity(
-              const std::vector<Vec3>& curve,
-              const std::vector<Vec3>& grid_points,
+              std::span<const Vec3> curve,
+              std::span<const Vec3> grid_points,
               double Gamma
           );
 
           // Compute vorticity from velocity field on a regular grid
           static std::vector<Vec3> computeVorticity(
-              const std::vector<Vec3>& velocity,
+              std::span<const Vec3> velocity,
               const std::array<int, 3>& shape,
               double spacing
           );
 
           // Extract cubic interior field subset
           static std::vector<Vec3> extractInterior(
-              const std::vector<Vec3>& field,
+              std::span<const Vec3> field,
               const std::array<int, 3>& shape,
               int margin
           );
 
           // Compute H_charge, H_mass, and a_mu from velocity/vorticity
           static std::tuple<double, double, double> computeInvariants(
-              const std::vector<Vec3>& v_sub,
-              const std::vector<Vec3>& w_sub,
+              std::span<const Vec3> v_sub,
+              std::span<const Vec3> w_sub,
               const std::vector<double>& r_sq
           );
 
@@ -61,6 +65,14 @@ namespace sst {
               const std::vector<Vec3>& X,
               const std::vector<Vec3>& T,
               double Gamma = 1.0);
+
+          // Velocity induced by the filament (X, T) at each of its own nodes,
+          // out[i] = velocity(X[i], X, T, Gamma). out is resized to X.size();
+          // rows are independent and run on the shared thread pool.
+          static void self_velocities(const std::vector<Vec3>& X,
+              const std::vector<Vec3>& T,
+              double Gamma,
+              std::vector<Vec3>& out);
         };
 
         inline Vec3 biot_savart_velocity(const Vec3& r,
@@ -70,6 +82,13 @@ namespace sst {
       return BiotSavart::velocity(r, X, T, Gamma);
         }
 
+        inline void biot_savart_self_velocities(const std::vector<Vec3>& X,
+              const std::vector<Vec3>& T,
+              double Gamma,
+              std::vector<Vec3>& out) {
+      BiotSavart::self_velocities(X, T, Gamma, out);
+        }
+
         // Cutoff-scanned Biot–Savart / Neumann-style filament energy (trefoil sweep kernel).
         // points, tangents: row-major (n, 3); ds length n; a_values length m, sorted ascending.
         // Returns E(a_k) for k = 0..m-1 with E_BS(a) = (1/8pi) * sum_{i!=j, dist>a} (t_i·t_j)/dist * ds_i ds_j.
@@ -6,24 +6,12 @@
 #include <string>
 #include "biot_savart.h"
 #include "trefoil_closure_kernels.h"
+#include "trefoil_closure_state.h"
+#include "vec3_numpy.h"
 
 namespace py = pybind11;
 using namespace sst;
 
-static std::vector<Vec3> to_vec3_list(
-    py::array_t<double, py::array::c_style | py::array::forcecast> arr)
-{
-  if(arr.ndim()!=2 || arr.shape(1)!=3)
-    throw std::invalid_argument("Expected array with shape (N,3)");
-  const py::ssize_t N = arr.shape(0);
-  std::vector<Vec3> out((size_t)N);
-  auto a = arr.unchecked<2>();
-  for(py::ssize_t i=0;i<N;++i){
-    out[(size_t)i] = { a(i,0), a(i,1), a(i,2) };
-  }
-  return out;
-}
-
 static void require_points_n3(py::ssize_t rows, py::ssize_t cols, const char* ctx) {
   if (cols != 3) {
     throw std::runtime_error(std::string(ctx) + ": points must have shape (N, 3)");
@@ -37,23 +25,51 @@ void bind_biot_savart(py::module_& m) {
   py::class_<BiotSavart>(m, "BiotSavart")
       .def_static(
           "compute_velocity",
-          [](const std::vector<Vec3>& curve,
-             const std::vector<Vec3>& grid_points,
+          [](std::span<const Vec3> curve,
+             std::span<const Vec3> grid_points,
              double circulation) {
-            return BiotSavart::computeVelocity(curve, grid_points, circulation);
+            std::vector<Vec3> V;
+            {
+              py::gil_scoped_release release;
+              V = BiotSavart::computeVelocity(curve, grid_points, circulation);
+            }
+            return vec3_array(std::move(V));
           },
           py::arg("curve"),
           py::arg("grid_points"),
           py::arg("circulation") = 1.0,
           "Compute the Biot–Savart velocity field from a closed curve at given grid points.\n"
-          "Backward compatible with the historical 2-argument call; circulation defaults to 1.0.")
-      .def_static("compute_vorticity",  &BiotSavart::computeVorticity)
-      .def_static("extract_interior",   &BiotSavart::extractInterior)
-      .def_static("compute_invariants", &BiotSavart::computeInvariants);
+          "Backward compatible with the historical 2-argument call; circulation defaults to 1.0.\n"
+          "(N,3) float64 arrays are read in place; the result is a (G,3) array.")
+      .def_static(
+          "compute_vorticity",
+          [](std::span<const Vec3> velocity, const std::array<int, 3>& shape, double spacing) {
+            std::vector<Vec3> W;
+            {
+              py::gil_scoped_release release;
+              W = BiotSavart::computeVorticity(velocity, shape, spacing);
+            }
+            return vec3_array(std::move(W));
+          },
+          py::arg("velocity"), py::arg("shape"), py::arg("spacing"))
+      .def_static(
+          "extract_interior",
+          [](std::span<const Vec3> field, const std::array<int, 3>& shape, int margin) {
+            std::vector<Vec3> sub;
+            {
+              py::gil_scoped_release release;
+              sub = BiotSavart::extractInterior(field, shape, margin);
+            }
+            return vec3_array(std::move(sub));
+          },
+          py::arg("field"), py::arg("shape"), py::arg("margin"))
+      .def_static("compute_invariants", &BiotSavart::computeInvariants,
+                  py::call_guard<py::gil_scoped_release>());
 
   m.def("biot_savart_velocity", &sst::BiotSavart::velocity,
         py::arg("r"), py::arg("filament_points"),
         py::arg("tangent_vectors"), py::arg("circulation") = 1.0,
+        py::call_guard<py::gil_scoped_release>(),
         "Velocity at a single point r due to a filament.");
 
   // Convenience: grid-based velocity  (polyline (N,3), grid (G,3)) -> (G,3)
@@ -62,20 +78,14 @@ void bind_biot_savart(py::module_& m) {
            py::array_t<double, py::array::c_style | py::array::forcecast> grid,
            double circulation)
         {
-          auto wire = to_vec3_list(polyline);
-          auto pts  = to_vec3_list(grid);
-          std::vector<Vec3> V = BiotSavart::computeVelocity(wire, pts, circulation);
-
-          // pack to NumPy (G,3)
-          const py::ssize_t G = (py::ssize_t)V.size();
-          py::array_t<double> out({G,(py::ssize_t)3});
-          auto o = out.mutable_unchecked<2>();
-          for(py::ssize_t i=0;i<G;++i){
-            o(i,0)=V[(size_t)i][0];
-            o(i,1)=V[(size_t)i][1];
-            o(i,2)=V[(size_t)i][2];
+          auto wire = as_vec3_span(polyline, "biot_savart_velocity_grid");
+          auto pts  = as_vec3_span(grid, "biot_savart_velocity_grid");
+          std::vector<Vec3> V;
+          {
+            py::gil_scoped_release release;
+            V = BiotSavart::computeVelocity(wire, pts, circulation);
           }
-          return out;
+          return vec3_array(std::move(V));  // (G,3), owns V's buffer
         },
         py::arg("polyline"), py::arg("grid"), py::arg("circulation") = 1.0,
         "Biot–Savart velocity at arbitrary grid points for a polyline.\n"
@@ -87,6 +97,7 @@ void bind_biot_savart(py::module_& m) {
       [](py::array_t<double, py::array::c_style | py::array::forcecast> points, double rc) {
         auto r = points.unchecked<2>();
         require_points_n3(r.shape(0), r.shape(1), "calculate_neumann_self_energy");
+        py::gil_scoped_release release;
         return sst::trefoil_neumann_self_energy(&r(0, 0), static_cast<std::size_t>(r.shape(0)), rc);
       },
       py::arg("points"),
@@ -98,17 +109,32 @@ void bind_biot_savart(py::module_& m) {
       [](py::array_t<double, py::array::c_style | py::array::forcecast> points, double rc) {
         auto r = points.unchecked<2>();
         require_points_n3(r.shape(0), r.shape(1), "calculate_core_repulsion");
+        py::gil_scoped_release release;
         return sst::trefoil_core_repulsion(&r(0, 0), static_cast<std::size_t>(r.shape(0)), rc);
       },
       py::arg("points"),
       py::arg("rc"),
-      "Hard-core volume repulsion (trefoil_closure/sst_core compatibility).");
+      "Hard-core volume repulsion (trefoil_closure/sst_core compatibility).\n"
+      "Only pairs within 20*rc contribute; large curves use a cell list (exactly equal to the all-pairs sum).");
+
+  m.def(
+      "calculate_core_repulsion_reference",
+      [](py::array_t<double, py::array::c_style | py::array::forcecast> points, double rc) {
+        auto r = points.unchecked<2>();
+        require_points_n3(r.shape(0), r.shape(1), "calculate_core_repulsion_reference");
+        py::gil_scoped_release release;
+        return sst::trefoil_core_repulsion_reference(&r(0, 0), static_cast<std::size_t>(r.shape(0)), rc);
+      },
+      py::arg("points"),
+      py::arg("rc"),
+      "All-pairs O(N^2) core repulsion, kept as the reference for the cell-list path.");
 
   m.def(
       "calculate_length",
       [](py::array_t<double, py::array::c_style | py::array::forcecast> points) {
         auto r = points.unchecked<2>();
         require_points_n3(r.shape(0), r.shape(1), "calculate_length");
+        py::gil_scoped_release release;
         return sst::trefoil_polyline_length(&r(0, 0), static_cast<std::size_t>(r.shape(0)));
       },
       py::arg("points"),
@@ -119,6 +145,7 @@ void bind_biot_savart(py::module_& m) {
       [](py::array_t<double, py::array::c_style | py::array::forcecast> points, double rc) {
         auto r = points.unchecked<2>();
         require_points_n3(r.shape(0), r.shape(1), "calculate_writhe");
+        py::gil_scoped_release release;
         return sst::trefoil_writhe_reg(&r(0, 0), static_cast<std::size_t>(r.shape(0)), rc);
       },
       py::arg("points"),
@@ -130,11 +157,203 @@ void bind_biot_savart(py::module_& m) {
       [](py::array_t<double, py::array::c_style | py::array::forcecast> points) {
         auto r = points.unchecked<2>();
         require_points_n3(r.shape(0), r.shape(1), "calculate_curvature_penalty");
+        py::gil_scoped_release release;
         return sst::trefoil_curvature_penalty_menger(&r(0, 0), static_cast<std::size_t>(r.shape(0)));
       },
       py::arg("points"),
       "Menger curvature penalty integral (trefoil_closure/sst_core compatibility).");
 
+  py::class_<sst::TrefoilClosureEnergies>(m, "TrefoilClosureEnergies")
+      .def_readonly("neumann_self_energy", &sst::TrefoilClosureEnergies::neumann_self_energy)
+      .def_readonly("core_repulsion", &sst::TrefoilClosureEnergies::core_repulsion)
+      .def_readonly("writhe_reg", &sst::TrefoilClosureEnergies::writhe_reg)
+      .def_readonly("polyline_length", &sst::TrefoilClosureEnergies::polyline_length)
+      .def_readonly("curvature_penalty_menger", &sst::TrefoilClosureEnergies::curvature_penalty_menger)
+      .def("__repr__", [](const sst::TrefoilClosureEnergies& e) {
+        return "TrefoilClosureEnergies(C_N=" + std::to_string(e.neumann_self_energy) +
+               ", U_rep=" + std::to_string(e.core_repulsion) +
+               ", Wr=" + std::to_string(e.writhe_reg) +
+               ", L=" + std::to_string(e.polyline_length) +
+               ", K=" + std::to_string(e.curvature_penalty_menger) + ")";
+      });
+
+  m.def(
+      "calculate_closure_energies",
+      [](py::array_t<double, py::array::c_style | py::array::forcecast> points, double rc) {
+        auto r = points.unchecked<2>();
+        require_points_n3(r.shape(0), r.shape(1), "calculate_closure_energies");
+        py::gil_scoped_release release;
+        return sst::trefoil_closure_energies(&r(0, 0), static_cast<std::size_t>(r.shape(0)), rc);
+      },
+      py::arg("points"),
+      py::arg("rc"),
+      "All trefoil closure terms (Neumann, core repulsion, writhe, length, Menger curvature) from one\n"
+      "fused parallel pair traversal; each field equals the matching calculate_* call exactly.");
+
+  // (value, grad) variants for gradient-based optimizers (scipy L-BFGS etc.); grad has shape (N, 3).
+  m.def(
+      "calculate_neumann_self_energy_grad",
+      [](py::array_t<double, py::array::c_style | py::array::forcecast> points, double rc) {
+        auto r = points.unchecked<2>();
+        require_points_n3(r.shape(0), r.shape(1), "calculate_neumann_self_energy_grad");
+        py::array_t<double> grad({r.shape(0), (py::ssize_t)3});
+        double* g = grad.mutable_data();
+        double value = 0.0;
+        {
+          py::gil_scoped_release release;
+          value = sst::trefoil_neumann_self_energy_grad(
+              &r(0, 0), static_cast<std::size_t>(r.shape(0)), rc, g);
+        }
+        return py::make_tuple(value, grad);
+      },
+      py::arg("points"),
+      py::arg("rc"),
+      "Neumann integral C_N(K) and its analytic gradient dC_N/dr_i, as (value, grad).");
+
+  m.def(
+      "calculate_core_repulsion_grad",
+      [](py::array_t<double, py::array::c_style | py::array::forcecast> points, double rc) {
+        auto r = points.unchecked<2>();
+        require_points_n3(r.shape(0), r.shape(1), "calculate_core_repulsion_grad");
+        py::array_t<double> grad({r.shape(0), (py::ssize_t)3});
+        double* g = grad.mutable_data();
+        double value = 0.0;
+        {
+          py::gil_scoped_release release;
+          value = sst::trefoil_core_repulsion_grad(
+              &r(0, 0), static_cast<std::size_t>(r.shape(0)), rc, g);
+        }
+        return py::make_tuple(value, grad);
+      },
+      py::arg("points"),
+      py::arg("rc"),
+      "Core repulsion U_rep and its analytic gradient, as (value, grad).");
+
+  m.def(
+      "calculate_writhe_grad",
+      [](py::array_t<double, py::array::c_style | py::array::forcecast> points, double rc) {
+        auto r = points.unchecked<2>();
+        require_points_n3(r.shape(0), r.shape(1), "calculate_writhe_grad");
+        py::array_t<double> grad({r.shape(0), (py::ssize_t)3});
+        double* g = grad.mutable_data();
+        double value = 0.0;
+        {
+          py::gil_scoped_release release;
+          value = sst::trefoil_writhe_reg_grad(
+              &r(0, 0), static_cast<std::size_t>(r.shape(0)), rc, g);
+        }
+        return py::make_tuple(value, grad);
+      },
+      py::arg("points"),
+      py::arg("rc"),
+      "Regularized writhe and its analytic gradient, as (value, grad).");
+
+  m.def(
+      "calculate_length_grad",
+      [](py::array_t<double, py::array::c_style | py::array::forcecast> points) {
+        auto r = points.unchecked<2>();
+        require_points_n3(r.shape(0), r.shape(1), "calculate_length_grad");
+        py::array_t<double> grad({r.shape(0), (py::ssize_t)3});
+        double* g = grad.mutable_data();
+        double value = 0.0;
+        {
+          py::gil_scoped_release release;
+          value = sst::trefoil_polyline_length_grad(
+              &r(0, 0), static_cast<std::size_t>(r.shape(0)), g);
+        }
+        return py::make_tuple(value, grad);
+      },
+      py::arg("points"),
+      "Closed polyline length and its gradient (t_{i-1} - t_i), as (value, grad).");
+
+  m.def(
+      "calculate_closure_energies_grad",
+      [](py::array_t<double, py::array::c_style | py::array::forcecast> points, double rc) {
+        auto r = points.unchecked<2>();
+        require_points_n3(r.shape(0), r.shape(1), "calculate_closure_energies_grad");
+        const py::ssize_t n = r.shape(0);
+        py::array_t<double> g_neumann({n, (py::ssize_t)3});
+        py::array_t<double> g_repulsion({n, (py::ssize_t)3});
+        py::array_t<double> g_writhe({n, (py::ssize_t)3});
+        py::array_t<double> g_length({n, (py::ssize_t)3});
+        sst::TrefoilClosureGradients grads;
+        grads.neumann = g_neumann.mutable_data();
+        grads.core_repulsion = g_repulsion.mutable_data();
+        grads.writhe = g_writhe.mutable_data();
+        grads.length = g_length.mutable_data();
+        sst::TrefoilClosureEnergies energies;
+        {
+          py::gil_scoped_release release;
+          energies = sst::trefoil_closure_energies_grad(
+              &r(0, 0), static_cast<std::size_t>(n), rc, grads);
+        }
+        py::dict g;
+        g["neumann_self_energy"] = g_neumann;
+        g["core_repulsion"] = g_repulsion;
+        g["writhe_reg"] = g_writhe;
+        g["polyline_length"] = g_length;
+        return py::make_tuple(energies, g);
+      },
+      py::arg("points"),
+      py::arg("rc"),
+      "Fused closure energies plus analytic gradients of the Neumann, core repulsion, writhe and\n"
+      "length terms, as (TrefoilClosureEnergies, {term: grad (N,3)}).");
+
+  py::class_<sst::ClosureEnergyState>(m, "ClosureEnergyState", R"pbdoc(
+Closed curve with cached closure energies for Metropolis-style local moves.
+
+propose() prices moving one vertex (or a short cyclic window) in O(window * N)
+and returns the per-term deltas; commit() accepts, reject() discards.
+)pbdoc")
+      .def(py::init([](py::array_t<double, py::array::c_style | py::array::forcecast> points, double rc) {
+             auto r = points.unchecked<2>();
+             require_points_n3(r.shape(0), r.shape(1), "ClosureEnergyState");
+             py::gil_scoped_release release;
+             return sst::ClosureEnergyState(&r(0, 0), static_cast<std::size_t>(r.shape(0)), rc);
+           }),
+           py::arg("points"), py::arg("rc"))
+      .def_property_readonly("size", &sst::ClosureEnergyState::size)
+      .def_property_readonly("rc", &sst::ClosureEnergyState::rc)
+      .def_property_readonly("energies", &sst::ClosureEnergyState::energies)
+      .def_property_readonly("has_pending", &sst::ClosureEnergyState::has_pending)
+      .def("positions",
+           [](const sst::ClosureEnergyState& s) {
+             const auto& r = s.positions();
+             py::array_t<double> out({(py::ssize_t)s.size(), (py::ssize_t)3});
+             std::copy(r.begin(), r.end(), out.mutable_data());
+             return out;
+           },
+           "Committed vertices as an (N, 3) array (copy).")
+      .def("vertex_partials",
+           [](const sst::ClosureEnergyState& s) {
+             const auto& p = s.vertex_partials();
+             py::array_t<double> out({(py::ssize_t)s.size(), (py::ssize_t)3});
+             std::copy(p.begin(), p.end(), out.mutable_data());
+             return out;
+           },
+           "Per-vertex pair sums, columns [neumann, core_repulsion, writhe]; each column sums to 2*E.")
+      .def("propose",
+           [](sst::ClosureEnergyState& s, std::size_t start,
+              py::array_t<double, py::array::c_style | py::array::forcecast> new_positions) {
+             auto p = new_positions.unchecked<2>();
+             require_points_n3(p.shape(0), p.shape(1), "ClosureEnergyState.propose");
+             const double* data = p.shape(0) > 0 ? &p(0, 0) : nullptr;
+             py::gil_scoped_release release;
+             return s.propose(start, data, static_cast<std::size_t>(p.shape(0)));
+           },
+           py::arg("start"), py::arg("new_positions"),
+           "Tentatively move vertices start..start+k-1 (cyclic) to new_positions (k, 3); returns energy deltas.")
+      .def("propose_vertex",
+           [](sst::ClosureEnergyState& s, std::size_t index, const sst::Vec3& p) {
+             return s.propose_vertex(index, p[0], p[1], p[2]);
+           },
+           py::arg("index"), py::arg("position"), py::call_guard<py::gil_scoped_release>(),
+           "Tentatively move a single vertex; returns energy deltas.")
+      .def("commit", &sst::ClosureEnergyState::commit, "Accept the pending move.")
+      .def("reject", &sst::ClosureEnergyState::reject, "Discard the pending move.")
+      .def("resync", &sst::ClosureEnergyState::resync, py::call_guard<py::gil_scoped_release>(),
+           "Recompute energies and partial sums from scratch (clears accumulated drift).");
+
   m.def(
       "calculate_bs_cutoff_energy_scan",
       [](py::array_t<double, py::array::c_style | py::array::forcecast> points,
@@ -153,8 +372,12 @@ void bind_biot_savart(py::module_& m) {
         if (pp.shape(1) != 3 || tt.shape(1) != 3) {
           throw std::runtime_error("calculate_bs_cutoff_energy_scan: points/tangents must have shape (N, 3)");
         }
-        std::vector<double> out = sst::bs_cutoff_energy_scan(
-            &pp(0, 0), &tt(0, 0), &ds(0), static_cast<std::size_t>(n), &aa(0), static_cast<std::size_t>(m));
+        std::vector<double> out;
+        {
+          py::gil_scoped_release release;
+          out = sst::bs_cutoff_energy_scan(
+              &pp(0, 0), &tt(0, 0), &ds(0), static_cast<std::size_t>(n), &aa(0), static_cast<std::size_t>(m));
+        }
         py::array_t<double> numpy_out(m);
         auto e = numpy_out.mutable_unchecked<1>();
         for (py::ssize_t k = 0; k < m; ++k) {
@@ -185,6 +408,7 @@ void bind_biot_savart(py::module_& m) {
           throw std::runtime_error("calculate_bs_cutoff_energy: points/tangents must have shape (N, 3)");
         }
         double aone = a_cutoff;
+        py::gil_scoped_release release;
         std::vector<double> out = sst::bs_cutoff_energy_scan(
             &pp(0, 0), &tt(0, 0), &ds(0), static_cast<std::size_t>(n), &aone, 1);
         return out[0];
@@ -0,0 +1,72 @@
+#include "cell_list.h"
+#include <limits>
+
+namespace sst {
+
+bool CellList::build(const double* r, std::size_t n, double cell_size, std::size_t max_cells) {
+    cell_start_.clear();
+    indices_.clear();
+    dims_[0] = dims_[1] = dims_[2] = 0;
+    if (!(cell_size > 0.0) || !std::isfinite(cell_size) || n == 0) {
+        return false;
+    }
+
+    double hi[3];
+    for (int d = 0; d < 3; ++d) {
+        lo_[d] = std::numeric_limits<double>::infinity();
+        hi[d] = -std::numeric_limits<double>::infinity();
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        for (int d = 0; d < 3; ++d) {
+            const double v = r[i * 3 + d];
+            lo_[d] = std::min(lo_[d], v);
+            hi[d] = std::max(hi[d], v);
+        }
+    }
+    for (int d = 0; d < 3; ++d) {
+        if (!std::isfinite(lo_[d]) || !std::isfinite(hi[d])) {
+            return false;
+        }
+    }
+
+    if (max_cells == 0) {
+        max_cells = 2 * n + 27;
+    }
+    h_ = cell_size;
+    for (;;) {
+        double total = 1.0;
+        for (int d = 0; d < 3; ++d) {
+            total *= std::floor((hi[d] - lo_[d]) / h_) + 1.0;
+        }
+        if (total <= static_cast<double>(max_cells)) {
+            break;
+        }
+        // Larger cells stay correct (neighbours still within the 27 block).
+        h_ *= std::cbrt(total / static_cast<double>(max_cells)) * 1.0001;
+    }
+    for (int d = 0; d < 3; ++d) {
+        dims_[d] = static_cast<std::size_t>(std::floor((hi[d] - lo_[d]) / h_)) + 1;
+    }
+
+    // Counting sort by cell; ascending i keeps each cell's list sorted.
+    const std::size_t cells = num_cells();
+    std::vector<std::size_t> cell_of(n);
+    cell_start_.assign(cells + 1, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t c[3];
+        cell_coords(r + i * 3, c);
+        cell_of[i] = (c[0] * dims_[1] + c[1]) * dims_[2] + c[2];
+        ++cell_start_[cell_of[i] + 1];
+    }
+    for (std::size_t c = 0; c < cells; ++c) {
+        cell_start_[c + 1] += cell_start_[c];
+    }
+    indices_.resize(n);
+    std::vector<std::size_t> fill(cell_start_.begin(), cell_start_.end() - 1);
+    for (std::size_t i = 0; i < n; ++i) {
+        indices_[fill[cell_of[i]]++] = i;
+    }
+    return true;
+}
+
+}  // namespace sst
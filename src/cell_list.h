@@ -0,0 +1,78 @@
+// Uniform-grid cell list for fixed-radius neighbour queries on point clouds.
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace sst {
+
+/**
+ * Bins points (row-major xyz) into cubic cells whose edge is at least the
+ * query radius, so every neighbour within that radius lies in the 3x3x3
+ * block of cells around a point. Points are stored per cell in ascending
+ * index order (counting sort), which lets callers reproduce the summation
+ * order of an all-pairs loop exactly.
+ */
+class CellList {
+public:
+    // Returns false (and leaves the list empty) when cell_size is not positive
+    // or the bounding box is not finite; callers then fall back to all pairs.
+    // max_cells caps memory for sparse clouds by growing the cell edge
+    // (0 -> 2 * n + 27).
+    bool build(const double* r, std::size_t n, double cell_size, std::size_t max_cells = 0);
+
+    bool empty() const { return cell_start_.empty(); }
+    std::size_t num_cells() const { return dims_[0] * dims_[1] * dims_[2]; }
+    double cell_size() const { return h_; }
+
+    // fn(j) for every point in the 27 cells around position p (p need not be a stored point).
+    template <class Fn>
+    void for_each_candidate(const double* p, Fn&& fn) const {
+        std::size_t c[3];
+        cell_coords(p, c);
+        const std::size_t x0 = c[0] > 0 ? c[0] - 1 : 0, x1 = std::min(c[0] + 1, dims_[0] - 1);
+        const std::size_t y0 = c[1] > 0 ? c[1] - 1 : 0, y1 = std::min(c[1] + 1, dims_[1] - 1);
+        const std::size_t z0 = c[2] > 0 ? c[2] - 1 : 0, z1 = std::min(c[2] + 1, dims_[2] - 1);
+        for (std::size_t x = x0; x <= x1; ++x) {
+            for (std::size_t y = y0; y <= y1; ++y) {
+                for (std::size_t z = z0; z <= z1; ++z) {
+                    const std::size_t cell = (x * dims_[1] + y) * dims_[2] + z;
+                    for (std::size_t k = cell_start_[cell]; k < cell_start_[cell + 1]; ++k) {
+                        fn(indices_[k]);
+                    }
+                }
+            }
+        }
+    }
+
+    // Candidates j >= min_index around p, sorted ascending (out is cleared first).
+    void gather_sorted(const double* p, std::size_t min_index, std::vector<std::size_t>& out) const {
+        out.clear();
+        for_each_candidate(p, [&](std::size_t j) {
+            if (j >= min_index) out.push_back(j);
+        });
+        std::sort(out.begin(), out.end());
+    }
+
+private:
+    void cell_coords(const double* p, std::size_t* c) const {
+        for (int d = 0; d < 3; ++d) {
+            const double t = std::floor((p[d] - lo_[d]) / h_);
+            if (!(t > 0.0)) {
+                c[d] = 0;
+            } else {
+                c[d] = std::min(static_cast<std::size_t>(t), dims_[d] - 1);
+            }
+        }
+    }
+
+    double lo_[3] = {0.0, 0.0, 0.0};
+    double h_ = 0.0;
+    std::size_t dims_[3] = {0, 0, 0};
+    std::vector<std::size_t> cell_start_;  // CSR offsets, num_cells + 1
+    std::vector<std::size_t> indices_;     // point indices grouped by cell
+};
+
+}  // namespace sst
@@ -0,0 +1,209 @@
+#include "checkpoint.h"
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace sst {
+
+namespace {
+
+constexpr char kMagic[8] = {'S', 'S', 'T', 'S', 'N', 'A', 'P', '\0'};
+
+// Portable byte swaps: binding.gyp builds this file as C++20, which has no
+// std::byteswap.
+std::uint32_t bswap32(std::uint32_t v) {
+    return (v >> 24) | ((v >> 8) & 0x0000ff00u) | ((v << 8) & 0x00ff0000u) | (v << 24);
+}
+
+std::uint64_t bswap64(std::uint64_t v) {
+    return (std::uint64_t(bswap32(std::uint32_t(v))) << 32) | bswap32(std::uint32_t(v >> 32));
+}
+
+std::uint64_t to_le(std::uint64_t v) {
+    if constexpr (std::endian::native == std::endian::big) {
+        return bswap64(v);
+    }
+    return v;
+}
+
+std::uint32_t to_le32(std::uint32_t v) {
+    if constexpr (std::endian::native == std::endian::big) {
+        return bswap32(v);
+    }
+    return v;
+}
+
+void append_raw(std::string& out, const void* p, std::size_t n) {
+    out.append(static_cast<const char*>(p), n);
+}
+
+std::uint64_t fnv1a(const std::string& data) {
+    std::uint64_t h = 1469598103934665603ull;
+    for (unsigned char c : data) {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+} // namespace
+
+void SnapshotWriter::u64(std::uint64_t v) {
+    const std::uint64_t le = to_le(v);
+    append_raw(payload_, &le, sizeof(le));
+}
+
+void SnapshotWriter::f64(double v) {
+    u64(std::bit_cast<std::uint64_t>(v));
+}
+
+void SnapshotWriter::str(const std::string& s) {
+    u64(s.size());
+    payload_.append(s);
+}
+
+void SnapshotWriter::points(const std::vector<Vec3>& pts) {
+    u64(pts.size());
+    for (const Vec3& p : pts) {
+        f64(p[0]);
+        f64(p[1]);
+        f64(p[2]);
+    }
+}
+
+void SnapshotWriter::indices(const std::vector<std::size_t>& idx) {
+    u64(idx.size());
+    for (std::size_t i : idx) {
+        u64(i);
+    }
+}
+
+void SnapshotWriter::commit(const std::string& path) const {
+    std::string file;
+    file.reserve(payload_.size() + 32);
+    append_raw(file, kMagic, sizeof(kMagic));
+    const std::uint32_t version = to_le32(kSnapshotVersion);
+    const std::uint32_t kind = to_le32(static_cast<std::uint32_t>(kind_));
+    const std::uint64_t size = to_le(payload_.size());
+    const std::uint64_t checksum = to_le(fnv1a(payload_));
+    append_raw(file, &version, sizeof(version));
+    append_raw(file, &kind, sizeof(kind));
+    append_raw(file, &size, sizeof(size));
+    file.append(payload_);
+    append_raw(file, &checksum, sizeof(checksum));
+
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("Snapshot: cannot open '" + tmp + "' for writing");
+        }
+        out.write(file.data(), static_cast<std::streamsize>(file.size()));
+        out.flush();
+        if (!out) {
+            throw std::runtime_error("Snapshot: failed writing '" + tmp + "'");
+        }
+    }
+    std::remove(path.c_str());  // rename() does not replace existing files on Windows
+    if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+        throw std::runtime_error("Snapshot: cannot move '" + tmp + "' to '" + path + "'");
+    }
+}
+
+SnapshotReader::SnapshotReader(const std::string& path, SnapshotKind expected) : path_(path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Snapshot: cannot open '" + path + "'");
+    }
+    const std::string file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    constexpr std::size_t header = sizeof(kMagic) + 4 + 4 + 8;
+    if (file.size() < header + 8 || std::memcmp(file.data(), kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error("Snapshot: '" + path + "' is not a snapshot file");
+    }
+    std::uint32_t version, kind;
+    std::uint64_t size, checksum;
+    std::memcpy(&version, file.data() + 8, 4);
+    std::memcpy(&kind, file.data() + 12, 4);
+    std::memcpy(&size, file.data() + 16, 8);
+    version = to_le32(version);
+    kind = to_le32(kind);
+    size = to_le(size);
+    if (version != kSnapshotVersion) {
+        throw std::runtime_error("Snapshot: '" + path + "' has version " + std::to_string(version) +
+                                 ", this build reads version " + std::to_string(kSnapshotVersion));
+    }
+    if (kind != static_cast<std::uint32_t>(expected)) {
+        throw std::runtime_error("Snapshot: '" + path + "' holds a different solver (kind " +
+                                 std::to_string(kind) + ")");
+    }
+    if (file.size() != header + size + 8) {
+        throw std::runtime_error("Snapshot: '" + path + "' is truncated");
+    }
+    payload_ = file.substr(header, size);
+    std::memcpy(&checksum, file.data() + header + size, 8);
+    if (to_le(checksum) != fnv1a(payload_)) {
+        throw std::runtime_error("Snapshot: '" + path + "' failed its checksum");
+    }
+}
+
+const char* SnapshotReader::take(std::size_t bytes) {
+    if (bytes > payload_.size() - pos_) {
+        throw std::runtime_error("Snapshot: '" + path_ + "' ended early (corrupt or older layout)");
+    }
+    const char* p = payload_.data() + pos_;
+    pos_ += bytes;
+    return p;
+}
+
+std::uint64_t SnapshotReader::u64() {
+    std::uint64_t v;
+    std::memcpy(&v, take(sizeof(v)), sizeof(v));
+    return to_le(v);
+}
+
+double SnapshotReader::f64() {
+    return std::bit_cast<double>(u64());
+}
+
+std::string SnapshotReader::str() {
+    const auto n = static_cast<std::size_t>(u64());
+    const char* p = take(n);
+    return std::string(p, n);
+}
+
+std::vector<Vec3> SnapshotReader::points() {
+    const std::uint64_t n = u64();
+    if (n > (payload_.size() - pos_) / (3 * sizeof(double))) {
+        throw std::runtime_error("Snapshot: '" + path_ + "' ended early (corrupt or older layout)");
+    }
+    std::vector<Vec3> pts(static_cast<std::size_t>(n));
+    for (Vec3& p : pts) {
+        p[0] = f64();
+        p[1] = f64();
+        p[2] = f64();
+    }
+    return pts;
+}
+
+std::vector<std::size_t> SnapshotReader::indices() {
+    const std::uint64_t n = u64();
+    if (n > (payload_.size() - pos_) / sizeof(std::uint64_t)) {
+        throw std::runtime_error("Snapshot: '" + path_ + "' ended early (corrupt or older layout)");
+    }
+    std::vector<std::size_t> idx(static_cast<std::size_t>(n));
+    for (std::size_t& i : idx) {
+        i = static_cast<std::size_t>(u64());
+    }
+    return idx;
+}
+
+void SnapshotReader::finish() const {
+    if (pos_ != payload_.size()) {
+        throw std::runtime_error("Snapshot: '" + path_ + "' has trailing data (newer layout?)");
+    }
+}
+
+} // namespace sst
@@ -0,0 +1,78 @@
+#ifndef SWIRL_STRING_CORE_CHECKPOINT_H
+#define SWIRL_STRING_CORE_CHECKPOINT_H
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sst {
+
+using Vec3 = std::array<double, 3>;
+
+enum class SnapshotKind : std::uint32_t {
+    VortexKnotSystem = 1,
+    ParticleRelaxation = 2,
+};
+
+// Bumped whenever a solver's field order changes; readers reject other versions.
+constexpr std::uint32_t kSnapshotVersion = 2;
+
+/**
+ * @brief Builder for a solver snapshot file.
+ *
+ * Layout (little-endian): magic "SSTSNAP\0", u32 version, u32 kind,
+ * u64 payload bytes, payload, u64 FNV-1a checksum of the payload. Values
+ * are raw fixed-width fields written in the order the solver defines, so
+ * doubles round-trip bit-exactly. commit() writes to "<path>.tmp" and
+ * renames it over `path`, so a crash mid-write never leaves a torn file.
+ */
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(SnapshotKind kind) : kind_(kind) {}
+
+    void u64(std::uint64_t v);
+    void f64(double v);
+    void boolean(bool v) { u64(v ? 1u : 0u); }
+    void str(const std::string& s);
+    void points(const std::vector<Vec3>& pts);
+    void indices(const std::vector<std::size_t>& idx);
+
+    void commit(const std::string& path) const;
+
+private:
+    SnapshotKind kind_;
+    std::string payload_;
+};
+
+/**
+ * @brief Reader matching SnapshotWriter. The constructor checks magic,
+ * version, kind and checksum; every getter throws std::runtime_error on a
+ * truncated payload, and finish() rejects trailing data.
+ */
+class SnapshotReader {
+public:
+    SnapshotReader(const std::string& path, SnapshotKind expected);
+
+    std::uint64_t u64();
+    double f64();
+    bool boolean() { return u64() != 0; }
+    std::string str();
+    std::vector<Vec3> points();
+    std::vector<std::size_t> indices();
+
+    void finish() const;
+
+private:
+    const char* take(std::size_t bytes);
+
+    std::string path_;
+    std::string payload_;
+    std::size_t pos_ = 0;
+};
+
+} // namespace sst
+
+#endif // SWIRL_STRING_CORE_CHECKPOINT_H
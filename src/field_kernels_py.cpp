@@ -83,7 +83,10 @@ static py::tuple biot_savart_wire_grid_np(py::array X,
     for (py::ssize_t i = 0; i < wp.shape(0); ++i)
         W.push_back(Vec3{wp(i,0), wp(i,1), wp(i,2)});
 
-    FieldKernels::biot_savart_wire_grid(Xp, Yp, Zp, n_grid, W, current, Bxp, Byp, Bzp);
+    {
+        py::gil_scoped_release release;
+        FieldKernels::biot_savart_wire_grid(Xp, Yp, Zp, n_grid, W, current, Bxp, Byp, Bzp);
+    }
     return py::make_tuple(bx, by, bz);
 }
 
@@ -135,7 +138,10 @@ static py::tuple dipole_ring_field_grid_np(py::array X,
         mom.emplace_back(Vec3{Mu(i,0), Mu(i,1), Mu(i,2)});
     }
 
-    FieldKernels::dipole_ring_field_grid(Xp, Yp, Zp, n_grid, pos, mom, Bxp, Byp, Bzp);
+    {
+        py::gil_scoped_release release;
+        FieldKernels::dipole_ring_field_grid(Xp, Yp, Zp, n_grid, pos, mom, Bxp, Byp, Bzp);
+    }
     return py::make_tuple(bx, by, bz);
 }
 
@@ -238,11 +244,17 @@ void bind_field_kernels(py::module_ &m) {
                   Z[i] = pts[i][2];
               }
 
-              biot_savart_vector_potential(
-                  X.data(), Y.data(), Z.data(), N,
-                  wire, current,
-                  Ax.mutable_data(), Ay.mutable_data(), Az.mutable_data()
-              );
+              double* Axp = Ax.mutable_data();
+              double* Ayp = Ay.mutable_data();
+              double* Azp = Az.mutable_data();
+              {
+                  py::gil_scoped_release release;
+                  biot_savart_vector_potential(
+                      X.data(), Y.data(), Z.data(), N,
+                      wire, current,
+                      Axp, Ayp, Azp
+                  );
+              }
 
               return py::make_tuple(Ax, Ay, Az);
           },
@@ -21,25 +21,28 @@ void bind_field_ops(py::module_& m){
 
           auto wp = [](py::ssize_t a, py::ssize_t n){ return (a>=0)? (a%n) : ((a%n)+n)%n; };
 
-          for(py::ssize_t i=0;i<Nx;++i){
-            const py::ssize_t im = wp(i-1,Nx), ip = wp(i+1,Nx);
-            for(py::ssize_t j=0;j<Ny;++j){
-              const py::ssize_t jm = wp(j-1,Ny), jp = wp(j+1,Ny);
-              for(py::ssize_t k=0;k<Nz;++k){
-                const py::ssize_t km = wp(k-1,Nz), kp = wp(k+1,Nz);
-
-                const double dvz_dy = (V(i,jp,k,2) - V(i,jm,k,2)) / h2;
-                const double dvy_dz = (V(i,j,kp,1) - V(i,j,km,1)) / h2;
-
-                const double dvx_dz = (V(i,j,kp,0) - V(i,j,km,0)) / h2;
-                const double dvz_dx = (V(ip,j,k,2) - V(im,j,k,2)) / h2;
-
-                const double dvy_dx = (V(ip,j,k,1) - V(im,j,k,1)) / h2;
-                const double dvx_dy = (V(i,jp,k,0) - V(i,jm,k,0)) / h2;
-
-                C(i,j,k,0) = dvz_dy - dvy_dz;
-                C(i,j,k,1) = dvx_dz - dvz_dx;
-                C(i,j,k,2) = dvy_dx - dvx_dy;
+          {
+            py::gil_scoped_release release;
+            for(py::ssize_t i=0;i<Nx;++i){
+              const py::ssize_t im = wp(i-1,Nx), ip = wp(i+1,Nx);
+              for(py::ssize_t j=0;j<Ny;++j){
+                const py::ssize_t jm = wp(j-1,Ny), jp = wp(j+1,Ny);
+                for(py::ssize_t k=0;k<Nz;++k){
+                  const py::ssize_t km = wp(k-1,Nz), kp = wp(k+1,Nz);
+
+                  const double dvz_dy = (V(i,jp,k,2) - V(i,jm,k,2)) / h2;
+                  const double dvy_dz = (V(i,j,kp,1) - V(i,j,km,1)) / h2;
+
+                  const double dvx_dz = (V(i,j,kp,0) - V(i,j,km,0)) / h2;
+                  const double dvz_dx = (V(ip,j,k,2) - V(im,j,k,2)) / h2;
+
+                  const double dvy_dx = (V(ip,j,k,1) - V(im,j,k,1)) / h2;
+                  const double dvx_dy = (V(i,jp,k,0) - V(i,jm,k,0)) / h2;
+
+                  C(i,j,k,0) = dvz_dy - dvy_dz;
+                  C(i,j,k,1) = dvx_dz - dvz_dx;
+                  C(i,j,k,2) = dvy_dx - dvx_dy;
+                }
               }
             }
           }
@@ -0,0 +1,197 @@
+#include "filament_remesh.h"
+#include <algorithm>
+#include <cmath>
+
+namespace sst {
+
+namespace {
+
+// Periodic cubic spline through nodes x_i at chord parameters, stored as
+// node values plus second derivatives M_i (per coordinate).
+struct PeriodicSpline {
+    std::vector<Vec3> x;
+    std::vector<Vec3> m;
+    std::vector<double> h;  // h[i] = chord from x[i] to x[i+1 mod N]
+
+    std::size_t size() const { return x.size(); }
+
+    Vec3 eval(std::size_t i, double u) const {
+        const std::size_t j = (i + 1) % x.size();
+        const double hi = h[i];
+        const double v = hi - u;
+        Vec3 p;
+        for (int d = 0; d < 3; ++d) {
+            p[d] = (m[i][d] * v * v * v + m[j][d] * u * u * u) / (6.0 * hi) +
+                   (x[i][d] / hi - m[i][d] * hi / 6.0) * v +
+                   (x[j][d] / hi - m[j][d] * hi / 6.0) * u;
+        }
+        return p;
+    }
+
+    // Curvature at node i from the spline's first and second derivatives.
+    double node_curvature(std::size_t i) const {
+        const std::size_t j = (i + 1) % x.size();
+        const double hi = h[i];
+        Vec3 d1, d2;
+        for (int d = 0; d < 3; ++d) {
+            d1[d] = -m[i][d] * hi / 2.0 + (x[j][d] - x[i][d]) / hi - (m[j][d] - m[i][d]) * hi / 6.0;
+            d2[d] = m[i][d];
+        }
+        const Vec3 c{d1[1] * d2[2] - d1[2] * d2[1],
+                     d1[2] * d2[0] - d1[0] * d2[2],
+                     d1[0] * d2[1] - d1[1] * d2[0]};
+        const double s = std::sqrt(d1[0] * d1[0] + d1[1] * d1[1] + d1[2] * d1[2]);
+        if (!(s > 0.0)) return 0.0;
+        return std::sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]) / (s * s * s);
+    }
+};
+
+// Second derivatives of the periodic spline: cyclic tridiagonal system
+//   h_{i-1} M_{i-1} + 2 (h_{i-1} + h_i) M_i + h_i M_{i+1} = 6 (D_i - D_{i-1}),
+// solved by Sherman-Morrison on top of a Thomas sweep (diagonally dominant).
+void fit_periodic_spline(PeriodicSpline& s) {
+    const std::size_t n = s.size();
+    std::vector<double> a(n), b(n), c(n);
+    std::vector<Vec3> rhs(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t ip = (i + 1) % n;
+        const std::size_t im = (i + n - 1) % n;
+        a[i] = s.h[im];
+        c[i] = s.h[i];
+        b[i] = 2.0 * (s.h[im] + s.h[i]);
+        for (int d = 0; d < 3; ++d) {
+            rhs[i][d] = 6.0 * ((s.x[ip][d] - s.x[i][d]) / s.h[i] - (s.x[i][d] - s.x[im][d]) / s.h[im]);
+        }
+    }
+    const double alpha = c[n - 1];  // A[n-1][0]
+    const double beta = a[0];       // A[0][n-1]
+    const double gamma = -b[0];
+    b[0] -= gamma;
+    b[n - 1] -= alpha * beta / gamma;
+
+    // Thomas sweep on four right-hand sides: xyz and the correction vector u.
+    std::vector<double> cp(n);
+    std::vector<std::array<double, 4>> y(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] = {rhs[i][0], rhs[i][1], rhs[i][2], 0.0};
+    }
+    y[0][3] = gamma;
+    y[n - 1][3] = alpha;
+    cp[0] = c[0] / b[0];
+    for (int k = 0; k < 4; ++k) y[0][k] /= b[0];
+    for (std::size_t i = 1; i < n; ++i) {
+        const double den = b[i] - a[i] * cp[i - 1];
+        cp[i] = c[i] / den;
+        for (int k = 0; k < 4; ++k) y[i][k] = (y[i][k] - a[i] * y[i - 1][k]) / den;
+    }
+    for (std::size_t i = n - 1; i-- > 0;) {
+        for (int k = 0; k < 4; ++k) y[i][k] -= cp[i] * y[i + 1][k];
+    }
+
+    s.m.resize(n);
+    const double den = 1.0 + y[0][3] + beta * y[n - 1][3] / gamma;
+    for (int d = 0; d < 3; ++d) {
+        const double fact = (y[0][d] + beta * y[n - 1][d] / gamma) / den;
+        for (std::size_t i = 0; i < n; ++i) {
+            s.m[i][d] = y[i][d] - fact * y[i][3];
+        }
+    }
+}
+
+double distance(const Vec3& p, const Vec3& q) {
+    const double dx = q[0] - p[0], dy = q[1] - p[1], dz = q[2] - p[2];
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+}  // namespace
+
+RemeshReport remesh_closed_curve(const std::vector<Vec3>& in,
+                                 std::vector<Vec3>& out,
+                                 const RemeshOptions& options) {
+    RemeshReport report;
+    report.old_count = in.size();
+
+    double perimeter = 0.0;
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        perimeter += distance(in[i], in[(i + 1) % in.size()]);
+    }
+
+    PeriodicSpline s;
+    s.x.reserve(in.size());
+    const double tiny = 1e-12 * perimeter;
+    for (const Vec3& p : in) {
+        if (s.x.empty() || distance(s.x.back(), p) > tiny) {
+            s.x.push_back(p);
+        }
+    }
+    while (s.x.size() > 1 && distance(s.x.back(), s.x.front()) <= tiny) {
+        s.x.pop_back();
+    }
+    const std::size_t n = s.x.size();
+    if (n < 4 || !(perimeter > 0.0) || !std::isfinite(perimeter)) {
+        out = in;
+        report.new_count = out.size();
+        report.length = perimeter;
+        return report;
+    }
+
+    s.h.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        s.h[i] = distance(s.x[i], s.x[(i + 1) % n]);
+    }
+    fit_periodic_spline(s);
+
+    // The chord parameter doubles as the arclength estimate.
+    double length = 0.0;
+    for (std::size_t i = 0; i < n; ++i) length += s.h[i];
+    report.length = length;
+
+    const double h0 = options.target_spacing > 0.0 ? options.target_spacing
+                                                   : length / static_cast<double>(in.size());
+    const double h_min = options.min_spacing > 0.0 ? options.min_spacing : 0.25 * h0;
+    const double h_max = options.max_spacing > 0.0 ? options.max_spacing : h0;
+
+    // Monitor w = 1 / h(s) at the nodes; trapezoidal cumulative integral.
+    std::vector<double> w(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double kappa = s.node_curvature(i);
+        report.max_curvature = std::max(report.max_curvature, kappa);
+        double hi = h0;
+        if (options.max_turn_angle > 0.0 && kappa > 0.0) {
+            hi = std::min(hi, options.max_turn_angle / kappa);
+        }
+        hi = std::clamp(hi, std::min(h_min, h_max), h_max);
+        w[i] = 1.0 / hi;
+    }
+    std::vector<double> cum(n + 1, 0.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        cum[i + 1] = cum[i] + 0.5 * s.h[i] * (w[i] + w[(i + 1) % n]);
+    }
+    const double total = cum[n];
+
+    const std::size_t max_points = options.max_points > 0 ? options.max_points : 4 * in.size();
+    const std::size_t min_points = std::max<std::size_t>(options.min_points, 4);
+    std::size_t m = static_cast<std::size_t>(std::llround(total));
+    m = std::clamp(m, min_points, std::max(min_points, max_points));
+
+    // Place point k where the cumulative monitor reaches k * total / m. On a
+    // segment with linear w the integral is quadratic in u; solve it in the
+    // cancellation-free form u = 2r / (w0 + sqrt(w0^2 + 2 (w1 - w0) r / h)).
+    out.resize(m);
+    std::size_t seg = 0;
+    for (std::size_t k = 0; k < m; ++k) {
+        const double target = total * static_cast<double>(k) / static_cast<double>(m);
+        while (seg + 1 < n && cum[seg + 1] <= target) {
+            ++seg;
+        }
+        const double r = target - cum[seg];
+        const double w0 = w[seg], w1 = w[(seg + 1) % n], hs = s.h[seg];
+        const double disc = std::max(0.0, w0 * w0 + 2.0 * (w1 - w0) * r / hs);
+        const double u = std::clamp(2.0 * r / (w0 + std::sqrt(disc)), 0.0, hs);
+        out[k] = s.eval(seg, u);
+    }
+    report.new_count = m;
+    return report;
+}
+
+} // namespace sst
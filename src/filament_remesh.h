@@ -0,0 +1,50 @@
+#ifndef SWIRL_STRING_CORE_FILAMENT_REMESH_H
+#define SWIRL_STRING_CORE_FILAMENT_REMESH_H
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace sst {
+
+using Vec3 = std::array<double, 3>;
+
+/**
+ * Target spacing for closed-filament remeshing. The local spacing is
+ *   h(s) = clamp(min(h0, max_turn_angle / kappa(s)), min_spacing, max_spacing)
+ * so smooth stretches are sampled at h0 and bends keep the turning angle per
+ * segment below max_turn_angle. The point count follows from the integral of
+ * 1/h(s) and is then clamped to [min_points, max_points].
+ */
+struct RemeshOptions {
+    double target_spacing = 0.0;  // h0; 0 -> current mean spacing (length / N)
+    double max_turn_angle = 0.0;  // radians per segment; 0 -> pure arclength
+    double min_spacing = 0.0;     // 0 -> h0 / 4
+    double max_spacing = 0.0;     // 0 -> h0
+    std::size_t min_points = 8;
+    std::size_t max_points = 0;   // 0 -> 4 * current N
+};
+
+struct RemeshReport {
+    std::size_t old_count = 0;
+    std::size_t new_count = 0;
+    double length = 0.0;          // closed polyline length of the distinct input points
+    double max_curvature = 0.0;   // at the input nodes
+};
+
+/**
+ * @brief Redistribute the points of a closed polyline along its periodic cubic spline.
+ *
+ * The spline is parameterized by cumulative chord length (x[N] == x[0]
+ * implied), and new points equidistribute the monitor 1/h(s). The first
+ * output point coincides with in[0]. Coincident input points are dropped
+ * before fitting. Fewer than 4 distinct points are copied through unchanged.
+ */
+RemeshReport remesh_closed_curve(const std::vector<Vec3>& in,
+                                 std::vector<Vec3>& out,
+                                 const RemeshOptions& options = {});
+
+} // namespace sst
+
+#endif // SWIRL_STRING_CORE_FILAMENT_REMESH_H
@@ -0,0 +1,403 @@
+#include "filament_system.h"
+#include "cell_list.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace sst {
+
+FilamentSystem::FilamentSystem(double slack) : slack_(slack) {
+    if (!(slack >= 0.0)) {
+        throw std::invalid_argument("FilamentSystem: slack must be non-negative");
+    }
+}
+
+FilamentSystem::FilamentSystem(const std::vector<std::vector<Vec3>>& filaments,
+                               const std::vector<double>& circulations,
+                               double slack)
+    : FilamentSystem(slack) {
+    if (!circulations.empty() && circulations.size() != filaments.size()) {
+        throw std::invalid_argument("FilamentSystem: need one circulation per filament (or none)");
+    }
+    for (std::size_t f = 0; f < filaments.size(); ++f) {
+        add_filament(filaments[f], circulations.empty() ? 1.0 : circulations[f]);
+    }
+}
+
+std::size_t FilamentSystem::allocate_slot(std::size_t count) {
+    // Best fit among free slots first; otherwise append a new region.
+    std::size_t best = slots_.size();
+    for (std::size_t s = 0; s < slots_.size(); ++s) {
+        if (!slots_[s].active && slots_[s].capacity >= count &&
+            (best == slots_.size() || slots_[s].capacity < slots_[best].capacity)) {
+            best = s;
+        }
+    }
+    if (best == slots_.size()) {
+        Slot slot;
+        slot.start = x_.size();
+        slot.capacity = count + static_cast<std::size_t>(std::ceil(slack_ * static_cast<double>(count)));
+        x_.resize(slot.start + slot.capacity, 0.0);
+        y_.resize(slot.start + slot.capacity, 0.0);
+        z_.resize(slot.start + slot.capacity, 0.0);
+        slots_.push_back(slot);
+    }
+    slots_[best].active = true;
+    slots_[best].count = 0;
+    return best;
+}
+
+void FilamentSystem::write_slot(std::size_t id, const std::vector<Vec3>& points) {
+    Slot& slot = slots_[id];
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        x_[slot.start + i] = points[i][0];
+        y_[slot.start + i] = points[i][1];
+        z_[slot.start + i] = points[i][2];
+    }
+    slot.count = points.size();
+}
+
+std::size_t FilamentSystem::add_filament(const std::vector<Vec3>& points, double circulation) {
+    if (points.size() < 3) {
+        throw std::invalid_argument("FilamentSystem: a closed filament needs at least 3 points");
+    }
+    const std::size_t id = allocate_slot(points.size());
+    slots_[id].circulation = circulation;
+    write_slot(id, points);
+    return id;
+}
+
+void FilamentSystem::remove_filament(std::size_t id) {
+    if (!is_active(id)) {
+        throw std::out_of_range("FilamentSystem: no filament with id " + std::to_string(id));
+    }
+    slots_[id].active = false;
+    slots_[id].count = 0;
+}
+
+void FilamentSystem::set_filament(std::size_t id, const std::vector<Vec3>& points) {
+    if (!is_active(id)) {
+        throw std::out_of_range("FilamentSystem: no filament with id " + std::to_string(id));
+    }
+    if (points.size() < 3) {
+        throw std::invalid_argument("FilamentSystem: a closed filament needs at least 3 points");
+    }
+    if (points.size() > slots_[id].capacity) {
+        // Relocate only this filament; its old region becomes a free slot.
+        Slot old = slots_[id];
+        old.active = false;
+        old.count = 0;
+        const std::size_t fresh = allocate_slot(points.size());
+        slots_[id].start = slots_[fresh].start;
+        slots_[id].capacity = slots_[fresh].capacity;
+        slots_[fresh] = old;
+    }
+    write_slot(id, points);
+}
+
+std::size_t FilamentSystem::num_filaments() const {
+    return static_cast<std::size_t>(std::count_if(slots_.begin(), slots_.end(),
+                                                  [](const Slot& s) { return s.active; }));
+}
+
+std::size_t FilamentSystem::num_nodes() const {
+    std::size_t n = 0;
+    for (const Slot& s : slots_) {
+        if (s.active) n += s.count;
+    }
+    return n;
+}
+
+std::vector<std::size_t> FilamentSystem::filament_ids() const {
+    std::vector<std::size_t> ids;
+    for (std::size_t s = 0; s < slots_.size(); ++s) {
+        if (slots_[s].active) ids.push_back(s);
+    }
+    return ids;
+}
+
+std::vector<Vec3> FilamentSystem::filament_points(std::size_t id) const {
+    if (!is_active(id)) {
+        throw std::out_of_range("FilamentSystem: no filament with id " + std::to_string(id));
+    }
+    const Slot& slot = slots_[id];
+    std::vector<Vec3> pts(slot.count);
+    for (std::size_t i = 0; i < slot.count; ++i) {
+        pts[i] = {x_[slot.start + i], y_[slot.start + i], z_[slot.start + i]};
+    }
+    return pts;
+}
+
+std::vector<std::vector<Vec3>> FilamentSystem::filaments() const {
+    std::vector<std::vector<Vec3>> out;
+    for (std::size_t id : filament_ids()) {
+        out.push_back(filament_points(id));
+    }
+    return out;
+}
+
+double FilamentSystem::circulation(std::size_t id) const {
+    if (!is_active(id)) {
+        throw std::out_of_range("FilamentSystem: no filament with id " + std::to_string(id));
+    }
+    return slots_[id].circulation;
+}
+
+void FilamentSystem::set_circulation(std::size_t id, double gamma) {
+    if (!is_active(id)) {
+        throw std::out_of_range("FilamentSystem: no filament with id " + std::to_string(id));
+    }
+    slots_[id].circulation = gamma;
+    integrator_.invalidate();
+}
+
+void FilamentSystem::gather(std::vector<Vec3>& state) {
+    state.resize(num_nodes());
+    dense_offset_.assign(1, 0);
+    gamma_dense_.clear();
+    std::size_t k = 0;
+    for (const Slot& slot : slots_) {
+        if (!slot.active) continue;
+        for (std::size_t i = 0; i < slot.count; ++i, ++k) {
+            state[k] = {x_[slot.start + i], y_[slot.start + i], z_[slot.start + i]};
+        }
+        dense_offset_.push_back(k);
+        gamma_dense_.push_back(slot.circulation);
+    }
+}
+
+void FilamentSystem::scatter(const std::vector<Vec3>& state) {
+    std::size_t k = 0;
+    for (const Slot& slot : slots_) {
+        if (!slot.active) continue;
+        for (std::size_t i = 0; i < slot.count; ++i, ++k) {
+            x_[slot.start + i] = state[k][0];
+            y_[slot.start + i] = state[k][1];
+            z_[slot.start + i] = state[k][2];
+        }
+    }
+}
+
+void FilamentSystem::dense_velocities(const std::vector<Vec3>& state, std::vector<Vec3>& out) {
+    const std::size_t n = state.size();
+    out.resize(n);
+    px_.resize(n);
+    py_.resize(n);
+    pz_.resize(n);
+    tx_.resize(n);
+    ty_.resize(n);
+    tz_.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        px_[i] = state[i][0];
+        py_[i] = state[i][1];
+        pz_[i] = state[i][2];
+    }
+    // Circulation-weighted central-difference tangents, cyclic per filament.
+    for (std::size_t f = 0; f + 1 < dense_offset_.size(); ++f) {
+        const std::size_t lo = dense_offset_[f], hi = dense_offset_[f + 1], m = hi - lo;
+        const double w = 0.5 * gamma_dense_[f] / (4.0 * M_PI);
+        for (std::size_t i = 0; i < m; ++i) {
+            const std::size_t prev = lo + (i + m - 1) % m, next = lo + (i + 1) % m;
+            tx_[lo + i] = w * (px_[next] - px_[prev]);
+            ty_[lo + i] = w * (py_[next] - py_[prev]);
+            tz_[lo + i] = w * (pz_[next] - pz_[prev]);
+        }
+    }
+
+    // One pass over all sources for every target, whichever filament it is on.
+    const double* px = px_.data();
+    const double* py = py_.data();
+    const double* pz = pz_.data();
+    const double* tx = tx_.data();
+    const double* ty = ty_.data();
+    const double* tz = tz_.data();
+    auto rows = [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i) {
+            const double rx = px[i], ry = py[i], rz = pz[i];
+            double vx = 0.0, vy = 0.0, vz = 0.0;
+            for (std::size_t j = 0; j < n; ++j) {
+                const double dx = rx - px[j], dy = ry - py[j], dz = rz - pz[j];
+                const double d2 = dx * dx + dy * dy + dz * dz;
+                if (d2 > 1e-12) {
+                    const double inv = 1.0 / (d2 * std::sqrt(d2));
+                    vx += (ty[j] * dz - tz[j] * dy) * inv;
+                    vy += (tz[j] * dx - tx[j] * dz) * inv;
+                    vz += (tx[j] * dy - ty[j] * dx) * inv;
+                }
+            }
+            out[i] = {vx, vy, vz};
+        }
+    };
+    constexpr std::size_t kSerialNodes = 256;
+    if (n < kSerialNodes) {
+        rows(0, n);
+    } else {
+        parallel_for(0, n, 16, rows);
+    }
+}
+
+void FilamentSystem::induced_velocities(std::vector<Vec3>& out) {
+    std::vector<Vec3> state;
+    gather(state);
+    dense_velocities(state, out);
+}
+
+void FilamentSystem::set_integrator(const IntegratorOptions& options) {
+    integrator_.set_options(options);
+}
+
+void FilamentSystem::evolve(double dt, std::size_t steps) {
+    gather(state_);
+    if (state_.empty()) {
+        return;
+    }
+    integrator_.invalidate();
+    auto rhs = [this](const std::vector<Vec3>& X, std::vector<Vec3>& v) { dense_velocities(X, v); };
+    integrator_.integrate(rhs, state_, dt, steps, [this](double) {
+        if (!hook_ || ++steps_since_check_ < hook_every_) {
+            return;
+        }
+        steps_since_check_ = 0;
+        scatter(state_);
+        const std::vector<CloseApproach> approaches = find_close_approaches(hook_threshold_, hook_window_);
+        if (!approaches.empty() && hook_(*this, approaches)) {
+            gather(state_);
+            integrator_.invalidate();
+        }
+    });
+    scatter(state_);
+}
+
+std::vector<CloseApproach> FilamentSystem::find_close_approaches(double threshold,
+                                                                 std::size_t exclude_window) const {
+    std::vector<CloseApproach> found;
+    if (!(threshold > 0.0)) {
+        return found;
+    }
+    std::vector<double> r;
+    std::vector<std::size_t> owner, local;
+    for (std::size_t s = 0; s < slots_.size(); ++s) {
+        const Slot& slot = slots_[s];
+        if (!slot.active) continue;
+        for (std::size_t i = 0; i < slot.count; ++i) {
+            r.push_back(x_[slot.start + i]);
+            r.push_back(y_[slot.start + i]);
+            r.push_back(z_[slot.start + i]);
+            owner.push_back(s);
+            local.push_back(i);
+        }
+    }
+    const std::size_t n = owner.size();
+    const double t2 = threshold * threshold;
+    auto consider = [&](std::size_t i, std::size_t j) {
+        if (owner[i] == owner[j]) {
+            const std::size_t m = slots_[owner[i]].count;
+            std::size_t gap = local[i] > local[j] ? local[i] - local[j] : local[j] - local[i];
+            gap = std::min(gap, m - gap);
+            if (gap <= exclude_window) return;
+        }
+        const double dx = r[3 * i] - r[3 * j], dy = r[3 * i + 1] - r[3 * j + 1], dz = r[3 * i + 2] - r[3 * j + 2];
+        const double d2 = dx * dx + dy * dy + dz * dz;
+        if (d2 < t2) {
+            found.push_back({owner[i], local[i], owner[j], local[j], std::sqrt(d2)});
+        }
+    };
+
+    CellList cells;
+    if (n > 0 && cells.build(r.data(), n, threshold)) {
+        std::vector<std::size_t> cand;
+        for (std::size_t i = 0; i < n; ++i) {
+            cells.gather_sorted(&r[3 * i], i + 1, cand);
+            for (std::size_t j : cand) consider(i, j);
+        }
+    } else {
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = i + 1; j < n; ++j) consider(i, j);
+        }
+    }
+    std::stable_sort(found.begin(), found.end(),
+                     [](const CloseApproach& a, const CloseApproach& b) { return a.distance < b.distance; });
+    return found;
+}
+
+void FilamentSystem::set_reconnection_hook(ReconnectionHook hook, double threshold,
+                                           std::size_t check_every, std::size_t exclude_window) {
+    hook_ = std::move(hook);
+    hook_threshold_ = threshold;
+    hook_every_ = std::max<std::size_t>(check_every, 1);
+    hook_window_ = exclude_window;
+    steps_since_check_ = 0;
+}
+
+std::size_t FilamentSystem::reconnect(const CloseApproach& approach) {
+    const std::size_t fa = approach.filament_a, fb = approach.filament_b;
+    if (!is_active(fa) || !is_active(fb)) {
+        throw std::out_of_range("FilamentSystem::reconnect: inactive filament id");
+    }
+    if (approach.node_a >= slots_[fa].count || approach.node_b >= slots_[fb].count) {
+        throw std::out_of_range("FilamentSystem::reconnect: node index out of range");
+    }
+    integrator_.invalidate();
+
+    if (fa != fb) {
+        const double ga = slots_[fa].circulation, gb = slots_[fb].circulation;
+        if (std::fabs(ga - gb) > 1e-12 * std::max(std::fabs(ga), std::fabs(gb))) {
+            throw std::invalid_argument("FilamentSystem::reconnect: merging filaments needs equal circulation");
+        }
+        const std::vector<Vec3> a = filament_points(fa), b = filament_points(fb);
+        const std::size_t ia = approach.node_a, ib = approach.node_b;
+        std::vector<Vec3> merged;
+        merged.reserve(a.size() + b.size());
+        merged.insert(merged.end(), a.begin(), a.begin() + static_cast<std::ptrdiff_t>(ia + 1));
+        merged.insert(merged.end(), b.begin() + static_cast<std::ptrdiff_t>(ib + 1), b.end());
+        merged.insert(merged.end(), b.begin(), b.begin() + static_cast<std::ptrdiff_t>(ib + 1));
+        merged.insert(merged.end(), a.begin() + static_cast<std::ptrdiff_t>(ia + 1), a.end());
+        remove_filament(fb);
+        set_filament(fa, merged);
+        return fa;
+    }
+
+    const std::vector<Vec3> a = filament_points(fa);
+    const std::size_t i = std::min(approach.node_a, approach.node_b);
+    const std::size_t j = std::max(approach.node_a, approach.node_b);
+    std::vector<Vec3> first(a.begin(), a.begin() + static_cast<std::ptrdiff_t>(i + 1));
+    first.insert(first.end(), a.begin() + static_cast<std::ptrdiff_t>(j + 1), a.end());
+    std::vector<Vec3> second(a.begin() + static_cast<std::ptrdiff_t>(i + 1),
+                             a.begin() + static_cast<std::ptrdiff_t>(j + 1));
+    if (first.size() < 3 || second.size() < 3) {
+        throw std::invalid_argument("FilamentSystem::reconnect: split would leave a loop with fewer than 3 points");
+    }
+    const double gamma = slots_[fa].circulation;
+    set_filament(fa, first);
+    return add_filament(second, gamma);
+}
+
+void FilamentSystem::compact() {
+    std::vector<double> x, y, z;
+    std::vector<Slot> slots;
+    for (const Slot& old : slots_) {
+        if (!old.active) continue;
+        Slot slot = old;
+        slot.start = x.size();
+        slot.capacity = old.count + static_cast<std::size_t>(std::ceil(slack_ * static_cast<double>(old.count)));
+        x.resize(slot.start + slot.capacity, 0.0);
+        y.resize(slot.start + slot.capacity, 0.0);
+        z.resize(slot.start + slot.capacity, 0.0);
+        std::copy_n(x_.begin() + static_cast<std::ptrdiff_t>(old.start), old.count, x.begin() + static_cast<std::ptrdiff_t>(slot.start));
+        std::copy_n(y_.begin() + static_cast<std::ptrdiff_t>(old.start), old.count, y.begin() + static_cast<std::ptrdiff_t>(slot.start));
+        std::copy_n(z_.begin() + static_cast<std::ptrdiff_t>(old.start), old.count, z.begin() + static_cast<std::ptrdiff_t>(slot.start));
+        slots.push_back(slot);
+    }
+    x_.swap(x);
+    y_.swap(y);
+    z_.swap(z);
+    slots_.swap(slots);
+}
+
+} // namespace sst
@@ -0,0 +1,134 @@
+#ifndef SWIRL_STRING_CORE_FILAMENT_SYSTEM_H
+#define SWIRL_STRING_CORE_FILAMENT_SYSTEM_H
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "ode_integrators.h"
+
+namespace sst {
+
+using Vec3 = std::array<double, 3>;
+
+// Two nodes on (possibly the same) filament closer than the query threshold.
+struct CloseApproach {
+    std::size_t filament_a = 0;
+    std::size_t node_a = 0;
+    std::size_t filament_b = 0;
+    std::size_t node_b = 0;
+    double distance = 0.0;
+};
+
+/**
+ * @brief Many closed vortex filaments in one structure-of-arrays buffer.
+ *
+ * Node coordinates live in three flat arrays (x, y, z). Each filament owns
+ * a slot [start, start + capacity) of which the first `count` entries are
+ * used; slots carry spare capacity so topology surgery (reconnection,
+ * splitting, merging) rewrites at most the slots it touches. A filament's
+ * id is its slot index and stays valid until compact() or its removal.
+ *
+ * Velocities use the same discretisation as VortexKnotSystem (tangents
+ * (X[i+1] - X[i-1]) / 2 per closed filament, Biot–Savart point kernel
+ * skipping |r| <= 1e-6), weighted by each filament's circulation, and are
+ * evaluated for all filaments in one batched SoA kernel.
+ */
+class FilamentSystem {
+public:
+    // Return true when the system's topology or positions were changed.
+    using ReconnectionHook = std::function<bool(FilamentSystem&, const std::vector<CloseApproach>&)>;
+
+    struct Slot {
+        std::size_t start = 0;
+        std::size_t count = 0;
+        std::size_t capacity = 0;
+        double circulation = 1.0;
+        bool active = false;
+    };
+
+    // slack: extra capacity per slot as a fraction of its node count.
+    explicit FilamentSystem(double slack = 0.25);
+    FilamentSystem(const std::vector<std::vector<Vec3>>& filaments,
+                   const std::vector<double>& circulations = {},
+                   double slack = 0.25);
+
+    std::size_t add_filament(const std::vector<Vec3>& points, double circulation = 1.0);
+    void remove_filament(std::size_t id);
+    // Rewrite filament `id` in place (moves to a fresh slot only if it outgrows its capacity).
+    void set_filament(std::size_t id, const std::vector<Vec3>& points);
+
+    std::size_t num_filaments() const;
+    std::size_t num_nodes() const;
+    std::vector<std::size_t> filament_ids() const;
+    bool is_active(std::size_t id) const { return id < slots_.size() && slots_[id].active; }
+    std::vector<Vec3> filament_points(std::size_t id) const;
+    std::vector<std::vector<Vec3>> filaments() const;
+    double circulation(std::size_t id) const;
+    void set_circulation(std::size_t id, double gamma);
+
+    // Raw SoA access (slot layout; entries past a slot's count are unused).
+    const std::vector<double>& x() const { return x_; }
+    const std::vector<double>& y() const { return y_; }
+    const std::vector<double>& z() const { return z_; }
+    const std::vector<Slot>& slots() const { return slots_; }
+
+    // Induced velocity at every active node, filaments in id order.
+    void induced_velocities(std::vector<Vec3>& out);
+
+    void set_integrator(const IntegratorOptions& options);
+    const IntegratorOptions& get_integrator_options() const { return integrator_.options(); }
+    const IntegratorStats& get_integrator_stats() const { return integrator_.stats(); }
+    void evolve(double dt, std::size_t steps);
+
+    // Node pairs closer than threshold; pairs on the same filament within
+    // exclude_window (cyclic) index distance are ignored. Sorted by distance.
+    std::vector<CloseApproach> find_close_approaches(double threshold, std::size_t exclude_window = 4) const;
+
+    // Called from evolve() every check_every accepted steps with the current
+    // close approaches (only when there are any). A null hook disables it.
+    void set_reconnection_hook(ReconnectionHook hook, double threshold,
+                               std::size_t check_every = 1, std::size_t exclude_window = 4);
+
+    /**
+     * @brief Reconnect at a close approach by exchanging the edges
+     * (a, a+1) and (b, b+1) for (a, b+1) and (b, a+1).
+     *
+     * Two filaments merge into one (kept in filament_a's id; circulations
+     * must match); two nodes on one filament split it into two loops (the
+     * second gets a new id). Returns the id of the new or merged filament.
+     */
+    std::size_t reconnect(const CloseApproach& approach);
+
+    // Pack slots densely (ids are renumbered in ascending order); frees slack.
+    void compact();
+
+private:
+    std::size_t allocate_slot(std::size_t count);
+    void write_slot(std::size_t id, const std::vector<Vec3>& points);
+    void gather(std::vector<Vec3>& state);          // active nodes -> dense state
+    void scatter(const std::vector<Vec3>& state);   // dense state -> slots
+    void dense_velocities(const std::vector<Vec3>& state, std::vector<Vec3>& out);
+
+    double slack_;
+    std::vector<double> x_, y_, z_;
+    std::vector<Slot> slots_;
+
+    CurveIntegrator integrator_;
+    std::vector<Vec3> state_;
+    std::vector<std::size_t> dense_offset_;  // active filaments, id order
+    std::vector<double> gamma_dense_;
+    // Kernel scratch (SoA): source positions and circulation-weighted tangents.
+    std::vector<double> px_, py_, pz_, tx_, ty_, tz_;
+
+    ReconnectionHook hook_;
+    double hook_threshold_ = 0.0;
+    std::size_t hook_every_ = 1;
+    std::size_t hook_window_ = 4;
+    std::size_t steps_since_check_ = 0;
+};
+
+} // namespace sst
+
+#endif // SWIRL_STRING_CORE_FILAMENT_SYSTEM_H
@@ -0,0 +1,138 @@
+// src/filament_system_py.cpp
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/numpy.h>
+#include <pybind11/functional.h>
+#include "filament_system.h"
+#include "ab_initio_mass.h"
+#include "vec3_numpy.h"
+
+namespace py = pybind11;
+using namespace sst;
+
+namespace {
+
+py::array_t<double> points_to_numpy(const std::vector<Vec3>& pts) {
+    return sst::vec3_array(pts);
+}
+
+std::vector<Vec3> numpy_to_points(const sst::Vec3ArrayArg& arr) {
+    auto rows = sst::as_vec3_span(arr, "FilamentSystem: points");
+    return {rows.begin(), rows.end()};
+}
+
+}  // namespace
+
+void bind_filament_system(py::module_& m) {
+    py::class_<CloseApproach>(m, "CloseApproach",
+        R"pbdoc(Pair of filament nodes closer than a query threshold.)pbdoc")
+        .def(py::init<>())
+        .def_readwrite("filament_a", &CloseApproach::filament_a)
+        .def_readwrite("node_a", &CloseApproach::node_a)
+        .def_readwrite("filament_b", &CloseApproach::filament_b)
+        .def_readwrite("node_b", &CloseApproach::node_b)
+        .def_readwrite("distance", &CloseApproach::distance)
+        .def("__repr__", [](const CloseApproach& a) {
+            return "CloseApproach(" + std::to_string(a.filament_a) + ":" + std::to_string(a.node_a) + " <-> " +
+                   std::to_string(a.filament_b) + ":" + std::to_string(a.node_b) +
+                   ", distance=" + std::to_string(a.distance) + ")";
+        });
+
+    py::class_<FilamentSystem>(m, "FilamentSystem", R"pbdoc(
+Many closed vortex filaments in one SoA buffer with per-filament circulation.
+
+Filaments are addressed by integer ids (slot indices) that stay valid until
+compact(). Mutual induction of all filaments is evaluated in one batched
+Biot–Savart kernel; set_reconnection_hook() lets close approaches trigger
+reconnect() surgery during evolve() without rebuilding the system.
+)pbdoc")
+        .def(py::init<double>(), py::arg("slack") = 0.25)
+        .def(py::init([](const std::vector<py::array_t<double, py::array::c_style | py::array::forcecast>>& fils,
+                         const std::vector<double>& circulations, double slack) {
+                 std::vector<std::vector<Vec3>> pts;
+                 pts.reserve(fils.size());
+                 for (const auto& f : fils) pts.push_back(numpy_to_points(f));
+                 return FilamentSystem(pts, circulations, slack);
+             }),
+             py::arg("filaments"), py::arg("circulations") = std::vector<double>{}, py::arg("slack") = 0.25)
+        .def_static("from_particle_evaluator",
+             [](const ParticleEvaluator& pe, double circulation, double slack) {
+                 return FilamentSystem(pe.filaments, std::vector<double>(pe.filaments.size(), circulation), slack);
+             },
+             py::arg("evaluator"), py::arg("circulation") = 1.0, py::arg("slack") = 0.25,
+             R"pbdoc(Build a system from the components of a ParticleEvaluator (e.g. a multi-component link).)pbdoc")
+        .def("add_filament",
+             [](FilamentSystem& self, py::array_t<double, py::array::c_style | py::array::forcecast> pts,
+                double circulation) { return self.add_filament(numpy_to_points(pts), circulation); },
+             py::arg("points"), py::arg("circulation") = 1.0)
+        .def("remove_filament", &FilamentSystem::remove_filament, py::arg("id"))
+        .def("set_filament",
+             [](FilamentSystem& self, size_t id, py::array_t<double, py::array::c_style | py::array::forcecast> pts) {
+                 self.set_filament(id, numpy_to_points(pts));
+             },
+             py::arg("id"), py::arg("points"))
+        .def_property_readonly("num_filaments", &FilamentSystem::num_filaments)
+        .def_property_readonly("num_nodes", &FilamentSystem::num_nodes)
+        .def("filament_ids", &FilamentSystem::filament_ids)
+        .def("filament_points",
+             [](const FilamentSystem& self, size_t id) { return points_to_numpy(self.filament_points(id)); },
+             py::arg("id"))
+        .def("get_filaments", [](const FilamentSystem& self) {
+            py::list out;
+            for (const auto& f : self.filaments()) out.append(points_to_numpy(f));
+            return out;
+        })
+        .def("circulation", &FilamentSystem::circulation, py::arg("id"))
+        .def("set_circulation", &FilamentSystem::set_circulation, py::arg("id"), py::arg("gamma"))
+        .def("induced_velocities", [](FilamentSystem& self) {
+            std::vector<Vec3> v;
+            {
+                py::gil_scoped_release release;
+                self.induced_velocities(v);
+            }
+            return points_to_numpy(v);
+        }, R"pbdoc(Velocity at every node (N,3), filaments concatenated in id order.)pbdoc")
+        .def("set_integrator",
+             [](FilamentSystem& self, const std::string& scheme, double rtol, double atol,
+                double dt_min, double dt_max, double safety, std::size_t max_steps) {
+                 IntegratorOptions o;
+                 o.scheme = parse_integrator_scheme(scheme);
+                 o.rtol = rtol;
+                 o.atol = atol;
+                 o.dt_min = dt_min;
+                 o.dt_max = dt_max;
+                 o.safety = safety;
+                 o.max_steps = max_steps;
+                 self.set_integrator(o);
+             },
+             py::arg("scheme") = "euler", py::arg("rtol") = 1e-6, py::arg("atol") = 1e-9,
+             py::arg("dt_min") = 0.0, py::arg("dt_max") = 0.0, py::arg("safety") = 0.9,
+             py::arg("max_steps") = 1000000)
+        .def("get_integrator_stats", &FilamentSystem::get_integrator_stats)
+        .def("evolve", &FilamentSystem::evolve, py::arg("dt"), py::arg("steps"), py::call_guard<py::gil_scoped_release>(),
+             R"pbdoc(Advance every filament by steps*dt. Runs without the GIL (the reconnection hook
+reacquires it), so other Python threads proceed; do not drive one system from two threads.)pbdoc")
+        .def("find_close_approaches", &FilamentSystem::find_close_approaches,
+             py::arg("threshold"), py::arg("exclude_window") = 4, py::call_guard<py::gil_scoped_release>())
+        .def("set_reconnection_hook",
+             [](FilamentSystem& self, py::object hook, double threshold, size_t check_every, size_t exclude_window) {
+                 if (hook.is_none()) {
+                     self.set_reconnection_hook(nullptr, threshold, check_every, exclude_window);
+                     return;
+                 }
+                 self.set_reconnection_hook(
+                     [hook](FilamentSystem& sys, const std::vector<CloseApproach>& approaches) {
+                         // evolve() runs without the GIL; take it back for the Python call.
+                         py::gil_scoped_acquire gil;
+                         py::object changed = hook(py::cast(&sys, py::return_value_policy::reference), approaches);
+                         return !changed.is_none() && changed.cast<bool>();
+                     },
+                     threshold, check_every, exclude_window);
+             },
+             py::arg("hook"), py::arg("threshold"), py::arg("check_every") = 1, py::arg("exclude_window") = 4,
+             R"pbdoc(hook(system, approaches) -> bool is called during evolve() when nodes come closer than
+threshold; return True after changing the system (e.g. via reconnect()). Pass None to disable.)pbdoc")
+        .def("reconnect", &FilamentSystem::reconnect, py::arg("approach"),
+             R"pbdoc(Exchange edges at a close approach: merges two filaments or splits one. Returns the affected id.)pbdoc")
+        .def("compact", &FilamentSystem::compact);
+}
@@ -22,7 +22,7 @@ namespace sst {
 		return pressure;
 	}
 
-        std::vector<double> FluidDynamics::compute_velocity_magnitude(const std::vector<Vec3>& velocity) {
+        std::vector<double> FluidDynamics::compute_velocity_magnitude(std::span<const Vec3> velocity) {
 		std::vector<double> mag;
 		mag.reserve(velocity.size());
 		for (const auto& v : velocity) {
@@ -79,7 +79,7 @@ namespace sst {
                 return swirl_energy(rho, omega) > 0.5 * rho * Ce * Ce;
         }
 
-        double FluidDynamics::compute_helicity(const std::vector<Vec3>& velocity, const std::vector<Vec3>& vorticity, double dV) {
+        double FluidDynamics::compute_helicity(std::span<const Vec3> velocity, std::span<const Vec3> vorticity, double dV) {
                 double H = 0.0;
                 for (size_t i = 0; i < velocity.size(); ++i) {
                         H += velocity[i][0] * vorticity[i][0] +
@@ -224,7 +224,7 @@ namespace sst {
 		}
 
 		// Kinetic energy methods (from KineticEnergy)
-		double FluidDynamics::compute_kinetic_energy(const std::vector<Vec3>& velocity, double rho_ae) {
+		double FluidDynamics::compute_kinetic_energy(std::span<const Vec3> velocity, double rho_ae) {
 			double sum = 0.0;
 			for (const auto& v : velocity) {
 				sum += v[0]*v[0] + v[1]*v[1] + v[2]*v[2];
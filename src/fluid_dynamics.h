@@ -9,6 +9,7 @@
 #pragma once
 
 #include <array>
+#include <span>
 #include <vector>
 #include <cmath>
 
@@ -26,7 +27,7 @@ namespace sst {
 
                 // Compute velocity magnitude from vector field
                 static std::vector<double> compute_velocity_magnitude(
-                                const std::vector<Vec3>& velocity);
+                                std::span<const Vec3> velocity);
 
                 // Simple Euler step for particle advection
                 static void evolve_positions_euler(
@@ -48,7 +49,7 @@ namespace sst {
 
 			static bool kairos_energy_trigger(double rho, double omega, double Ce);
 
-			static double compute_helicity(const std::vector<Vec3> &velocity, const std::vector<Vec3> &vorticity, double dV);
+			static double compute_helicity(std::span<const Vec3> velocity, std::span<const Vec3> vorticity, double dV);
 
 			static double potential_vorticity(double fa, double zeta_r, double h);
 
@@ -78,7 +79,7 @@ namespace sst {
 			static double bernoulli_pressure_potential(double velocity_squared, double V);
 
 			// Kinetic energy methods (from KineticEnergy)
-			static double compute_kinetic_energy(const std::vector<Vec3>& velocity, double rho_ae);
+			static double compute_kinetic_energy(std::span<const Vec3> velocity, double rho_ae);
 
 			// Fluid rotation methods (from FluidRotation)
 			static double rossby_number(double U, double omega, double d);
@@ -96,7 +97,7 @@ namespace sst {
         }
 
         inline std::vector<double> compute_velocity_magnitude(
-                        const std::vector<Vec3>& velocity) {
+                        std::span<const Vec3> velocity) {
                 return FluidDynamics::compute_velocity_magnitude(velocity);
         }
 
@@ -2,6 +2,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include "fluid_dynamics.h"
+#include "vec3_numpy.h"
 
 namespace py = pybind11;
 
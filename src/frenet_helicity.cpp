@@ -4,8 +4,11 @@
 
 // src/frenet_helicity.cpp
 #include "frenet_helicity.h"
+#include "biot_savart.h"
+#include "ode_integrators.h"
 #include <cmath>
 #include <numeric>
+#include <stdexcept>
 
 namespace sst {
 
@@ -44,6 +47,125 @@ namespace sst {
 		T[n-1] = T[n-2]; N[n-1] = N[n-2]; B[n-1] = B[n-2];
 	}
 
+// 1b. Closed-curve Bishop frames with holonomy correction, curvature and torsion
+        void FrenetHelicity::compute_bishop_frames(const std::vector<Vec3>& X,
+                                                           BishopFrames& frames) {
+		const size_t n = X.size();
+		if (n < 3) {
+			throw std::invalid_argument("compute_bishop_frames: a closed curve needs at least 3 nodes");
+		}
+		frames.T.resize(n);
+		frames.U.resize(n);
+		frames.V.resize(n);
+		frames.curvature.resize(n);
+		frames.torsion.resize(n);
+		frames.arclength.resize(n);
+		std::vector<Vec3>& T = frames.T;
+		std::vector<Vec3>& U = frames.U;
+		std::vector<Vec3>& V = frames.V;
+		std::vector<double>& kappa = frames.curvature;
+		std::vector<double>& tau = frames.torsion;
+		std::vector<double>& s = frames.arclength;
+
+		// Pass 1 (independent per node): tangent, curvature and the Frenet
+		// normal direction kappa*N = kappa*b x T, parked in V until pass 3.
+		// tau temporarily holds the length of the edge leaving node i.
+		for (size_t i = 0; i < n; ++i) {
+			const Vec3& prev = X[i == 0 ? n - 1 : i - 1];
+			const Vec3& next = X[i + 1 == n ? 0 : i + 1];
+			const Vec3 em = diff(X[i], prev);
+			const Vec3 ep = diff(next, X[i]);
+			const Vec3 chord = diff(next, prev);
+			const double lm = norm(em), lp = norm(ep), lc = norm(chord);
+			const double den = lm * lp * lc;
+			const double k = den > 0.0 ? 2.0 / den : 0.0;
+			const double inv = lc > 0.0 ? 1.0 / lc : 0.0;
+			const Vec3 c = cross(em, ep);
+			T[i] = {chord[0] * inv, chord[1] * inv, chord[2] * inv};
+			V[i] = cross(Vec3{k * c[0], k * c[1], k * c[2]}, T[i]);
+			kappa[i] = k * norm(c);
+			tau[i] = lp;
+		}
+		double length = 0.0;
+		for (size_t i = 0; i < n; ++i) {
+			s[i] = length;
+			length += tau[i];
+		}
+		frames.length = length;
+
+		// Pass 2 (sequential): transport U by double reflection (Wang et al. 2008)
+		// from each node to the next, ending back at node 0 to read the holonomy.
+		{
+			const Vec3& t0 = T[0];
+			const Vec3 ref = std::abs(t0[0]) < 0.9 ? Vec3{1.0, 0.0, 0.0} : Vec3{0.0, 1.0, 0.0};
+			const double r = dot(ref, t0);
+			U[0] = normalize(Vec3{ref[0] - r * t0[0], ref[1] - r * t0[1], ref[2] - r * t0[2]});
+		}
+		// Both reflections are isometries, so u stays unit and normal to the
+		// tangent without renormalizing; only the reflection factors divide.
+		Vec3 u = U[0];
+		for (size_t i = 0; i < n; ++i) {
+			const size_t j = i + 1 == n ? 0 : i + 1;
+			const Vec3 v1 = diff(X[j], X[i]);
+			const double c1 = dot(v1, v1);
+			const double r1 = c1 > 0.0 ? 2.0 / c1 : 0.0;
+			const double ft = r1 * dot(v1, T[i]);
+			const Vec3 v2 = {T[j][0] - T[i][0] + ft * v1[0], T[j][1] - T[i][1] + ft * v1[1],
+			                 T[j][2] - T[i][2] + ft * v1[2]};
+			const double c2 = dot(v2, v2);
+			const double r2 = c2 > 0.0 ? 2.0 / c2 : 0.0;
+			const double fu = r1 * dot(v1, u);
+			const Vec3 uL = {u[0] - fu * v1[0], u[1] - fu * v1[1], u[2] - fu * v1[2]};
+			const double f = r2 * dot(v2, uL);
+			u = {uL[0] - f * v2[0], uL[1] - f * v2[1], uL[2] - f * v2[2]};
+			if (j != 0) {
+				U[j] = u;
+			}
+		}
+		const Vec3 v0 = cross(T[0], U[0]);
+		const double holonomy = std::atan2(dot(u, v0), dot(u, U[0]));
+		frames.holonomy = holonomy;
+
+		// Pass 3 (independent per node): undo the holonomy by rotating frame i
+		// by -holonomy * s_i / L about T_i, then take the Frenet normal's angle
+		// in that frame. tau now holds the angle, kStraight where there is no
+		// Frenet normal (a sentinel rather than NaN: this file builds with -ffast-math).
+		constexpr double kStraight = 8.0;  // outside atan2's range
+		const double twist = length > 0.0 ? holonomy / length : 0.0;
+		auto edge = [&](size_t i) { return (i + 1 < n ? s[i + 1] : length) - s[i]; };
+		for (size_t i = 0; i < n; ++i) {
+			const Vec3 ui = U[i];
+			const Vec3 vi = cross(T[i], ui);
+			const Vec3 normal = V[i];
+			const double a = -twist * s[i];
+			const double ca = std::cos(a), sa = std::sin(a);
+			U[i] = {ca * ui[0] + sa * vi[0], ca * ui[1] + sa * vi[1], ca * ui[2] + sa * vi[2]};
+			V[i] = {ca * vi[0] - sa * ui[0], ca * vi[1] - sa * ui[1], ca * vi[2] - sa * ui[2]};
+			const double turning = kappa[i] * 0.5 * (edge(i == 0 ? n - 1 : i - 1) + edge(i));
+			tau[i] = turning > 1e-9 ? std::atan2(dot(normal, V[i]), dot(normal, U[i]))
+			                        : kStraight;
+		}
+
+		// Pass 4: torsion is the angle's rate along the untwisted (Bishop) frame;
+		// the correction in pass 3 added `twist` to the measured rate. Angles
+		// are read one node ahead of the overwrite, so no scratch is needed.
+		const double angle_first = tau[0];
+		double angle_prev = tau[n - 1];
+		for (size_t i = 0; i < n; ++i) {
+			const double angle_here = tau[i];
+			const double angle_next = i + 1 < n ? tau[i + 1] : angle_first;
+			const double span = edge(i == 0 ? n - 1 : i - 1) + edge(i);
+			if (angle_prev >= kStraight || angle_next >= kStraight || !(span > 0.0)) {
+				tau[i] = 0.0;
+			} else {
+				double d = angle_next - angle_prev;
+				d += d > M_PI ? -2.0 * M_PI : (d < -M_PI ? 2.0 * M_PI : 0.0);
+				tau[i] = d / span - twist;
+			}
+			angle_prev = angle_here;
+		}
+	}
+
 // 2. Compute curvature and torsion
         void FrenetHelicity::compute_curvature_torsion(const std::vector<Vec3>& T,
                                                                    const std::vector<Vec3>& N,
@@ -65,6 +187,34 @@ namespace sst {
 		torsion[n-1] = torsion[n-2];
 	}
 
+// 2b. Discrete curvature-binormal: kappa*b = 2 (e- x e+) / (|e-| |e+| |e- + e+|)
+        void FrenetHelicity::compute_curvature_binormal(const std::vector<Vec3>& X,
+                                                                   bool closed,
+                                                                   std::vector<Vec3>& kb) {
+		size_t n = X.size();
+		kb.assign(n, Vec3{0.0, 0.0, 0.0});
+		if (n < 3) {
+			return;
+		}
+		const size_t first = closed ? 0 : 1;
+		const size_t last = closed ? n : n - 1;
+		for (size_t i = first; i < last; ++i) {
+			const Vec3& prev = X[(i + n - 1) % n];
+			const Vec3& next = X[(i + 1) % n];
+			Vec3 em = diff(X[i], prev);
+			Vec3 ep = diff(next, X[i]);
+			Vec3 c = cross(em, ep);
+			double den = norm(em) * norm(ep) * norm(diff(next, prev));
+			if (den > 0.0) {
+				kb[i] = {2.0 * c[0] / den, 2.0 * c[1] / den, 2.0 * c[2] / den};
+			}
+		}
+		if (!closed) {
+			kb[0] = kb[1];
+			kb[n-1] = kb[n-2];
+		}
+	}
+
 // 3. Compute helicity
         float FrenetHelicity::compute_helicity(const std::vector<Vec3>& velocity,
                                                    const std::vector<Vec3>& vorticity) {
@@ -77,18 +227,34 @@ namespace sst {
 		}
 		return sum / static_cast<float>(n);
 	}
-// RK4 integration of position updates
+// RK4 integration of position updates: dX/dt = Biot–Savart velocity of the
+// closed filament, O(N^2) per stage. Every stage rebuilds the segment vectors
+// dl_i = (X_{i+1} - X_{i-1}) / 2 from its own positions (the VortexKnotSystem
+// convention), so all four stage velocities share one scale. `tangents` only
+// has to match positions in length; it no longer enters the step.
         std::vector<Vec3> FrenetHelicity::rk4_integrate(const std::vector<Vec3>& positions,
 									const std::vector<Vec3>& tangents,
 									double dt,
 									double gamma) {
-		std::vector<Vec3> result = positions;
-		size_t n = positions.size();
-		for (size_t i = 0; i < n; ++i) {
-			result[i][0] += dt * gamma * tangents[i][0];
-			result[i][1] += dt * gamma * tangents[i][1];
-			result[i][2] += dt * gamma * tangents[i][2];
+		if (tangents.size() != positions.size()) {
+			throw std::invalid_argument("rk4_integrate: tangents must have one entry per position");
 		}
+		std::vector<Vec3> result = positions;
+		std::vector<Vec3> dl;
+		auto rhs = [&](const std::vector<Vec3>& X, std::vector<Vec3>& v) {
+			const size_t n = X.size();
+			dl.resize(n);
+			for (size_t i = 0; i < n; ++i) {
+				const Vec3& prev = X[(i + n - 1) % n];
+				const Vec3& next = X[(i + 1) % n];
+				dl[i] = {0.5 * (next[0] - prev[0]), 0.5 * (next[1] - prev[1]), 0.5 * (next[2] - prev[2])};
+			}
+			BiotSavart::self_velocities(X, dl, gamma, v);
+		};
+		IntegratorOptions options;
+		options.scheme = IntegratorScheme::RK4;
+		CurveIntegrator integrator(options);
+		integrator.integrate(rhs, result, dt, 1);
 		return result;
 	}
 
@@ -9,6 +9,20 @@ namespace sst {
 
         using Vec3 = std::array<double, 3>;
 
+        // Per-node frames of a closed polyline from compute_bishop_frames().
+        // Buffers are resized in place, so reusing one instance across calls
+        // does not allocate once it has seen the largest curve.
+        struct BishopFrames {
+                std::vector<Vec3> T;             // unit tangent, central difference
+                std::vector<Vec3> U;             // parallel-transport normal
+                std::vector<Vec3> V;             // T x U
+                std::vector<double> curvature;   // per unit arclength, circle through neighbours
+                std::vector<double> torsion;     // Frenet torsion, 0 where the curvature vanishes
+                std::vector<double> arclength;   // s_i measured from node 0
+                double length = 0.0;             // total length including the closing edge
+                double holonomy = 0.0;           // transport twist around the loop (rad), removed
+        };
+
         class FrenetHelicity {
         public:
                 // Compute normalized tangent, normal, binormal vectors
@@ -17,24 +31,44 @@ namespace sst {
                                                            std::vector<Vec3>& N,
                                                            std::vector<Vec3>& B);
 
+                // Closed-curve frames in one pass: tangents, rotation-minimizing
+                // (Bishop) normals transported node to node by double reflection,
+                // with the loop holonomy spread uniformly in arclength so U, V are
+                // periodic. Curvature uses the circle through the neighbours and
+                // torsion is the arclength derivative of the Frenet normal's angle
+                // in the (U, V) plane, so no frame is differenced twice and nothing
+                // is normalized where the curve is straight. Needs >= 3 nodes.
+                static void compute_bishop_frames(const std::vector<Vec3>& X,
+                                                           BishopFrames& frames);
+
                 // Compute local curvature and torsion
                 static void compute_curvature_torsion(const std::vector<Vec3>& T,
                                                                    const std::vector<Vec3>& N,
                                                                    std::vector<double>& curvature,
                                                                    std::vector<double>& torsion);
 
+                // Curvature-binormal vector kappa*b per node from the circle through
+                // (X[i-1], X[i], X[i+1]); per unit arclength, unlike the index
+                // differences above. Open curves copy the end values inward.
+                static void compute_curvature_binormal(const std::vector<Vec3>& X,
+                                                                   bool closed,
+                                                                   std::vector<Vec3>& kb);
+
                 // Compute helicity H = ∫ v · ω dV for filament
                 // Takes induced velocity and tangent vectors
                 static float compute_helicity(const std::vector<Vec3>& velocity,
                                                    const std::vector<Vec3>& vorticity);
 
-                // RK4 integrator for centerline evolution
+                // One RK4 step of the closed filament under its own Biot–Savart
+                // velocity (O(N^2) per stage; segment vectors are rebuilt from the
+                // stage positions). Behaviour change: this used to be the O(N)
+                // advection X + dt*gamma*T; `tangents` is now only length-checked.
                 static std::vector<Vec3> rk4_integrate(const std::vector<Vec3>& positions,
                                                                         const std::vector<Vec3>& tangents,
                                                                         double dt,
                                                                         double gamma = 1.0);
 
-                // Direct evolution step using Biot–Savart
+                // Direct evolution step using Biot–Savart (same step as rk4_integrate)
                 static std::vector<Vec3> evolve_vortex_knot(const std::vector<Vec3>& positions,
                                                                         const std::vector<Vec3>& tangents,
                                                                         double dt,
@@ -48,6 +82,11 @@ namespace sst {
                 FrenetHelicity::compute_frenet_frames(X, T, N, B);
         }
 
+        inline void compute_bishop_frames(const std::vector<Vec3>& X,
+                                                           BishopFrames& frames) {
+                FrenetHelicity::compute_bishop_frames(X, frames);
+        }
+
         inline void compute_curvature_torsion(const std::vector<Vec3>& T,
                                                                    const std::vector<Vec3>& N,
                                                                    std::vector<double>& curvature,
@@ -55,6 +94,12 @@ namespace sst {
                 FrenetHelicity::compute_curvature_torsion(T, N, curvature, torsion);
         }
 
+        inline void compute_curvature_binormal(const std::vector<Vec3>& X,
+                                                                   bool closed,
+                                                                   std::vector<Vec3>& kb) {
+                FrenetHelicity::compute_curvature_binormal(X, closed, kb);
+        }
+
         inline float compute_helicity(const std::vector<Vec3>& velocity,
                                                    const std::vector<Vec3>& vorticity) {
                 return FrenetHelicity::compute_helicity(velocity, vorticity);
@@ -10,17 +10,40 @@ void bind_frenet_helicity(py::module_& m) {
                 std::vector<sst::Vec3> T, N, B;
                 sst::FrenetHelicity::compute_frenet_frames(X, T, N, B);
 		return std::make_tuple(T, N, B);
-	}, R"pbdoc(
+	}, py::call_guard<py::gil_scoped_release>(), R"pbdoc(
         Compute Frenet frames (T, N, B) from 3D filament points.
         Returns: (T, N, B) as tuple of lists.
     )pbdoc");
 
+	m.def("compute_bishop_frames", [](const std::vector<sst::Vec3>& X) {
+		sst::BishopFrames f;
+		{
+			py::gil_scoped_release release;
+			sst::FrenetHelicity::compute_bishop_frames(X, f);
+		}
+		py::dict d;
+		d["T"] = f.T;
+		d["U"] = f.U;
+		d["V"] = f.V;
+		d["curvature"] = f.curvature;
+		d["torsion"] = f.torsion;
+		d["arclength"] = f.arclength;
+		d["length"] = f.length;
+		d["holonomy"] = f.holonomy;
+		return d;
+	}, py::arg("X"), R"pbdoc(
+        Parallel-transport (Bishop) frames of a closed curve, with curvature and torsion.
+        U is transported without twist and the loop holonomy is spread uniformly in
+        arclength, so (T, U, V) is periodic and well defined on straight segments.
+        Returns: dict with T, U, V, curvature, torsion, arclength (per node), length, holonomy.
+    )pbdoc");
+
 	m.def("compute_curvature_torsion", [](const std::vector<sst::Vec3>& T,
 										  const std::vector<sst::Vec3>& N) {
 		std::vector<double> curvature, torsion;
                 sst::FrenetHelicity::compute_curvature_torsion(T, N, curvature, torsion);
 		return std::make_tuple(curvature, torsion);
-	}, R"pbdoc(
+	}, py::call_guard<py::gil_scoped_release>(), R"pbdoc(
 		Compute curvature and torsion from tangent and normal vectors.
 		Returns: (curvature, torsion) as tuple of lists.
 	)pbdoc");
@@ -28,15 +51,22 @@ void bind_frenet_helicity(py::module_& m) {
 	m.def("compute_helicity", [](const std::vector<sst::Vec3>& velocity,
 								 const std::vector<sst::Vec3>& vorticity) {
                 return sst::FrenetHelicity::compute_helicity(velocity, vorticity);
-	}, R"pbdoc(
+	}, py::call_guard<py::gil_scoped_release>(), R"pbdoc(
         Compute helicity H = ∫ v · ω dV.
     )pbdoc");
 
-        m.def("evolve_vortex_knot", &sst::FrenetHelicity::evolve_vortex_knot, R"pbdoc(
-        Evolve vortex knot filaments using Biot–Savart dynamics.
+        m.def("evolve_vortex_knot", &sst::FrenetHelicity::evolve_vortex_knot, py::call_guard<py::gil_scoped_release>(), R"pbdoc(
+        Evolve vortex knot filaments using Biot–Savart dynamics (one rk4_integrate step).
     )pbdoc");
 
-        m.def("rk4_integrate", &sst::FrenetHelicity::rk4_integrate, R"pbdoc(
-        Runge-Kutta 4th order time integrator for vortex elements.
+        m.def("rk4_integrate", &sst::FrenetHelicity::rk4_integrate, py::call_guard<py::gil_scoped_release>(), R"pbdoc(
+        One RK4 step of a closed filament moving with its own Biot–Savart velocity.
+
+        Each stage rebuilds the segment vectors (X[i+1] - X[i-1]) / 2 from its
+        positions; the cost is O(N^2) per stage.
+
+        Behaviour change: this used to return the O(N) advection
+        positions + dt * gamma * tangents. `tangents` must still match
+        `positions` in length but no longer affects the result.
     )pbdoc");
 }
@@ -9,7 +9,7 @@ void bind_hyperbolic_volume(py::module_& m){
 #ifdef SST_ENABLE_HYPVOL
   m.def("hyperbolic_volume_from_pd",
         &sst::hyperbolic_volume_from_pd,
-        py::arg("pd"),
+        py::arg("pd"), py::call_guard<py::gil_scoped_release>(),
         R"pbdoc(Hyperbolic volume from PD (native).)pbdoc");
 #else
   m.def("hyperbolic_volume_from_pd",
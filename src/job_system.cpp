@@ -0,0 +1,178 @@
+#include "job_system.h"
+#include <algorithm>
+#include <chrono>
+
+namespace sst {
+
+    const char* job_status_name(JobStatus status) {
+        switch (status) {
+            case JobStatus::Pending:   return "pending";
+            case JobStatus::Running:   return "running";
+            case JobStatus::Finished:  return "finished";
+            case JobStatus::Failed:    return "failed";
+            case JobStatus::Cancelled: return "cancelled";
+        }
+        return "unknown";
+    }
+
+    Job::Job(std::string name, Work work)
+        : name_(std::move(name)), work_(std::move(work)) {}
+
+    JobStatus Job::status() const {
+        std::lock_guard<std::mutex> lk(m_);
+        return status_;
+    }
+
+    bool Job::done() const {
+        const JobStatus s = status();
+        return s != JobStatus::Pending && s != JobStatus::Running;
+    }
+
+    void Job::set_progress(double fraction) {
+        progress_.store(std::clamp(fraction, 0.0, 1.0), std::memory_order_relaxed);
+    }
+
+    bool Job::cancel() {
+        std::vector<std::function<void()>> hooks;
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            if (status_ != JobStatus::Pending && status_ != JobStatus::Running) return false;
+            if (!cancel_.exchange(true, std::memory_order_relaxed)) hooks = cancel_hooks_;
+        }
+        for (auto& fn : hooks) fn();
+        return true;
+    }
+
+    void Job::on_cancel(std::function<void()> fn) {
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            if (!cancel_requested()) {
+                cancel_hooks_.push_back(std::move(fn));
+                return;
+            }
+        }
+        fn();
+    }
+
+    void Job::check_cancelled() const {
+        if (cancel_requested()) throw JobCancelled();
+    }
+
+    void Job::wait() const {
+        std::unique_lock<std::mutex> lk(m_);
+        cv_.wait(lk, [this]() { return status_ != JobStatus::Pending && status_ != JobStatus::Running; });
+    }
+
+    bool Job::wait_for(double seconds) const {
+        std::unique_lock<std::mutex> lk(m_);
+        return cv_.wait_for(lk, std::chrono::duration<double>(std::max(seconds, 0.0)), [this]() {
+            return status_ != JobStatus::Pending && status_ != JobStatus::Running;
+        });
+    }
+
+    std::exception_ptr Job::error() const {
+        std::lock_guard<std::mutex> lk(m_);
+        return error_;
+    }
+
+    void Job::on_done(DoneCallback fn) {
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            if (status_ == JobStatus::Pending || status_ == JobStatus::Running) {
+                callbacks_.push_back(std::move(fn));
+                return;
+            }
+        }
+        fn();
+    }
+
+    void Job::run() {
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            if (status_ != JobStatus::Pending) return;
+            status_ = JobStatus::Running;
+        }
+        if (cancel_requested()) {
+            finish(JobStatus::Cancelled, nullptr);
+            return;
+        }
+        try {
+            work_(*this);
+            set_progress(1.0);
+            finish(JobStatus::Finished, nullptr);
+        } catch (const JobCancelled&) {
+            finish(JobStatus::Cancelled, nullptr);
+        } catch (...) {
+            finish(JobStatus::Failed, std::current_exception());
+        }
+    }
+
+    void Job::finish(JobStatus status, std::exception_ptr error) {
+        // Whatever the work captured (inputs, keep-alive handles) is released
+        // here, on the worker, before anyone waiting is woken.
+        work_ = nullptr;
+        std::vector<DoneCallback> callbacks;
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            status_ = status;
+            error_ = std::move(error);
+            callbacks.swap(callbacks_);
+            cancel_hooks_.clear();
+        }
+        cv_.notify_all();
+        for (auto& fn : callbacks) {
+            // A failing observer must not take the worker down with it.
+            try { fn(); } catch (...) {}
+        }
+    }
+
+    JobQueue::JobQueue(std::size_t num_threads) : pool_(num_threads) {}
+
+    JobQueue::~JobQueue() {
+        cancel_all();
+        pool_.wait_idle();
+    }
+
+    std::shared_ptr<Job> JobQueue::submit(std::string name, Job::Work work) {
+        auto job = std::make_shared<Job>(std::move(name), std::move(work));
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            std::erase_if(jobs_, [](const std::weak_ptr<Job>& w) {
+                auto j = w.lock();
+                return !j || j->done();
+            });
+            jobs_.push_back(job);
+        }
+        pool_.submit([job]() { job->run(); });
+        return job;
+    }
+
+    std::vector<std::shared_ptr<Job>> JobQueue::live_jobs() const {
+        std::vector<std::shared_ptr<Job>> out;
+        std::lock_guard<std::mutex> lk(m_);
+        for (const auto& w : jobs_) {
+            if (auto j = w.lock(); j && !j->done()) out.push_back(std::move(j));
+        }
+        return out;
+    }
+
+    std::size_t JobQueue::active() const {
+        return live_jobs().size();
+    }
+
+    void JobQueue::cancel_all() {
+        for (auto& job : live_jobs()) job->cancel();
+    }
+
+    void JobQueue::wait_idle() {
+        pool_.wait_idle();
+    }
+
+    JobQueue& shared_job_queue() {
+        // Same size as the kernel pool, so set_num_threads() / SST_NUM_THREADS
+        // also bound how many jobs run at once.
+        static JobQueue queue(get_num_threads());
+        return queue;
+    }
+
+} // namespace sst
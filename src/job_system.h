@@ -0,0 +1,134 @@
+#ifndef SWIRL_STRING_CORE_JOB_SYSTEM_H
+#define SWIRL_STRING_CORE_JOB_SYSTEM_H
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "thread_pool.h"
+
+namespace sst {
+
+enum class JobStatus { Pending, Running, Finished, Failed, Cancelled };
+
+const char* job_status_name(JobStatus status);
+
+// Thrown by Job::check_cancelled(); a job whose work ends with it is Cancelled.
+class JobCancelled : public std::runtime_error {
+public:
+    JobCancelled() : std::runtime_error("job cancelled") {}
+};
+
+/**
+ * @brief One long computation running on a JobQueue worker.
+ *
+ * The work function receives the job itself: it reports progress with
+ * set_progress() and polls check_cancelled() at convenient points (e.g. from
+ * a relax/evolve interrupt hook). cancel() only raises the flag, so a job
+ * that never polls runs to completion. All members are thread-safe.
+ */
+class Job {
+public:
+    using Work = std::function<void(Job&)>;
+    using DoneCallback = std::function<void()>;
+
+    explicit Job(std::string name, Work work);
+
+    Job(const Job&) = delete;
+    Job& operator=(const Job&) = delete;
+
+    const std::string& name() const { return name_; }
+    JobStatus status() const;
+    bool done() const;
+
+    // Fraction in [0, 1] last reported by the work function.
+    double progress() const { return progress_.load(std::memory_order_relaxed); }
+    void set_progress(double fraction);
+
+    // Ask the job to stop. A pending job never starts. Returns false when it
+    // has already finished.
+    bool cancel();
+    // Run fn from cancel() (immediately if cancellation was already requested),
+    // e.g. to forward it to a native token the work is polling.
+    void on_cancel(std::function<void()> fn);
+    bool cancel_requested() const { return cancel_.load(std::memory_order_relaxed); }
+    void check_cancelled() const;
+
+    void wait() const;
+    // Returns done().
+    bool wait_for(double seconds) const;
+
+    // Exception that ended a Failed job (null otherwise).
+    std::exception_ptr error() const;
+
+    // Run fn once the job is done, on the thread that finished it, or right
+    // away on the calling thread when it already is.
+    void on_done(DoneCallback fn);
+
+    // Execute the work on the calling thread (JobQueue workers call this).
+    void run();
+
+private:
+    void finish(JobStatus status, std::exception_ptr error);
+
+    const std::string name_;
+    Work work_;
+    std::atomic<double> progress_{0.0};
+    std::atomic<bool> cancel_{false};
+
+    mutable std::mutex m_;
+    mutable std::condition_variable cv_;
+    JobStatus status_ = JobStatus::Pending;
+    std::exception_ptr error_;
+    std::vector<DoneCallback> callbacks_;
+    std::vector<std::function<void()>> cancel_hooks_;
+};
+
+/**
+ * @brief Runs Jobs on a dedicated WorkStealingPool.
+ *
+ * Job workers are not shared_pool() workers, so the parallel kernels a job
+ * calls still fan out across shared_pool(). Destroying the queue cancels
+ * what is left and waits for running jobs.
+ */
+class JobQueue {
+public:
+    // num_threads == 0 -> std::thread::hardware_concurrency() (at least 1).
+    explicit JobQueue(std::size_t num_threads = 0);
+    ~JobQueue();
+
+    JobQueue(const JobQueue&) = delete;
+    JobQueue& operator=(const JobQueue&) = delete;
+
+    std::size_t size() const { return pool_.size(); }
+
+    std::shared_ptr<Job> submit(std::string name, Job::Work work);
+
+    // Jobs submitted and not yet done.
+    std::size_t active() const;
+    void cancel_all();
+    void wait_idle();
+
+private:
+    std::vector<std::shared_ptr<Job>> live_jobs() const;
+
+    mutable std::mutex m_;
+    std::vector<std::weak_ptr<Job>> jobs_;
+    WorkStealingPool pool_;
+};
+
+// Process-wide queue behind the Python submit() API. Created on first use
+// with get_num_threads() workers; later set_num_threads() calls resize only
+// the kernel pool, not this queue.
+JobQueue& shared_job_queue();
+
+} // namespace sst
+
+#endif // SWIRL_STRING_CORE_JOB_SYSTEM_H
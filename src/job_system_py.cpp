@@ -0,0 +1,406 @@
+// src/job_system_py.cpp
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include "job_system.h"
+#include "ab_initio_mass.h"
+#include "knot_dynamics.h"
+#include "sst_extensions.h"
+#include "../include/SST_Master_Dictionary.h"
+
+namespace py = pybind11;
+using namespace sst;
+
+namespace {
+
+// Python reference that may be dropped on a job worker: the last release
+// takes the GIL first.
+struct GilObject {
+    py::object obj;
+    explicit GilObject(py::object o) : obj(std::move(o)) {}
+    ~GilObject() {
+        if (obj) {
+            py::gil_scoped_acquire gil;
+            obj = py::object();
+        }
+    }
+};
+
+// Native work (runs on a job worker without the GIL) plus the conversion of
+// its result, which runs with the GIL the first time Python asks for it.
+struct PreparedJob {
+    Job::Work work;
+    std::function<py::object()> result;
+};
+
+// submit() keyword arguments; anything a job does not consume is an error.
+class JobArgs {
+public:
+    JobArgs(std::string fn_name, py::kwargs kwargs) : fn_(std::move(fn_name)), kw_(std::move(kwargs)) {}
+
+    py::object object(const char* name) {
+        used_.insert(name);
+        if (!kw_.contains(name)) return py::none();
+        return kw_[name];
+    }
+
+    template <class T>
+    T get(const char* name, T fallback) {
+        py::object v = object(name);
+        return v.is_none() ? fallback : v.cast<T>();
+    }
+
+    py::object require(const char* name) {
+        py::object v = object(name);
+        if (v.is_none()) {
+            throw py::type_error("submit('" + fn_ + "'): missing argument '" + name + "'");
+        }
+        return v;
+    }
+
+    void check_all_used() const {
+        for (auto item : kw_) {
+            const std::string key = py::str(item.first);
+            if (!used_.count(key)) {
+                throw py::type_error("submit('" + fn_ + "'): unexpected argument '" + key + "'");
+            }
+        }
+    }
+
+private:
+    std::string fn_;
+    py::kwargs kw_;
+    std::set<std::string> used_;
+};
+
+PreparedJob relax_job(JobArgs& args) {
+    py::object evaluator = args.object("evaluator");
+    const std::string ab_id = evaluator.is_none() ? args.require("knot_ab_id").cast<std::string>() : std::string();
+    const int resolution = args.get<int>("resolution", 4000);
+    const int iterations = args.get<int>("iterations", 1000);
+    const double timestep = args.get<double>("timestep", 0.01);
+    const double total = std::max(iterations, 1);
+
+    auto relax = [iterations, timestep, total](Job& job, ParticleEvaluator& pe) {
+        pe.relax_hamiltonian(iterations, timestep, [&job, &pe, total]() {
+            job.set_progress(pe.relaxation_iteration() / total);
+            job.check_cancelled();
+        });
+    };
+
+    if (!evaluator.is_none()) {
+        // Relax in place; the evaluator must not be used from Python meanwhile.
+        // If cancelled it is left mid-run and resume_relaxation() finishes it.
+        auto* pe = evaluator.cast<ParticleEvaluator*>();
+        auto keep = std::make_shared<GilObject>(evaluator);
+        return {[relax, pe, keep](Job& job) { relax(job, *pe); },
+                [evaluator]() { return evaluator; }};
+    }
+    auto slot = std::make_shared<std::unique_ptr<ParticleEvaluator>>();
+    return {[relax, slot, ab_id, resolution](Job& job) {
+                auto pe = std::make_unique<ParticleEvaluator>(ab_id, resolution);
+                job.check_cancelled();
+                relax(job, *pe);
+                *slot = std::move(pe);
+            },
+            [slot]() { return py::cast(std::move(*slot)); }};
+}
+
+double evolve_fraction(const IntegratorProgress& p) {
+    if (p.span > 0.0 && p.t > 0.0) return p.t / p.span;  // adaptive
+    return p.steps ? static_cast<double>(p.steps_done) / static_cast<double>(p.steps) : 0.0;
+}
+
+PreparedJob evolve_job(JobArgs& args) {
+    // Same contract as relax: the system is advanced in place and a cancelled
+    // call stays pending for resume_evolve().
+    py::object system = args.require("system");
+    auto* sys = system.cast<VortexKnotSystem*>();
+    const double dt = args.require("dt").cast<double>();
+    const auto steps = args.require("steps").cast<std::size_t>();
+    auto keep = std::make_shared<GilObject>(system);
+    return {[sys, keep, dt, steps](Job& job) {
+                sys->evolve(dt, steps, [&job, sys]() {
+                    job.set_progress(evolve_fraction(sys->get_evolve_progress()));
+                    job.check_cancelled();
+                });
+            },
+            [system]() { return system; }};
+}
+
+PreparedJob helicity_job(JobArgs& args) {
+    const auto root_dir = args.require("root_dir").cast<std::string>();
+    const int grid_size = args.get<int>("grid_size", 32);
+    const double spacing = args.get<double>("spacing", 0.1);
+    const int interior_margin = args.get<int>("interior_margin", 8);
+    const int nsamples = args.get<int>("nsamples", 1000);
+    const bool recurse = args.get<bool>("recurse", false);
+    auto slot = std::make_shared<std::vector<sstext::HelicityResult>>();
+    return {[=](Job& job) {
+                *slot = sstext::batch_helicity_from_dir(
+                    root_dir, grid_size, spacing, interior_margin, nsamples, recurse,
+                    [&job](std::size_t done, std::size_t total) {
+                        if (total > 0) job.set_progress(static_cast<double>(done) / static_cast<double>(total));
+                        job.check_cancelled();
+                    });
+            },
+            [slot]() { return py::cast(std::move(*slot)); }};
+}
+
+PreparedJob zoo_job(JobArgs& args) {
+    auto cfg = args.get<ZooEvaluator::AbInitioConfig>("config", ZooEvaluator::AbInitioConfig{});
+    if (cfg.identifiers.empty()) {
+        // Resolve "whole dictionary" here so progress has a denominator.
+        for (const auto& entry : SST_MASTER_DICTIONARY) cfg.identifiers.push_back(entry.first);
+    }
+    auto slot = std::make_shared<std::vector<ZooEvaluator::AbInitioResult>>();
+    return {[cfg, slot](Job& job) {
+                auto token = std::make_shared<ZooEvaluator::CancelToken>();
+                job.on_cancel([token]() { token->cancel(); });
+                const double total = static_cast<double>(std::max<std::size_t>(cfg.identifiers.size(), 1));
+                std::size_t finished = 0;  // on_result calls are serialized
+                *slot = ZooEvaluator::evaluate_all_ab_initio(
+                    cfg, [&job, &finished, total](const ZooEvaluator::AbInitioResult&) {
+                        job.set_progress(static_cast<double>(++finished) / total);
+                    },
+                    token.get());
+                job.check_cancelled();
+            },
+            [slot]() { return py::cast(std::move(*slot)); }};
+}
+
+using JobFactory = PreparedJob (*)(JobArgs&);
+
+const std::map<std::string, JobFactory>& job_registry() {
+    static const std::map<std::string, JobFactory> registry = {
+        {"ParticleEvaluator.relax", &relax_job},
+        {"VortexKnotSystem.evolve", &evolve_job},
+        {"ZooEvaluator.evaluate_all_ab_initio", &zoo_job},
+        {"batch_helicity_from_dir", &helicity_job},
+    };
+    return registry;
+}
+
+struct PyJob {
+    std::shared_ptr<Job> job;
+    std::function<py::object()> convert;
+    py::object value;  // converted result, cached
+};
+
+std::atomic<bool> g_queue_started{false};
+
+[[noreturn]] void raise_futures_error(const char* name, const std::string& message) {
+    py::object cls = py::module_::import("concurrent.futures").attr(name);
+    PyErr_SetObject(cls.ptr(), py::str(message).ptr());
+    throw py::error_already_set();
+}
+
+// Wait without the GIL, polling for Ctrl-C; no timeout waits for good.
+bool wait_job(const Job& job, std::optional<double> timeout) {
+    using clock = std::chrono::steady_clock;
+    const auto deadline = clock::now() + std::chrono::duration_cast<clock::duration>(
+        std::chrono::duration<double>(timeout ? std::max(*timeout, 0.0) : 0.0));
+    for (;;) {
+        double slice = 0.05;
+        if (timeout) {
+            const double left = std::chrono::duration<double>(deadline - clock::now()).count();
+            if (left <= 0.0) return job.done();
+            slice = std::min(slice, left);
+        }
+        bool done;
+        {
+            py::gil_scoped_release release;
+            done = job.wait_for(slice);
+        }
+        if (done) return true;
+        if (PyErr_CheckSignals() != 0) throw py::error_already_set();
+    }
+}
+
+py::object job_result(PyJob& self, std::optional<double> timeout) {
+    if (!wait_job(*self.job, timeout)) {
+        raise_futures_error("TimeoutError", "job '" + self.job->name() + "' still running");
+    }
+    switch (self.job->status()) {
+        case JobStatus::Cancelled:
+            raise_futures_error("CancelledError", "job '" + self.job->name() + "' was cancelled");
+        case JobStatus::Failed:
+            std::rethrow_exception(self.job->error());
+        default:
+            break;
+    }
+    if (!self.value) {
+        self.value = self.convert();
+        self.convert = nullptr;
+    }
+    return self.value;
+}
+
+// Python exception instance for a failed job, mapped like pybind's own translators.
+py::object python_error(std::exception_ptr error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (py::error_already_set& e) {
+        return e.value();
+    } catch (const std::invalid_argument& e) {
+        PyErr_SetString(PyExc_ValueError, e.what());
+    } catch (const std::out_of_range& e) {
+        PyErr_SetString(PyExc_IndexError, e.what());
+    } catch (const std::bad_alloc&) {
+        PyErr_SetString(PyExc_MemoryError, "out of memory");
+    } catch (const std::exception& e) {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+    } catch (...) {
+        PyErr_SetString(PyExc_RuntimeError, "unknown native error");
+    }
+    py::error_already_set e;
+    return e.value();
+}
+
+// fn(job) once the job is done: on the worker that finished it, with the GIL.
+void add_done_callback(py::object self, py::object fn) {
+    PyJob& pj = self.cast<PyJob&>();
+    auto hold = std::make_shared<GilObject>(py::make_tuple(self, fn));
+    pj.job->on_done([hold]() {
+        py::gil_scoped_acquire gil;
+        try {
+            auto args = py::reinterpret_borrow<py::tuple>(hold->obj);
+            args[1](args[0]);
+        } catch (py::error_already_set& e) {
+            e.discard_as_unraisable("sstcore.Job done callback");
+        }
+    });
+}
+
+// concurrent.futures.Future mirroring the job; cancelling it cancels the job.
+py::object as_future(py::object self) {
+    PyJob& pj = self.cast<PyJob&>();
+    py::object fut = py::module_::import("concurrent.futures").attr("Future")();
+    std::weak_ptr<Job> weak = pj.job;
+    fut.attr("add_done_callback")(py::cpp_function([weak](py::object f) {
+        if (f.attr("cancelled")().cast<bool>()) {
+            if (auto job = weak.lock()) job->cancel();
+        }
+    }));
+    add_done_callback(self, py::cpp_function([fut](py::object job_obj) {
+        if (fut.attr("done")().cast<bool>()) return;
+        PyJob& done = job_obj.cast<PyJob&>();
+        switch (done.job->status()) {
+            case JobStatus::Cancelled:
+                fut.attr("cancel")();
+                break;
+            case JobStatus::Failed:
+                fut.attr("set_exception")(python_error(done.job->error()));
+                break;
+            default:
+                try {
+                    fut.attr("set_result")(job_result(done, 0.0));
+                } catch (py::error_already_set& e) {
+                    fut.attr("set_exception")(e.value());
+                }
+        }
+    }));
+    return fut;
+}
+
+} // namespace
+
+void bind_job_system(py::module_& m) {
+    py::class_<PyJob>(m, "Job", R"pbdoc(
+Handle to a native computation started with submit().
+
+The work runs on a native worker thread without the GIL. Poll it with done() /
+progress(), block with wait() / result(), stop it with cancel(), or await it
+from asyncio (``await job``); as_future() gives a concurrent.futures.Future.
+)pbdoc")
+        .def_property_readonly("name", [](const PyJob& self) { return self.job->name(); })
+        .def_property_readonly("status", [](const PyJob& self) {
+            return std::string(job_status_name(self.job->status()));
+        }, "'pending', 'running', 'finished', 'failed' or 'cancelled'.")
+        .def("done", [](const PyJob& self) { return self.job->done(); })
+        .def("running", [](const PyJob& self) { return self.job->status() == JobStatus::Running; })
+        .def("cancelled", [](const PyJob& self) { return self.job->status() == JobStatus::Cancelled; })
+        .def("progress", [](const PyJob& self) { return self.job->progress(); },
+             "Completed fraction in [0, 1] as last reported by the native work.")
+        .def("cancel", [](PyJob& self) { return self.job->cancel(); },
+             R"pbdoc(Request cancellation. A pending job never starts; a running one stops at its next
+progress report. Returns False if the job had already finished.)pbdoc")
+        .def("wait", [](PyJob& self, std::optional<double> timeout) { return wait_job(*self.job, timeout); },
+             py::arg("timeout") = py::none(),
+             "Block (without the GIL) until the job is done or timeout seconds pass; returns done().")
+        .def("result", &job_result, py::arg("timeout") = py::none(),
+             R"pbdoc(Wait for the job and return its result. Raises the job's exception,
+concurrent.futures.CancelledError, or concurrent.futures.TimeoutError.)pbdoc")
+        .def("add_done_callback", &add_done_callback, py::arg("fn"),
+             "Call fn(job) when the job is done (on the worker thread, or now if already done).")
+        .def("as_future", &as_future,
+             "concurrent.futures.Future for this job; cancelling the future cancels the job.")
+        .def("__await__", [](py::object self) {
+            py::object fut = py::module_::import("asyncio").attr("wrap_future")(as_future(self));
+            return fut.attr("__await__")();
+        })
+        .def("__repr__", [](const PyJob& self) {
+            return "Job(name='" + self.job->name() + "', status='" +
+                   job_status_name(self.job->status()) + "', progress=" +
+                   std::to_string(self.job->progress()) + ")";
+        });
+
+    m.def("submit",
+          [](const std::string& fn_name, py::kwargs kwargs) {
+              const auto& registry = job_registry();
+              auto it = registry.find(fn_name);
+              if (it == registry.end()) {
+                  throw py::value_error("submit: unknown function '" + fn_name + "' (see job_functions())");
+              }
+              JobArgs args(fn_name, std::move(kwargs));
+              PreparedJob prepared = it->second(args);
+              args.check_all_used();
+              g_queue_started = true;
+              return PyJob{shared_job_queue().submit(fn_name, std::move(prepared.work)),
+                           std::move(prepared.result), py::object()};
+          },
+          py::arg("fn_name"),
+          R"pbdoc(
+Start a long computation on a native worker thread and return a Job handle.
+
+    submit("ParticleEvaluator.relax", knot_ab_id="3:1:1", resolution=4000,
+           iterations=1000, timestep=0.01)        -> ParticleEvaluator
+    submit("ParticleEvaluator.relax", evaluator=pe, iterations=..., timestep=...)
+                                                  -> pe, relaxed in place
+    submit("VortexKnotSystem.evolve", system=s, dt=..., steps=...)
+                                                  -> s, evolved in place
+    submit("batch_helicity_from_dir", root_dir=..., grid_size=32, spacing=0.1,
+           interior_margin=8, nsamples=1000, recurse=False)
+                                                  -> list[HelicityResult]
+    submit("ZooEvaluator.evaluate_all_ab_initio", config=ZooAbInitioConfig())
+                                                  -> list[ZooAbInitioResult]
+
+Jobs share get_num_threads() workers (fixed at the first submit()); the kernels
+they call still use the parallel pool. Objects passed in are kept alive until the job ends and must not be used
+from Python meanwhile. A cancelled in-place relax/evolve can be finished later
+with resume_relaxation() / resume_evolve().
+)pbdoc");
+
+    m.def("job_functions", []() {
+        std::vector<std::string> names;
+        for (const auto& entry : job_registry()) names.push_back(entry.first);
+        return names;
+    }, "Names accepted by submit().");
+
+    // Stop outstanding jobs before the interpreter goes away: their workers
+    // need the GIL to hand back results and release inputs.
+    py::module_::import("atexit").attr("register")(py::cpp_function([]() {
+        if (!g_queue_started) return;
+        shared_job_queue().cancel_all();
+        py::gil_scoped_release release;
+        shared_job_queue().wait_idle();
+    }));
+}
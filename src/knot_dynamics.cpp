@@ -1,6 +1,9 @@
 #include "knot_dynamics.h"
 #include "../include/SST_Constants.h"
 #include "biot_savart.h"
+#include "checkpoint.h"
+#include "profiler.h"
+#include "thread_pool.h"
 #include <algorithm>
 #include <cctype>
 #include <cmath>
@@ -38,23 +41,32 @@ namespace sst {
                 throw std::runtime_error("Embedded ideal text not found: " + name);
         }
 
-        double KnotDynamics::compute_writhe(const std::vector<Vec3>& X) {
-                double W = 0.0;
+        double KnotDynamics::compute_writhe(std::span<const Vec3> X) {
+                SST_PROFILE_SCOPE_PAIRS("knot.writhe", X.size() * X.size());
                 size_t N = X.size();
-                for (size_t i = 0; i < N - 1; ++i) {
-                        for (size_t j = i + 1; j < N - 1; ++j) {
-                                Vec3 r = diff(X[i], X[j]);
-                                double r_norm = norm(r);
-                                if (r_norm < 1e-6) continue;
-                                Vec3 t1 = diff(X[i+1], X[i]);
-                                Vec3 t2 = diff(X[j+1], X[j]);
-                                W += dot(cross(t1, t2), r) / (r_norm * r_norm * r_norm);
+                if (N < 2) return 0.0;
+                // Row partials reduced in order: same result for any thread count.
+                std::vector<double> row(N - 1, 0.0);
+                parallel_for(0, N - 1, 16, [&](size_t lo, size_t hi) {
+                        for (size_t i = lo; i < hi; ++i) {
+                                const Vec3 t1 = diff(X[i+1], X[i]);
+                                double w = 0.0;
+                                for (size_t j = i + 1; j < N - 1; ++j) {
+                                        Vec3 r = diff(X[i], X[j]);
+                                        double r_norm = norm(r);
+                                        if (r_norm < 1e-6) continue;
+                                        Vec3 t2 = diff(X[j+1], X[j]);
+                                        w += dot(cross(t1, t2), r) / (r_norm * r_norm * r_norm);
+                                }
+                                row[i] = w;
                         }
-                }
+                });
+                double W = 0.0;
+                for (double w : row) W += w;
                 return W / (2.0 * SST::Constants::pi);
         }
 
-        int KnotDynamics::compute_linking_number(const std::vector<Vec3>& X, const std::vector<Vec3>& Y) {
+        int KnotDynamics::compute_linking_number(std::span<const Vec3> X, std::span<const Vec3> Y) {
                 double Lk = 0.0;
                 size_t N = X.size(), M = Y.size();
                 for (size_t i = 0; i < N - 1; ++i) {
@@ -72,7 +84,7 @@ namespace sst {
                 return static_cast<int>(std::round(Lk / (4.0 * SST::Constants::pi)));
         }
 
-        double KnotDynamics::compute_twist(const std::vector<Vec3>& T, const std::vector<Vec3>& B) {
+        double KnotDynamics::compute_twist(std::span<const Vec3> T, std::span<const Vec3> B) {
                 double Tw = 0.0;
                 size_t N = T.size();
                 for (size_t i = 1; i < N - 1; ++i) {
@@ -83,13 +95,13 @@ namespace sst {
                 return Tw / (2.0 * SST::Constants::pi);
         }
 
-        double KnotDynamics::compute_centerline_helicity(const std::vector<Vec3>& curve,
-                                                                           const std::vector<Vec3>& tangent) {
+        double KnotDynamics::compute_centerline_helicity(std::span<const Vec3> curve,
+                                                                           std::span<const Vec3> tangent) {
                 return compute_writhe(curve); // Simplified: H_cl ~ Wr for single loop
         }
 
         std::vector<std::pair<int, int>> KnotDynamics::detect_reconnection_candidates(
-                        const std::vector<Vec3>& curve, double threshold) {
+                        std::span<const Vec3> curve, double threshold) {
                 std::vector<std::pair<int, int>> candidates;
                 size_t N = curve.size();
                 for (size_t i = 0; i < N; ++i) {
@@ -107,6 +119,7 @@ namespace sst {
         KnotDynamics::FourierResult KnotDynamics::evaluate_fourier_series(
                 const std::vector<std::array<double, 6>>& coeffs,
                 const std::vector<double>& t_vals) {
+                SST_PROFILE_SCOPE("fourier.evaluate_series");
                 size_t N = coeffs.size();
                 size_t T = t_vals.size();
                 FourierResult result;
@@ -118,7 +131,9 @@ namespace sst {
                         Vec3 r = {0, 0, 0}, r_t = {0, 0, 0};
 
                         for (size_t n = 0; n < N; ++n) {
-                                double nt = n * t;
+                                // Harmonic index as double: -n on size_t would wrap.
+                                const double dn = static_cast<double>(n);
+                                double nt = dn * t;
                                 double cos_nt = std::cos(nt), sin_nt = std::sin(nt);
                                 auto& c = coeffs[n];
 
@@ -127,9 +142,9 @@ namespace sst {
                                 r[2] += c[4]*cos_nt + c[5]*sin_nt;
 
                                 if (n > 0) {
-                                        r_t[0] += -n * c[0]*sin_nt + n * c[1]*cos_nt;
-                                        r_t[1] += -n * c[2]*sin_nt + n * c[3]*cos_nt;
-                                        r_t[2] += -n * c[4]*sin_nt + n * c[5]*cos_nt;
+                                        r_t[0] += -dn * c[0]*sin_nt + dn * c[1]*cos_nt;
+                                        r_t[1] += -dn * c[2]*sin_nt + dn * c[3]*cos_nt;
+                                        r_t[2] += -dn * c[4]*sin_nt + dn * c[5]*cos_nt;
                                 }
                         }
 
@@ -143,33 +158,41 @@ namespace sst {
         double KnotDynamics::writhe_gauss_curve(
                 const std::vector<Vec3>& r,
                 const std::vector<Vec3>& r_t) {
+                SST_PROFILE_SCOPE_PAIRS("knot.writhe_gauss", r.size() * r.size());
                 const double pi = 3.141592653589793;
                 size_t M = r.size();
-                double sum = 0.0;
                 double dt = 2 * pi / M;
 
-                for (size_t i = 0; i < M; ++i) {
-                        for (size_t j = 0; j < M; ++j) {
-                                if (i == j) continue;
-                                Vec3 dR = {
-                                        r[i][0] - r[j][0],
-                                        r[i][1] - r[j][1],
-                                        r[i][2] - r[j][2]
-                                };
-                                double dist = std::sqrt(dR[0]*dR[0] + dR[1]*dR[1] + dR[2]*dR[2]);
-                                if (dist < 1e-6) continue;
-
-                                Vec3 Ti = r_t[i];
-                                Vec3 Tj = r_t[j];
-                                Vec3 cross = {
-                                        Ti[1]*Tj[2] - Ti[2]*Tj[1],
-                                        Ti[2]*Tj[0] - Ti[0]*Tj[2],
-                                        Ti[0]*Tj[1] - Ti[1]*Tj[0]
-                                };
-                                double dot = cross[0]*dR[0] + cross[1]*dR[1] + cross[2]*dR[2];
-                                sum += dot / (dist*dist*dist);
+                // Row partials reduced in order: same result for any thread count.
+                std::vector<double> row(M, 0.0);
+                parallel_for(0, M, 16, [&](size_t lo, size_t hi) {
+                        for (size_t i = lo; i < hi; ++i) {
+                                double row_sum = 0.0;
+                                for (size_t j = 0; j < M; ++j) {
+                                        if (i == j) continue;
+                                        Vec3 dR = {
+                                                r[i][0] - r[j][0],
+                                                r[i][1] - r[j][1],
+                                                r[i][2] - r[j][2]
+                                        };
+                                        double dist = std::sqrt(dR[0]*dR[0] + dR[1]*dR[1] + dR[2]*dR[2]);
+                                        if (dist < 1e-6) continue;
+
+                                        Vec3 Ti = r_t[i];
+                                        Vec3 Tj = r_t[j];
+                                        Vec3 cross = {
+                                                Ti[1]*Tj[2] - Ti[2]*Tj[1],
+                                                Ti[2]*Tj[0] - Ti[0]*Tj[2],
+                                                Ti[0]*Tj[1] - Ti[1]*Tj[0]
+                                        };
+                                        double dot = cross[0]*dR[0] + cross[1]*dR[1] + cross[2]*dR[2];
+                                        row_sum += dot / (dist*dist*dist);
+                                }
+                                row[i] = row_sum;
                         }
-                }
+                });
+                double sum = 0.0;
+                for (double v : row) sum += v;
                 return (dt*dt * sum) / (4 * pi);
         }
 
@@ -408,28 +431,28 @@ namespace sst {
 
         // Biot-Savart and helicity calculation wrappers
         std::vector<Vec3> KnotDynamics::compute_biot_savart_velocity_grid(
-                const std::vector<Vec3>& curve,
-                const std::vector<Vec3>& grid_points) {
+                std::span<const Vec3> curve,
+                std::span<const Vec3> grid_points) {
                 return BiotSavart::computeVelocity(curve, grid_points);
         }
 
         std::vector<Vec3> KnotDynamics::compute_vorticity_grid(
-                const std::vector<Vec3>& velocity,
+                std::span<const Vec3> velocity,
                 const std::array<int, 3>& shape,
                 double spacing) {
                 return BiotSavart::computeVorticity(velocity, shape, spacing);
         }
 
         std::vector<Vec3> KnotDynamics::extract_interior_field(
-                const std::vector<Vec3>& field,
+                std::span<const Vec3> field,
                 const std::array<int, 3>& shape,
                 int margin) {
                 return BiotSavart::extractInterior(field, shape, margin);
         }
 
         std::tuple<double, double, double> KnotDynamics::compute_helicity_invariants(
-                const std::vector<Vec3>& v_sub,
-                const std::vector<Vec3>& w_sub,
+                std::span<const Vec3> v_sub,
+                std::span<const Vec3> w_sub,
                 const std::vector<double>& r_sq) {
                 return BiotSavart::computeInvariants(v_sub, w_sub, r_sq);
         }
@@ -440,62 +463,83 @@ namespace sst {
                 double spacing,
                 int interior_margin,
                 int nsamples) {
+                SST_PROFILE_SCOPE("helicity.from_fourier_block");
                 // Evaluate Fourier block to get knot points
-                std::vector<double> s(nsamples);
-                const double twoPi = 2.0 * M_PI;
-                for (int i = 0; i < nsamples; ++i) {
-                        s[i] = twoPi * double(i) / double(nsamples - 1);
+                std::vector<Vec3> curve;
+                {
+                        SST_PROFILE_SCOPE("helicity.sample_curve");
+                        std::vector<double> s(nsamples);
+                        const double twoPi = 2.0 * M_PI;
+                        for (int i = 0; i < nsamples; ++i) {
+                                s[i] = twoPi * double(i) / double(nsamples - 1);
+                        }
+                        curve = FourierKnot::center_points(FourierKnot::evaluate(block, s));
                 }
-                std::vector<Vec3> curve = FourierKnot::evaluate(block, s);
-                curve = FourierKnot::center_points(curve);
 
                 // Create grid (matching Python: spacing * (np.arange(grid_size) - grid_size // 2))
-                std::vector<Vec3> grid_points;
-                grid_points.reserve(grid_size * grid_size * grid_size);
                 const int half_grid = grid_size / 2;  // Integer division to match Python //
-                for (int i = 0; i < grid_size; ++i) {
-                        for (int j = 0; j < grid_size; ++j) {
-                                for (int k = 0; k < grid_size; ++k) {
-                                        double x = spacing * (i - half_grid);
-                                        double y = spacing * (j - half_grid);
-                                        double z = spacing * (k - half_grid);
-                                        grid_points.push_back({x, y, z});
+                std::vector<Vec3> grid_points;
+                {
+                        SST_PROFILE_SCOPE("helicity.grid");
+                        grid_points.reserve(grid_size * grid_size * grid_size);
+                        for (int i = 0; i < grid_size; ++i) {
+                                for (int j = 0; j < grid_size; ++j) {
+                                        for (int k = 0; k < grid_size; ++k) {
+                                                double x = spacing * (i - half_grid);
+                                                double y = spacing * (j - half_grid);
+                                                double z = spacing * (k - half_grid);
+                                                grid_points.push_back({x, y, z});
+                                        }
                                 }
                         }
                 }
 
                 // Compute velocity on grid
-                std::vector<Vec3> velocity = BiotSavart::computeVelocity(curve, grid_points);
+                std::vector<Vec3> velocity;
+                {
+                        SST_PROFILE_SCOPE_PAIRS("helicity.biot_savart", curve.size() * grid_points.size());
+                        velocity = BiotSavart::computeVelocity(curve, grid_points);
+                }
 
                 // Compute vorticity
                 std::array<int, 3> shape = {grid_size, grid_size, grid_size};
-                std::vector<Vec3> vorticity = BiotSavart::computeVorticity(velocity, shape, spacing);
+                std::vector<Vec3> vorticity;
+                {
+                        SST_PROFILE_SCOPE("helicity.curl");
+                        vorticity = BiotSavart::computeVorticity(velocity, shape, spacing);
+                }
 
                 // Extract interior fields
-                std::vector<Vec3> v_sub = BiotSavart::extractInterior(velocity, shape, interior_margin);
-                std::vector<Vec3> w_sub = BiotSavart::extractInterior(vorticity, shape, interior_margin);
-
-                // Compute r_sq for interior points (matching Python interior_vals)
+                std::vector<Vec3> v_sub, w_sub;
                 std::vector<double> r_sq;
-                r_sq.reserve(v_sub.size());
-                const int interior_size = grid_size - 2 * interior_margin;
-                for (int i = 0; i < interior_size; ++i) {
-                        for (int j = 0; j < interior_size; ++j) {
-                                for (int k = 0; k < interior_size; ++k) {
-                                        double x = spacing * (i + interior_margin - half_grid);
-                                        double y = spacing * (j + interior_margin - half_grid);
-                                        double z = spacing * (k + interior_margin - half_grid);
-                                        r_sq.push_back(x*x + y*y + z*z);
+                {
+                        SST_PROFILE_SCOPE("helicity.interior");
+                        v_sub = BiotSavart::extractInterior(velocity, shape, interior_margin);
+                        w_sub = BiotSavart::extractInterior(vorticity, shape, interior_margin);
+
+                        // Compute r_sq for interior points (matching Python interior_vals)
+                        r_sq.reserve(v_sub.size());
+                        const int interior_size = grid_size - 2 * interior_margin;
+                        for (int i = 0; i < interior_size; ++i) {
+                                for (int j = 0; j < interior_size; ++j) {
+                                        for (int k = 0; k < interior_size; ++k) {
+                                                double x = spacing * (i + interior_margin - half_grid);
+                                                double y = spacing * (j + interior_margin - half_grid);
+                                                double z = spacing * (k + interior_margin - half_grid);
+                                                r_sq.push_back(x*x + y*y + z*z);
+                                        }
                                 }
                         }
                 }
 
                 // Compute invariants
+                SST_PROFILE_SCOPE("helicity.invariants");
                 return BiotSavart::computeInvariants(v_sub, w_sub, r_sq);
         }
 
         // Fourier knot implementation (from fourier_knot.cpp)
         std::vector<FourierBlock> FourierKnot::parse_fseries_multi(const std::string& path) {
+                SST_PROFILE_SCOPE("parse.fseries_file");
                 std::ifstream in(path);
                 std::vector<FourierBlock> blocks;
                 if (!in) return blocks;
@@ -533,6 +577,7 @@ namespace sst {
         }
 
         std::vector<FourierBlock> FourierKnot::parse_fseries_from_string(const std::string& content) {
+                SST_PROFILE_SCOPE("parse.fseries");
                 std::istringstream in(content);
                 std::vector<FourierBlock> blocks;
                 
@@ -580,6 +625,7 @@ namespace sst {
         }
 
         std::vector<Vec3> FourierKnot::evaluate(const FourierBlock& b, const std::vector<double>& s) {
+                SST_PROFILE_SCOPE("fourier.evaluate");
                 const int N = (int)b.a_x.size();
                 std::vector<Vec3> out(s.size(), {0.0,0.0,0.0});
                 for (size_t i=0;i<s.size();++i) {
@@ -776,6 +822,12 @@ namespace sst {
         VortexKnotSystem::VortexKnotSystem(double gamma) : circulation(gamma) {}
 
         void VortexKnotSystem::initialize_trefoil_knot(size_t resolution) {
+                integrator.reset();
+                far_field_stale = true;
+                multirate.reset();
+                remesh_spacing = 0.0;
+                steps_since_remesh = 0;
+                sim_time = 0.0;
                 positions.clear();
                 tangents.clear();
                 positions.reserve(resolution);
@@ -792,6 +844,12 @@ namespace sst {
         }
 
         void VortexKnotSystem::initialize_figure8_knot(size_t resolution) {
+                integrator.reset();
+                far_field_stale = true;
+                multirate.reset();
+                remesh_spacing = 0.0;
+                steps_since_remesh = 0;
+                sim_time = 0.0;
                 positions.clear();
                 tangents.clear();
                 positions.reserve(resolution);
@@ -808,17 +866,21 @@ namespace sst {
         }
 
         void VortexKnotSystem::compute_tangents() {
-                tangents.resize(positions.size());
-                size_t N = positions.size();
+                closed_tangents(positions, tangents);
+        }
+
+        void VortexKnotSystem::closed_tangents(const std::vector<Vec3>& X, std::vector<Vec3>& T) {
+                T.resize(X.size());
+                size_t N = X.size();
                 for (size_t i = 0; i < N; ++i) {
-                        const Vec3& prev = positions[(i + N - 1) % N];
-                        const Vec3& next = positions[(i + 1) % N];
+                        const Vec3& prev = X[(i + N - 1) % N];
+                        const Vec3& next = X[(i + 1) % N];
                         Vec3 tangent{
                                 (next[0] - prev[0]) * 0.5,
                                 (next[1] - prev[1]) * 0.5,
                                 (next[2] - prev[2]) * 0.5
                         };
-                        tangents[i] = tangent;
+                        T[i] = tangent;
                 }
         }
 
@@ -936,6 +998,12 @@ namespace sst {
         }
 
         void VortexKnotSystem::initialize_knot_from_name(const std::string& knot_id, size_t resolution) {
+                integrator.reset();
+                far_field_stale = true;
+                multirate.reset();
+                remesh_spacing = 0.0;
+                steps_since_remesh = 0;
+                sim_time = 0.0;
                 // First, try embedded files (compiled into the library)
                 static std::map<std::string, std::string> embedded_files = sst::get_embedded_knot_files();
                 auto it = embedded_files.find(knot_id);
@@ -970,18 +1038,287 @@ namespace sst {
                 }
         }
 
-        void VortexKnotSystem::evolve(double dt, size_t steps) {
-                for (size_t step = 0; step < steps; ++step) {
-                        std::vector<Vec3> new_positions = positions;
+        void VortexKnotSystem::evolve(double dt, size_t steps, std::function<void()> interrupt_callback) {
+                // Tangents are a function of the stage positions, so every stage
+                // sees a consistent (X, T) pair; stored tangents follow each step.
+                integrator.integrate([this](const std::vector<Vec3>& X, std::vector<Vec3>& v) { induced_velocity(X, v); },
+                                     positions, dt, steps, [this, &interrupt_callback](double h) {
+                                             after_step(h);
+                                             if (interrupt_callback) interrupt_callback();
+                                     });
+        }
+
+        bool VortexKnotSystem::has_pending_evolve() const {
+                return integrator.progress().active;
+        }
+
+        void VortexKnotSystem::resume_evolve(std::function<void()> interrupt_callback) {
+                integrator.resume([this](const std::vector<Vec3>& X, std::vector<Vec3>& v) { induced_velocity(X, v); },
+                                  positions, [this, &interrupt_callback](double h) {
+                                          after_step(h);
+                                          if (interrupt_callback) interrupt_callback();
+                                  });
+        }
+
+        const IntegratorProgress& VortexKnotSystem::get_evolve_progress() const {
+                return integrator.progress();
+        }
+
+        void VortexKnotSystem::after_step(double h) {
+                sim_time += h;
+                const size_t far_interval = induction.mode == InductionMode::MultiRate ? multirate.interval()
+                                          : induction.mode == InductionMode::Hybrid   ? induction.far_field_interval
+                                                                                      : 0;
+                if (far_interval > 0 && induction.far_field_interval > 0 && ++steps_since_far_field >= far_interval) {
+                        // The cached term changes: FSAL derivatives are stale too.
+                        far_field_stale = true;
+                        steps_since_far_field = 0;
+                        integrator.invalidate();
+                }
+                if (remesh_every > 0 && ++steps_since_remesh >= remesh_every) {
+                        remesh();
+                } else {
+                        compute_tangents();
+                }
+                if (trajectory) {
+                        trajectory->offer(sim_time, h, positions, tangents);
+                }
+                if (checkpoint_every > 0 && ++steps_since_checkpoint >= checkpoint_every) {
+                        steps_since_checkpoint = 0;
+                        save_checkpoint(checkpoint_path);
+                }
+        }
+
+        void VortexKnotSystem::set_checkpointing(const std::string& path, size_t every) {
+                if (every > 0 && path.empty()) {
+                        throw std::invalid_argument("set_checkpointing: path must not be empty");
+                }
+                checkpoint_path = path;
+                checkpoint_every = every;
+                steps_since_checkpoint = 0;
+        }
+
+        void VortexKnotSystem::save_checkpoint(const std::string& path) const {
+                SnapshotWriter out(SnapshotKind::VortexKnotSystem);
+                out.f64(circulation);
+                out.f64(sim_time);
+                out.points(positions);
+                out.points(tangents);
+                integrator.save_state(out);
+                out.u64(static_cast<std::uint64_t>(induction.mode));
+                out.f64(induction.core_radius);
+                out.f64(induction.core_delta);
+                out.u64(induction.local_window);
+                out.u64(induction.far_field_interval);
+                out.f64(induction.near_radius);
+                out.f64(induction.far_field_tolerance);
+                out.u64(induction.max_far_field_interval);
+                out.points(far_velocity);
+                multirate.save_state(out);
+                out.boolean(far_field_stale);
+                out.u64(steps_since_far_field);
+                out.f64(remesh_options.target_spacing);
+                out.f64(remesh_options.max_turn_angle);
+                out.f64(remesh_options.min_spacing);
+                out.f64(remesh_options.max_spacing);
+                out.u64(remesh_options.min_points);
+                out.u64(remesh_options.max_points);
+                out.u64(remesh_every);
+                out.u64(steps_since_remesh);
+                out.f64(remesh_spacing);
+                out.u64(remesh_max_points);
+                out.str(checkpoint_path);
+                out.u64(checkpoint_every);
+                out.u64(steps_since_checkpoint);
+                out.commit(path);
+        }
+
+        void VortexKnotSystem::load_checkpoint(const std::string& path) {
+                SnapshotReader in(path, SnapshotKind::VortexKnotSystem);
+                circulation = in.f64();
+                sim_time = in.f64();
+                positions = in.points();
+                tangents = in.points();
+                integrator.load_state(in);
+                const std::uint64_t mode = in.u64();
+                if (mode > static_cast<std::uint64_t>(InductionMode::MultiRate)) {
+                        throw std::runtime_error("load_checkpoint: unknown induction mode in '" + path + "'");
+                }
+                induction.mode = static_cast<InductionMode>(mode);
+                induction.core_radius = in.f64();
+                induction.core_delta = in.f64();
+                induction.local_window = in.u64();
+                induction.far_field_interval = in.u64();
+                induction.near_radius = in.f64();
+                induction.far_field_tolerance = in.f64();
+                induction.max_far_field_interval = in.u64();
+                far_velocity = in.points();
+                multirate.load_state(in);
+                far_field_stale = in.boolean();
+                steps_since_far_field = in.u64();
+                remesh_options.target_spacing = in.f64();
+                remesh_options.max_turn_angle = in.f64();
+                remesh_options.min_spacing = in.f64();
+                remesh_options.max_spacing = in.f64();
+                remesh_options.min_points = in.u64();
+                remesh_options.max_points = in.u64();
+                remesh_every = in.u64();
+                steps_since_remesh = in.u64();
+                remesh_spacing = in.f64();
+                remesh_max_points = in.u64();
+                checkpoint_path = in.str();
+                checkpoint_every = in.u64();
+                steps_since_checkpoint = in.u64();
+                in.finish();
+                trajectory.reset();
+        }
+
+        VortexKnotSystem VortexKnotSystem::from_checkpoint(const std::string& path) {
+                VortexKnotSystem system;
+                system.load_checkpoint(path);
+                return system;
+        }
+
+        void VortexKnotSystem::attach_trajectory(std::shared_ptr<TrajectoryWriter> writer) {
+                // The writer's point count is fixed: refuse up front rather than
+                // throw from evolve() with the state half advanced.
+                if (writer && remesh_every > 0) {
+                        throw std::invalid_argument(
+                                "attach_trajectory: remeshing is enabled and would change the point count; "
+                                "call set_remeshing(..., 0) first");
+                }
+                trajectory = std::move(writer);
+                if (trajectory) {
+                        trajectory->record(sim_time, 0.0, positions, tangents);
+                }
+        }
+
+        double VortexKnotSystem::get_time() const {
+                return sim_time;
+        }
+
+        void VortexKnotSystem::induced_velocity(const std::vector<Vec3>& X, std::vector<Vec3>& v) {
+                switch (induction.mode) {
+                case InductionMode::LocalInduction:
+                        local_induction_velocities(X, true, circulation, induction.core_radius,
+                                                   induction.core_delta, 0, v);
+                        return;
+                case InductionMode::Hybrid:
+                        if (far_field_stale || induction.far_field_interval == 0 || far_velocity.size() != X.size()) {
+                                closed_tangents(X, stage_tangents);
+                                far_field_velocities(X, stage_tangents, circulation, induction.local_window, true,
+                                                     far_velocity);
+                                far_field_stale = false;
+                        }
+                        local_induction_velocities(X, true, circulation, induction.core_radius,
+                                                   induction.core_delta, induction.local_window, v);
+                        for (size_t i = 0; i < v.size(); ++i) {
+                                for (int d = 0; d < 3; ++d) v[i][d] += far_velocity[i][d];
+                        }
+                        return;
+                case InductionMode::MultiRate:
+                        closed_tangents(X, stage_tangents);
+                        if (far_field_stale || induction.far_field_interval == 0 || !multirate.ready(X.size())) {
+                                multirate.refresh(X, stage_tangents, circulation, induction.near_radius);
+                                far_field_stale = false;
+                        }
+                        multirate.velocities(X, stage_tangents, circulation, v);
+                        return;
+                case InductionMode::BiotSavart:
+                default:
+                        closed_tangents(X, stage_tangents);
+                        BiotSavart::self_velocities(X, stage_tangents, circulation, v);
+                        return;
+                }
+        }
+
+        void VortexKnotSystem::set_induction(const InductionOptions& options) {
+                if (!(options.core_radius > 0.0)) {
+                        throw std::invalid_argument("set_induction: core_radius must be positive");
+                }
+                if (options.mode == InductionMode::Hybrid && options.local_window == 0) {
+                        throw std::invalid_argument("set_induction: hybrid mode needs local_window >= 1");
+                }
+                if (options.near_radius < 0.0 || options.far_field_tolerance < 0.0) {
+                        throw std::invalid_argument("set_induction: near_radius and far_field_tolerance must be >= 0");
+                }
+                induction = options;
+                multirate.set_schedule(options.far_field_interval, options.far_field_tolerance,
+                                       options.max_far_field_interval);
+                multirate.reset();
+                far_field_stale = true;
+                steps_since_far_field = 0;
+                integrator.invalidate();
+        }
+
+        const MultiRateBiotSavart& VortexKnotSystem::get_multirate_state() const {
+                return multirate;
+        }
+
+        const InductionOptions& VortexKnotSystem::get_induction_options() const {
+                return induction;
+        }
+
+        void VortexKnotSystem::set_remeshing(const RemeshOptions& options, size_t every) {
+                if (every > 0 && trajectory) {
+                        throw std::invalid_argument(
+                                "set_remeshing: a trajectory is attached and has a fixed point count; "
+                                "detach it with attach_trajectory(nullptr) first");
+                }
+                remesh_options = options;
+                remesh_every = every;
+                steps_since_remesh = 0;
+                remesh_spacing = 0.0;
+                remesh_max_points = 0;
+        }
+
+        const RemeshOptions& VortexKnotSystem::get_remesh_options() const {
+                return remesh_options;
+        }
+
+        size_t VortexKnotSystem::get_remesh_interval() const {
+                return remesh_every;
+        }
+
+        RemeshReport VortexKnotSystem::remesh() {
+                if (trajectory) {
+                        throw std::runtime_error("remesh: a trajectory is attached and has a fixed point count");
+                }
+                if (remesh_spacing <= 0.0 && positions.size() >= 4) {
+                        double length = 0.0;
                         for (size_t i = 0; i < positions.size(); ++i) {
-                                Vec3 v = biot_savart_velocity(positions[i], positions, tangents, circulation);
-                                for (int d = 0; d < 3; ++d) {
-                                        new_positions[i][d] += dt * v[d];
-                                }
+                                const Vec3& a = positions[i];
+                                const Vec3& b = positions[(i + 1) % positions.size()];
+                                length += std::sqrt((b[0] - a[0]) * (b[0] - a[0]) +
+                                                    (b[1] - a[1]) * (b[1] - a[1]) +
+                                                    (b[2] - a[2]) * (b[2] - a[2]));
                         }
-                        positions = new_positions;
-                        compute_tangents();
+                        remesh_spacing = length / static_cast<double>(positions.size());
+                        remesh_max_points = 4 * positions.size();
                 }
+                RemeshOptions options = remesh_options;
+                if (options.target_spacing <= 0.0) options.target_spacing = remesh_spacing;
+                if (options.max_points == 0) options.max_points = remesh_max_points;
+                RemeshReport report = remesh_closed_curve(positions, remesh_buffer, options);
+                positions.swap(remesh_buffer);
+                compute_tangents();
+                integrator.invalidate();
+                far_field_stale = true;
+                multirate.clear();
+                steps_since_remesh = 0;
+                return report;
+        }
+
+        void VortexKnotSystem::set_integrator(const IntegratorOptions& options) {
+                integrator.set_options(options);
+        }
+
+        const IntegratorOptions& VortexKnotSystem::get_integrator_options() const {
+                return integrator.options();
+        }
+
+        const IntegratorStats& VortexKnotSystem::get_integrator_stats() const {
+                return integrator.stats();
         }
 
         const std::vector<Vec3>& VortexKnotSystem::get_positions() const {
@@ -1125,6 +1462,7 @@ sst::FourierKnot::parse_ideal_txt_multi(const std::string& path) {
 
 std::vector<sst::FourierKnot::IdealABBlock>
 sst::FourierKnot::parse_ideal_txt_from_string(const std::string& content) {
+    SST_PROFILE_SCOPE("parse.ideal_txt");
     using AB = sst::FourierKnot::IdealABBlock;
     std::vector<AB> out;
 
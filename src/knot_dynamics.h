@@ -7,6 +7,10 @@
 
 #include "../include/SST_Constants.h"
 #include "../include/vec3_utils.h"
+#include "ode_integrators.h"
+#include "filament_remesh.h"
+#include "local_induction.h"
+#include "trajectory_writer.h"
 #ifndef M_PI
 #define M_PI SST::Constants::pi
 #endif
@@ -15,6 +19,9 @@
 
 #include <vector>
 #include <array>
+#include <functional>
+#include <memory>
+#include <span>
 #include <string>
 #include <stdexcept>
 #include <tuple>
@@ -47,24 +54,24 @@ namespace sst {
         public:
                 // Compute writhe from filament centerline
                 // Ref: Călugăreanu-White formula (approximated)
-                static double compute_writhe(const std::vector<Vec3>& centerline);
+                static double compute_writhe(std::span<const Vec3> centerline);
 
                 // Compute linking number between two vortex filaments
-                static int compute_linking_number(const std::vector<Vec3>& curve1, const std::vector<Vec3>& curve2);
+                static int compute_linking_number(std::span<const Vec3> curve1, std::span<const Vec3> curve2);
 
                 // Compute twist given tangent and normal
                 // Twist = ∫ (T × dN/ds) ⋅ B ds
-                static double compute_twist(const std::vector<Vec3>& T, const std::vector<Vec3>& B);
+                static double compute_twist(std::span<const Vec3> T, std::span<const Vec3> B);
 
                 // Compute centerline helicity invariant H_cl
                 // H_cl = Lk + Wr, combines link and writhe
-                static double compute_centerline_helicity(const std::vector<Vec3>& curve,
-                                                                           const std::vector<Vec3>& tangent);
+                static double compute_centerline_helicity(std::span<const Vec3> curve,
+                                                                           std::span<const Vec3> tangent);
 
                 // Check for reconnection events
                 // Returns indices of close approach
                 static std::vector<std::pair<int, int>> detect_reconnection_candidates(
-                        const std::vector<Vec3>& curve, double threshold);
+                        std::span<const Vec3> curve, double threshold);
 
                 // Fourier series evaluation (from heavy_knot)
                 struct FourierResult {
@@ -99,25 +106,25 @@ namespace sst {
                 // Biot-Savart and helicity calculations (wrappers for BiotSavart)
                 // Compute Biot-Savart velocity field from a closed curve at grid points
                 static std::vector<Vec3> compute_biot_savart_velocity_grid(
-                        const std::vector<Vec3>& curve,
-                        const std::vector<Vec3>& grid_points);
+                        std::span<const Vec3> curve,
+                        std::span<const Vec3> grid_points);
 
                 // Compute vorticity from velocity field on a regular grid
                 static std::vector<Vec3> compute_vorticity_grid(
-                        const std::vector<Vec3>& velocity,
+                        std::span<const Vec3> velocity,
                         const std::array<int, 3>& shape,
                         double spacing);
 
                 // Extract cubic interior field subset
                 static std::vector<Vec3> extract_interior_field(
-                        const std::vector<Vec3>& field,
+                        std::span<const Vec3> field,
                         const std::array<int, 3>& shape,
                         int margin);
 
                 // Compute helicity invariants (H_charge, H_mass, a_mu)
                 static std::tuple<double, double, double> compute_helicity_invariants(
-                        const std::vector<Vec3>& v_sub,
-                        const std::vector<Vec3>& w_sub,
+                        std::span<const Vec3> v_sub,
+                        std::span<const Vec3> w_sub,
                         const std::vector<double>& r_sq);
 
                 // High-level method: compute helicity from Fourier block
@@ -274,7 +281,60 @@ namespace sst {
                 // Searches in standard locations for knot_fseries directory
                 void initialize_knot_from_name(const std::string& knot_id, size_t resolution = 1000);
 
-                void evolve(double dt, size_t steps);
+                // Advance by `steps` steps of dt with the configured integrator
+                // (forward Euler by default). Adaptive schemes cover dt*steps with
+                // their own sub-steps; tangents are rebuilt from every stage.
+                // interrupt_callback runs after every accepted step and may throw
+                // to abort; the call is then pending and resume_evolve() finishes it.
+                void evolve(double dt, size_t steps, std::function<void()> interrupt_callback = nullptr);
+
+                void set_integrator(const IntegratorOptions& options);
+                [[nodiscard]] const IntegratorOptions& get_integrator_options() const;
+                [[nodiscard]] const IntegratorStats& get_integrator_stats() const;
+
+                // Velocity model: full Biot–Savart (default), LIA, LIA plus a
+                // far-field Biot–Savart term refreshed every m steps, or the
+                // multi-rate split (exact near pairs, far field every m steps with
+                // m adapted to far_field_tolerance).
+                void set_induction(const InductionOptions& options);
+                [[nodiscard]] const InductionOptions& get_induction_options() const;
+                // Multi-rate mode: current refresh interval, last drift, near pairs.
+                [[nodiscard]] const MultiRateBiotSavart& get_multirate_state() const;
+
+                // Remesh every `every` accepted integrator steps (0 disables).
+                // Defaulted spacing/point bounds are resolved from the state at
+                // the first remesh and then kept, so N cannot ratchet upward.
+                // Throws while a trajectory is attached (unless every == 0).
+                void set_remeshing(const RemeshOptions& options, size_t every);
+                [[nodiscard]] const RemeshOptions& get_remesh_options() const;
+                [[nodiscard]] size_t get_remesh_interval() const;
+                // Redistribute points now (spline + curvature monitor); N may change,
+                // so this throws while a trajectory is attached.
+                RemeshReport remesh();
+
+                // Stream frames to `writer` from evolve() (every writer->options().every
+                // accepted steps); the current state is written immediately as the
+                // first frame. The writer has a fixed N, so this throws while
+                // remeshing is enabled. nullptr detaches.
+                void attach_trajectory(std::shared_ptr<TrajectoryWriter> writer);
+                // Simulated time accumulated by evolve() since initialisation.
+                [[nodiscard]] double get_time() const;
+
+                // Full solver state (positions, integrator progress and FSAL data,
+                // induction cache, remesh and checkpoint counters, config) as a
+                // versioned snapshot; see checkpoint.h. An attached trajectory
+                // writer is not part of the state.
+                void save_checkpoint(const std::string& path) const;
+                void load_checkpoint(const std::string& path);
+                static VortexKnotSystem from_checkpoint(const std::string& path);
+                // Snapshot to `path` every `every` accepted steps inside evolve() (0 disables).
+                void set_checkpointing(const std::string& path, size_t every);
+                // A snapshot taken inside evolve() records the unfinished call;
+                // resume_evolve() completes it bit-identically to the original run.
+                [[nodiscard]] bool has_pending_evolve() const;
+                void resume_evolve(std::function<void()> interrupt_callback = nullptr);
+                // Position inside the running (or pending) evolve() call.
+                [[nodiscard]] const IntegratorProgress& get_evolve_progress() const;
 
                 [[nodiscard]] const std::vector<Vec3>& get_positions() const;
                 [[nodiscard]] const std::vector<Vec3>& get_tangents() const;
@@ -283,30 +343,56 @@ namespace sst {
                 std::vector<Vec3> positions;
                 std::vector<Vec3> tangents;
                 double circulation;
+                double sim_time = 0.0;
+                std::shared_ptr<TrajectoryWriter> trajectory;
+
+                CurveIntegrator integrator;
+                std::vector<Vec3> stage_tangents;  // scratch for RHS evaluations
+
+                InductionOptions induction;
+                std::vector<Vec3> far_velocity;     // hybrid: cached far-field term
+                MultiRateBiotSavart multirate;      // multirate: frozen near pairs + cached far field
+                bool far_field_stale = true;
+                size_t steps_since_far_field = 0;
+
+                RemeshOptions remesh_options;
+                size_t remesh_every = 0;
+                size_t steps_since_remesh = 0;
+                double remesh_spacing = 0.0;     // resolved default target_spacing
+                size_t remesh_max_points = 0;    // resolved default max_points
+                std::vector<Vec3> remesh_buffer;
+
+                std::string checkpoint_path;
+                size_t checkpoint_every = 0;
+                size_t steps_since_checkpoint = 0;
+
+                void after_step(double h);
 
                 void compute_tangents();
+                void induced_velocity(const std::vector<Vec3>& X, std::vector<Vec3>& v);
+                static void closed_tangents(const std::vector<Vec3>& X, std::vector<Vec3>& T);
                 static std::string find_knot_file(const std::string& knot_id);
         };
 
-        inline double compute_writhe(const std::vector<Vec3>& centerline) {
+        inline double compute_writhe(std::span<const Vec3> centerline) {
                 return KnotDynamics::compute_writhe(centerline);
         }
 
-        inline int compute_linking_number(const std::vector<Vec3>& curve1, const std::vector<Vec3>& curve2) {
+        inline int compute_linking_number(std::span<const Vec3> curve1, std::span<const Vec3> curve2) {
                 return KnotDynamics::compute_linking_number(curve1, curve2);
         }
 
-        inline double compute_twist(const std::vector<Vec3>& T, const std::vector<Vec3>& B) {
+        inline double compute_twist(std::span<const Vec3> T, std::span<const Vec3> B) {
                 return KnotDynamics::compute_twist(T, B);
         }
 
-        inline double compute_centerline_helicity(const std::vector<Vec3>& curve,
-                                                                           const std::vector<Vec3>& tangent) {
+        inline double compute_centerline_helicity(std::span<const Vec3> curve,
+                                                                           std::span<const Vec3> tangent) {
                 return KnotDynamics::compute_centerline_helicity(curve, tangent);
         }
 
         inline std::vector<std::pair<int, int>> detect_reconnection_candidates(
-                        const std::vector<Vec3>& curve, double threshold) {
+                        std::span<const Vec3> curve, double threshold) {
                 return KnotDynamics::detect_reconnection_candidates(curve, threshold);
         }
 
@@ -3,6 +3,7 @@
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
 #include "knot_dynamics.h"
+#include "vec3_numpy.h"
 
 namespace py = pybind11;
 using sst::FourierBlock;
@@ -19,19 +20,10 @@ static void _check_1d_same_len(const py::array &a, const py::array &b, const cha
 }
 
 static std::vector<Vec3> to_vec3(
-    py::array_t<double, py::array::c_style | py::array::forcecast> arr)
+    py::array_t<double, py::array::c_style | py::array::forcecast> arr, const char* ctx)
 {
-  if (arr.ndim() != 2 || arr.shape(1) != 3)
-    throw std::invalid_argument("pd_from_curve: expected array with shape (N,3)");
-
-  const py::ssize_t N = arr.shape(0);
-  std::vector<Vec3> out(static_cast<std::size_t>(N));
-
-  auto buf = arr.unchecked<2>();
-  for (py::ssize_t i = 0; i < N; ++i) {
-    out[static_cast<std::size_t>(i)] = { buf(i,0), buf(i,1), buf(i,2) };
-  }
-  return out;
+  auto rows = sst::as_vec3_span(arr, ctx);
+  return {rows.begin(), rows.end()};
 }
 
 void bind_knot(py::module_& m) {
@@ -64,7 +56,7 @@ void bind_knot(py::module_& m) {
 
   py::class_<FourierKnot>(m, "fourier_knot")
       .def(py::init<>())
-      .def("loadBlocks", &FourierKnot::loadBlocks)
+      .def("loadBlocks", &FourierKnot::loadBlocks, py::call_guard<py::gil_scoped_release>())
       .def("selectMaxHarmonics", &FourierKnot::selectMaxHarmonics)
       .def("reconstruct", &FourierKnot::reconstruct)
       .def_readwrite("points", &FourierKnot::points)
@@ -103,12 +95,13 @@ void bind_knot(py::module_& m) {
 
   m.def("length_exact",
         &FourierKnot::length_exact,
-        py::arg("block"), py::arg("nsamples") = 4096,
+        py::arg("block"), py::arg("nsamples") = 4096, py::call_guard<py::gil_scoped_release>(),
         "Compute exact length of Fourier curve by sampling.");
 
   m.def("bending_energy_exact",
         &FourierKnot::bending_energy_exact,
         py::arg("block"), py::arg("nsamples") = 4096, py::arg("eps") = 1e-12,
+        py::call_guard<py::gil_scoped_release>(),
         "Compute bending energy integral of Fourier curve.");
 
   m.def("mode_energies",
@@ -118,12 +111,13 @@ void bind_knot(py::module_& m) {
 
   m.def("min_self_distance_sampled",
         &FourierKnot::min_self_distance_sampled,
-        py::arg("points"), py::arg("exclude_window") = 4,
+        py::arg("points"), py::arg("exclude_window") = 4, py::call_guard<py::gil_scoped_release>(),
         "Compute minimum self-distance of a closed polygonal curve.");
 
   m.def("min_self_distance_exactish",
         &FourierKnot::min_self_distance_exactish,
         py::arg("block"), py::arg("nsamples") = 2048, py::arg("exclude_window") = 4,
+        py::call_guard<py::gil_scoped_release>(),
         "Estimate minimum self-distance of Fourier curve via sampling.");
 
   py::class_<FourierKnot::GeometricDescriptors>(m, "GeometricDescriptors")
@@ -136,6 +130,7 @@ void bind_knot(py::module_& m) {
   m.def("describe_fourier_block",
         &FourierKnot::describe_fourier_block,
         py::arg("block"), py::arg("nsamples") = 2048, py::arg("exclude_window") = 4,
+        py::call_guard<py::gil_scoped_release>(),
         "Compute geometric descriptors (length, bending energy, self-distance, writhe, mode energies) for a Fourier block.");
 
   m.def("fourier_knot_eval",
@@ -170,7 +165,11 @@ void bind_knot(py::module_& m) {
           auto sraw=s.unchecked<1>();
           for(py::ssize_t i=0;i<s.shape(0);++i) S.push_back(sraw(i));
 
-          std::vector<Vec3> P = sst::FourierKnot::evaluate(blk, S);
+          std::vector<Vec3> P;
+          {
+            py::gil_scoped_release release;
+            P = sst::FourierKnot::evaluate(blk, S);
+          }
 
           py::array_t<double> x(s.shape(0)), y(s.shape(0)), z(s.shape(0));
           auto xr=x.mutable_unchecked<1>();
@@ -191,34 +190,36 @@ void bind_knot(py::module_& m) {
       .def_readonly("positions", &KnotDynamics::FourierResult::positions)
       .def_readonly("tangents", &KnotDynamics::FourierResult::tangents);
 
-  m.def("compute_writhe", &sst::KnotDynamics::compute_writhe, R"pbdoc(
+  m.def("compute_writhe", &sst::KnotDynamics::compute_writhe, py::call_guard<py::gil_scoped_release>(), R"pbdoc(
         Compute the writhe of a closed filament (topological self-linking).
     )pbdoc");
 
-  m.def("compute_linking_number", &sst::KnotDynamics::compute_linking_number, R"pbdoc(
+  m.def("compute_linking_number", &sst::KnotDynamics::compute_linking_number, py::call_guard<py::gil_scoped_release>(), R"pbdoc(
         Compute the Gauss linking number between two closed loops.
     )pbdoc");
 
-  m.def("compute_twist", &sst::KnotDynamics::compute_twist, R"pbdoc(
+  m.def("compute_twist", &sst::KnotDynamics::compute_twist, py::call_guard<py::gil_scoped_release>(), R"pbdoc(
         Compute twist from Frenet frames along a filament.
     )pbdoc");
 
-  m.def("compute_centerline_helicity", &sst::KnotDynamics::compute_centerline_helicity, R"pbdoc(
+  m.def("compute_centerline_helicity", &sst::KnotDynamics::compute_centerline_helicity,
+        py::call_guard<py::gil_scoped_release>(), R"pbdoc(
         Compute the centerline helicity as the sum of writhe and twist.
     )pbdoc");
 
-  m.def("detect_reconnection_candidates", &sst::KnotDynamics::detect_reconnection_candidates, R"pbdoc(
+  m.def("detect_reconnection_candidates", &sst::KnotDynamics::detect_reconnection_candidates,
+        py::call_guard<py::gil_scoped_release>(), R"pbdoc(
         Detect pairs of points on the filament that approach closely enough to be candidates for reconnection.
     )pbdoc");
 
   m.def("evaluate_fourier_series", &KnotDynamics::evaluate_fourier_series,
         "Evaluate a Fourier series for positions and tangents");
 
-  m.def("writhe_gauss_curve", &KnotDynamics::writhe_gauss_curve,
+  m.def("writhe_gauss_curve", &KnotDynamics::writhe_gauss_curve, py::call_guard<py::gil_scoped_release>(),
         "Compute writhe via Gauss integral");
 
   m.def("estimate_crossing_number", &KnotDynamics::estimate_crossing_number,
-        py::arg("r"), py::arg("directions") = 24, py::arg("seed") = 12345,
+        py::arg("r"), py::arg("directions") = 24, py::arg("seed") = 12345, py::call_guard<py::gil_scoped_release>(),
         "Estimate crossing number from projections");
 
   m.def("pd_from_curve",
@@ -226,12 +227,12 @@ void bind_knot(py::module_& m) {
           std::vector<Vec3> P3;
           if (py::isinstance<py::array>(P3_like)) {
             auto arr = P3_like.cast<py::array_t<double, py::array::c_style | py::array::forcecast>>();
-            P3 = to_vec3(arr);
+            P3 = to_vec3(arr, "pd_from_curve");
           } else {
             P3 = P3_like.cast<std::vector<Vec3>>();
           }
-          KnotDynamics::PD pd = KnotDynamics::pd_from_curve(P3, tries, seed, min_angle_deg, depth_tol);
-          return pd;
+          py::gil_scoped_release release;
+          return KnotDynamics::pd_from_curve(P3, tries, seed, min_angle_deg, depth_tol);
         },
         py::arg("P3"), py::arg("tries")=40, py::arg("seed")=12345, py::arg("min_angle_deg")=1.0, py::arg("depth_tol")=1e-6,
         R"pbdoc(
@@ -239,27 +240,13 @@ Compute a PD code from a closed 3D polygonal curve.
 )pbdoc");
 
   m.def("compute_biot_savart_velocity_grid",
-        [](py::object curve_like, py::object grid_like) {
-          std::vector<Vec3> curve, grid;
-          if (py::isinstance<py::array>(curve_like)) {
-            curve = to_vec3(curve_like.cast<py::array_t<double, py::array::c_style | py::array::forcecast>>());
-          } else {
-            curve = curve_like.cast<std::vector<Vec3>>();
-          }
-          if (py::isinstance<py::array>(grid_like)) {
-            grid = to_vec3(grid_like.cast<py::array_t<double, py::array::c_style | py::array::forcecast>>());
-          } else {
-            grid = grid_like.cast<std::vector<Vec3>>();
-          }
-          std::vector<Vec3> result = KnotDynamics::compute_biot_savart_velocity_grid(curve, grid);
-          py::array_t<double> out({(py::ssize_t)result.size(), (py::ssize_t)3});
-          auto o = out.mutable_unchecked<2>();
-          for (size_t i = 0; i < result.size(); ++i) {
-            o((py::ssize_t)i, 0) = result[i][0];
-            o((py::ssize_t)i, 1) = result[i][1];
-            o((py::ssize_t)i, 2) = result[i][2];
+        [](std::span<const Vec3> curve, std::span<const Vec3> grid) {
+          std::vector<Vec3> result;
+          {
+            py::gil_scoped_release release;
+            result = KnotDynamics::compute_biot_savart_velocity_grid(curve, grid);
           }
-          return out;
+          return sst::vec3_array(std::move(result));
         },
         py::arg("curve"), py::arg("grid_points"),
         R"pbdoc(Compute Biot-Savart velocity field from a closed curve at grid points.)pbdoc");
@@ -267,16 +254,13 @@ Compute a PD code from a closed 3D polygonal curve.
   m.def("compute_vorticity_grid",
         [](py::array_t<double, py::array::c_style | py::array::forcecast> velocity,
            std::array<int, 3> shape, double spacing) {
-          std::vector<Vec3> vel = to_vec3(velocity);
-          std::vector<Vec3> result = KnotDynamics::compute_vorticity_grid(vel, shape, spacing);
-          py::array_t<double> out({(py::ssize_t)result.size(), (py::ssize_t)3});
-          auto o = out.mutable_unchecked<2>();
-          for (size_t i = 0; i < result.size(); ++i) {
-            o((py::ssize_t)i, 0) = result[i][0];
-            o((py::ssize_t)i, 1) = result[i][1];
-            o((py::ssize_t)i, 2) = result[i][2];
+          auto vel = sst::as_vec3_span(velocity, "compute_vorticity_grid");
+          std::vector<Vec3> result;
+          {
+            py::gil_scoped_release release;
+            result = KnotDynamics::compute_vorticity_grid(vel, shape, spacing);
           }
-          return out;
+          return sst::vec3_array(std::move(result));
         },
         py::arg("velocity"), py::arg("shape"), py::arg("spacing"),
         R"pbdoc(Compute vorticity from velocity field on a regular grid.)pbdoc");
@@ -284,16 +268,8 @@ Compute a PD code from a closed 3D polygonal curve.
   m.def("extract_interior_field",
         [](py::array_t<double, py::array::c_style | py::array::forcecast> field,
            std::array<int, 3> shape, int margin) {
-          std::vector<Vec3> f = to_vec3(field);
-          std::vector<Vec3> result = KnotDynamics::extract_interior_field(f, shape, margin);
-          py::array_t<double> out({(py::ssize_t)result.size(), (py::ssize_t)3});
-          auto o = out.mutable_unchecked<2>();
-          for (size_t i = 0; i < result.size(); ++i) {
-            o((py::ssize_t)i, 0) = result[i][0];
-            o((py::ssize_t)i, 1) = result[i][1];
-            o((py::ssize_t)i, 2) = result[i][2];
-          }
-          return out;
+          auto f = sst::as_vec3_span(field, "extract_interior_field");
+          return sst::vec3_array(KnotDynamics::extract_interior_field(f, shape, margin));
         },
         py::arg("field"), py::arg("shape"), py::arg("margin"),
         R"pbdoc(Extract cubic interior field subset.)pbdoc");
@@ -302,8 +278,8 @@ Compute a PD code from a closed 3D polygonal curve.
         [](py::array_t<double, py::array::c_style | py::array::forcecast> v_sub,
            py::array_t<double, py::array::c_style | py::array::forcecast> w_sub,
            py::array_t<double, py::array::c_style | py::array::forcecast> r_sq) {
-          std::vector<Vec3> v = to_vec3(v_sub);
-          std::vector<Vec3> w = to_vec3(w_sub);
+          auto v = sst::as_vec3_span(v_sub, "compute_helicity_invariants");
+          auto w = sst::as_vec3_span(w_sub, "compute_helicity_invariants");
           if (r_sq.ndim() != 1 || r_sq.shape(0) != (py::ssize_t)v.size()) {
             throw std::invalid_argument("r_sq must be 1D with same length as v_sub/w_sub");
           }
@@ -312,7 +288,12 @@ Compute a PD code from a closed 3D polygonal curve.
           for (py::ssize_t i = 0; i < r_sq.shape(0); ++i) {
             r_sq_vec.push_back(r_sq_raw(i));
           }
-          auto [H_charge, H_mass, a_mu] = KnotDynamics::compute_helicity_invariants(v, w, r_sq_vec);
+          std::tuple<double, double, double> inv;
+          {
+            py::gil_scoped_release release;
+            inv = KnotDynamics::compute_helicity_invariants(v, w, r_sq_vec);
+          }
+          auto [H_charge, H_mass, a_mu] = inv;
           return py::make_tuple(H_charge, H_mass, a_mu);
         },
         py::arg("v_sub"), py::arg("w_sub"), py::arg("r_sq"),
@@ -321,8 +302,13 @@ Compute a PD code from a closed 3D polygonal curve.
   m.def("compute_helicity_from_fourier_block",
         [](const FourierBlock& block,
            int grid_size, double spacing, int interior_margin, int nsamples) {
-          auto [H_charge, H_mass, a_mu] = KnotDynamics::compute_helicity_from_fourier_block(
-              block, grid_size, spacing, interior_margin, nsamples);
+          std::tuple<double, double, double> inv;
+          {
+            py::gil_scoped_release release;
+            inv = KnotDynamics::compute_helicity_from_fourier_block(
+                block, grid_size, spacing, interior_margin, nsamples);
+          }
+          auto [H_charge, H_mass, a_mu] = inv;
           return py::make_tuple(H_charge, H_mass, a_mu);
         },
         py::arg("block"), py::arg("grid_size") = 32, py::arg("spacing") = 0.1,
@@ -331,8 +317,12 @@ Compute a PD code from a closed 3D polygonal curve.
 
   m.def("compute_curvature",
         [](py::array_t<double, py::array::c_style | py::array::forcecast> pts, double eps) {
-          std::vector<Vec3> points = to_vec3(pts);
-          std::vector<double> result = FourierKnot::curvature(points, eps);
+          std::vector<Vec3> points = to_vec3(pts, "compute_curvature");
+          std::vector<double> result;
+          {
+            py::gil_scoped_release release;
+            result = FourierKnot::curvature(points, eps);
+          }
           py::array_t<double> out((py::ssize_t)result.size());
           auto o = out.mutable_unchecked<1>();
           for (size_t i = 0; i < result.size(); ++i) {
@@ -406,15 +396,7 @@ Compute a PD code from a closed 3D polygonal curve.
           s.reserve(static_cast<size_t>(s_arr.shape(0)));
           auto sraw = s_arr.unchecked<1>();
           for (py::ssize_t i = 0; i < s_arr.shape(0); ++i) s.push_back(sraw(i));
-          auto pts = sst::FourierKnot::evaluate_ideal_component(comp, s);
-          py::array_t<double> out({(py::ssize_t)pts.size(), (py::ssize_t)3});
-          auto o = out.mutable_unchecked<2>();
-          for (size_t i = 0; i < pts.size(); ++i) {
-              o((py::ssize_t)i, 0) = pts[i][0];
-              o((py::ssize_t)i, 1) = pts[i][1];
-              o((py::ssize_t)i, 2) = pts[i][2];
-          }
-          return out;
+          return sst::vec3_array(sst::FourierKnot::evaluate_ideal_component(comp, s));
         },
         py::arg("component"), py::arg("s"),
         "Evaluate a single ideal AB component (includes I=0 offset).");
@@ -429,15 +411,8 @@ Compute a PD code from a closed 3D polygonal curve.
           for (py::ssize_t i = 0; i < s_arr.shape(0); ++i) s.push_back(sraw(i));
           auto all = sst::FourierKnot::evaluate_ideal_ab_components(ab, s);
           py::list result;
-          for (const auto& pts : all) {
-              py::array_t<double> out({(py::ssize_t)pts.size(), (py::ssize_t)3});
-              auto o = out.mutable_unchecked<2>();
-              for (size_t i = 0; i < pts.size(); ++i) {
-                  o((py::ssize_t)i, 0) = pts[i][0];
-                  o((py::ssize_t)i, 1) = pts[i][1];
-                  o((py::ssize_t)i, 2) = pts[i][2];
-              }
-              result.append(std::move(out));
+          for (auto& pts : all) {
+              result.append(sst::vec3_array(std::move(pts)));
           }
           return result;
         },
@@ -450,14 +425,7 @@ Compute a PD code from a closed 3D polygonal curve.
       .def_readonly("curvature", &FourierKnot::LoadedKnot::curvature)
       .def("get_points_array",
            [](const FourierKnot::LoadedKnot& knot) {
-             py::array_t<double> out({(py::ssize_t)knot.points.size(), (py::ssize_t)3});
-             auto o = out.mutable_unchecked<2>();
-             for (size_t i = 0; i < knot.points.size(); ++i) {
-               o((py::ssize_t)i, 0) = knot.points[i][0];
-               o((py::ssize_t)i, 1) = knot.points[i][1];
-               o((py::ssize_t)i, 2) = knot.points[i][2];
-             }
-             return out;
+             return sst::vec3_array(knot.points);
            },
            "Get points as NumPy array (N,3)")
       .def("get_curvature_array",
@@ -473,15 +441,58 @@ Compute a PD code from a closed 3D polygonal curve.
 
   m.def("load_all_knots",
         [](const std::vector<std::string>& paths, int nsamples) {
-          std::vector<FourierKnot::LoadedKnot> knots = FourierKnot::load_all_knots(paths, nsamples);
-          return knots;
+          return FourierKnot::load_all_knots(paths, nsamples);
         },
-        py::arg("paths"), py::arg("nsamples") = 1000,
+        py::arg("paths"), py::arg("nsamples") = 1000, py::call_guard<py::gil_scoped_release>(),
         R"pbdoc(Load all knots from a list of .fseries file paths.)pbdoc");
 
+  py::class_<sst::RemeshReport>(m, "RemeshReport",
+      R"pbdoc(Outcome of a closed-filament remesh: point counts, length and peak nodal curvature.)pbdoc")
+      .def_readonly("old_count", &sst::RemeshReport::old_count)
+      .def_readonly("new_count", &sst::RemeshReport::new_count)
+      .def_readonly("length", &sst::RemeshReport::length)
+      .def_readonly("max_curvature", &sst::RemeshReport::max_curvature)
+      .def("__repr__", [](const sst::RemeshReport& r) {
+             return "RemeshReport(old_count=" + std::to_string(r.old_count) +
+                    ", new_count=" + std::to_string(r.new_count) +
+                    ", length=" + std::to_string(r.length) + ")";
+           });
+
+  m.def("remesh_closed_curve",
+        [](py::array_t<double, py::array::c_style | py::array::forcecast> pts,
+           double target_spacing, double max_turn_angle, double min_spacing, double max_spacing,
+           std::size_t min_points, std::size_t max_points) {
+          sst::RemeshOptions o;
+          o.target_spacing = target_spacing;
+          o.max_turn_angle = max_turn_angle;
+          o.min_spacing = min_spacing;
+          o.max_spacing = max_spacing;
+          o.min_points = min_points;
+          o.max_points = max_points;
+          const std::vector<Vec3> in = to_vec3(pts, "remesh_closed_curve");
+          std::vector<Vec3> result;
+          sst::RemeshReport report;
+          {
+            py::gil_scoped_release release;
+            report = sst::remesh_closed_curve(in, result, o);
+          }
+          return py::make_tuple(sst::vec3_array(std::move(result)), report);
+        },
+        py::arg("points"), py::arg("target_spacing") = 0.0, py::arg("max_turn_angle") = 0.0,
+        py::arg("min_spacing") = 0.0, py::arg("max_spacing") = 0.0,
+        py::arg("min_points") = 8, py::arg("max_points") = 0,
+        R"pbdoc(Redistribute a closed (N,3) polyline along its periodic cubic spline.
+
+Local spacing h(s) = clamp(min(h0, max_turn_angle / kappa(s)), min_spacing, max_spacing), with
+h0 = target_spacing (0 -> mean spacing). Returns (points (M,3), RemeshReport).)pbdoc");
+
   py::class_<VortexKnotSystem, std::shared_ptr<VortexKnotSystem>>(m, "VortexKnotSystem")
       .def(py::init<double>(), py::arg("circulation") = 1.0,
            R"pbdoc(Initialize a VortexKnotSystem with optional circulation parameter.)pbdoc")
+      .def(py::init([](const std::string& checkpoint) { return VortexKnotSystem::from_checkpoint(checkpoint); }),
+           py::arg("checkpoint"),
+           R"pbdoc(Resume from a snapshot written by save_checkpoint() or set_checkpointing().
+If it was taken inside evolve(), call resume_evolve() to finish that call.)pbdoc")
       .def("initialize_trefoil_knot", &VortexKnotSystem::initialize_trefoil_knot,
            py::arg("resolution") = 400,
            R"pbdoc(Initialize a trefoil knot with given resolution.)pbdoc")
@@ -489,15 +500,113 @@ Compute a PD code from a closed 3D polygonal curve.
            py::arg("resolution") = 400,
            R"pbdoc(Initialize a figure-eight knot with given resolution.)pbdoc")
       .def("initialize_knot_from_name", &VortexKnotSystem::initialize_knot_from_name,
-           py::arg("knot_id"), py::arg("resolution") = 1000,
+           py::arg("knot_id"), py::arg("resolution") = 1000, py::call_guard<py::gil_scoped_release>(),
            R"pbdoc(Initialize any knot from bundled .fseries file by identifier.)pbdoc")
-      .def("evolve", &VortexKnotSystem::evolve,
-           py::arg("dt"), py::arg("steps"),
-           R"pbdoc(Evolve vortex knot using Biot–Savart dynamics.)pbdoc")
-      .def("get_positions", &VortexKnotSystem::get_positions,
-           py::return_value_policy::reference,
-           R"pbdoc(Get current 3D positions of the knot.)pbdoc")
-      .def("get_tangents", &VortexKnotSystem::get_tangents,
-           py::return_value_policy::reference,
-           R"pbdoc(Get current tangent vectors of the knot.)pbdoc");
+      .def("evolve",
+           [](VortexKnotSystem& self, double dt, size_t steps) { self.evolve(dt, steps); },
+           py::arg("dt"), py::arg("steps"), py::call_guard<py::gil_scoped_release>(),
+           R"pbdoc(Evolve vortex knot using Biot–Savart dynamics with the selected integrator.
+Runs without the GIL, so other Python threads proceed; do not call into the same system concurrently.)pbdoc")
+      .def("set_integrator",
+           [](VortexKnotSystem& self, const std::string& scheme, double rtol, double atol,
+              double dt_min, double dt_max, double safety, std::size_t max_steps) {
+             sst::IntegratorOptions o;
+             o.scheme = sst::parse_integrator_scheme(scheme);
+             o.rtol = rtol;
+             o.atol = atol;
+             o.dt_min = dt_min;
+             o.dt_max = dt_max;
+             o.safety = safety;
+             o.max_steps = max_steps;
+             self.set_integrator(o);
+           },
+           py::arg("scheme") = "euler", py::arg("rtol") = 1e-6, py::arg("atol") = 1e-9,
+           py::arg("dt_min") = 0.0, py::arg("dt_max") = 0.0, py::arg("safety") = 0.9,
+           py::arg("max_steps") = 1000000,
+           R"pbdoc(Select the time integrator: "euler" (default), "rk4", "rk45" (Dormand–Prince, adaptive) or "lsrk4" (low-storage).
+With "rk45", evolve(dt, steps) covers dt*steps using adaptive sub-steps controlled by rtol/atol.)pbdoc")
+      .def_property_readonly("integrator_scheme", [](const VortexKnotSystem& self) {
+             return std::string(sst::integrator_scheme_name(self.get_integrator_options().scheme));
+           })
+      .def("get_integrator_stats", &VortexKnotSystem::get_integrator_stats,
+           R"pbdoc(Counters of the integrator (RHS evaluations, accepted/rejected steps, last dt).)pbdoc")
+      .def("set_induction",
+           [](VortexKnotSystem& self, const std::string& mode, double core_radius, double core_delta,
+              std::size_t local_window, std::size_t far_field_interval, double near_radius,
+              double far_field_tolerance, std::size_t max_far_field_interval) {
+             sst::InductionOptions o;
+             o.mode = sst::parse_induction_mode(mode);
+             o.core_radius = core_radius;
+             o.core_delta = core_delta;
+             o.local_window = local_window;
+             o.far_field_interval = far_field_interval;
+             o.near_radius = near_radius;
+             o.far_field_tolerance = far_field_tolerance;
+             o.max_far_field_interval = max_far_field_interval;
+             self.set_induction(o);
+           },
+           py::arg("mode") = "biot_savart", py::arg("core_radius") = 1e-2, py::arg("core_delta") = 0.25,
+           py::arg("local_window") = 8, py::arg("far_field_interval") = 1, py::arg("near_radius") = 0.0,
+           py::arg("far_field_tolerance") = 1e-3, py::arg("max_far_field_interval") = 64,
+           R"pbdoc(Select the velocity model: "biot_savart" (default), "lia" (binormal flow v = beta kappa b with a curvature-radius cutoff, O(N)),
+"hybrid" (LIA within local_window segments plus far-field Biot–Savart refreshed every
+far_field_interval steps; 0 refreshes at every evaluation), or "multirate" (exact Biot–Savart
+over node pairs closer than near_radius, found with a cell list, plus the remaining far field
+cached for m steps; m starts at far_field_interval and adapts so the far-field drift stays near
+far_field_tolerance relative to max |v|, up to max_far_field_interval).)pbdoc")
+      .def("get_multirate_stats", [](const VortexKnotSystem& self) {
+             const auto& mr = self.get_multirate_state();
+             py::dict d;
+             d["interval"] = mr.interval();
+             d["drift"] = mr.last_drift();
+             d["near_radius"] = mr.radius();
+             d["near_pairs"] = mr.near_pairs();
+             return d;
+           },
+           R"pbdoc(Multi-rate monitor: current refresh interval m, last relative far-field drift, near radius and pair count.)pbdoc")
+      .def_property_readonly("induction_mode", [](const VortexKnotSystem& self) {
+             return std::string(sst::induction_mode_name(self.get_induction_options().mode));
+           })
+      .def("set_remeshing",
+           [](VortexKnotSystem& self, std::size_t every, double target_spacing, double max_turn_angle,
+              double min_spacing, double max_spacing, std::size_t min_points, std::size_t max_points) {
+             sst::RemeshOptions o;
+             o.target_spacing = target_spacing;
+             o.max_turn_angle = max_turn_angle;
+             o.min_spacing = min_spacing;
+             o.max_spacing = max_spacing;
+             o.min_points = min_points;
+             o.max_points = max_points;
+             self.set_remeshing(o, every);
+           },
+           py::arg("every"), py::arg("target_spacing") = 0.0, py::arg("max_turn_angle") = 0.0,
+           py::arg("min_spacing") = 0.0, py::arg("max_spacing") = 0.0,
+           py::arg("min_points") = 8, py::arg("max_points") = 0,
+           R"pbdoc(Remesh by arclength and curvature every `every` integrator steps (0 disables).
+Defaulted spacing (mean spacing) and max_points (4 N) are fixed at the first remesh.)pbdoc")
+      .def("remesh", &VortexKnotSystem::remesh, py::call_guard<py::gil_scoped_release>(),
+           R"pbdoc(Redistribute the filament points now; returns a RemeshReport.)pbdoc")
+      .def("attach_trajectory", &VortexKnotSystem::attach_trajectory, py::arg("writer"),
+           R"pbdoc(Record frames to a TrajectoryWriter during evolve() (None detaches). Writes the current state first;
+the writer has a fixed point count, so this raises ValueError while remeshing is enabled (and
+set_remeshing / remesh refuse while a writer is attached).)pbdoc")
+      .def("get_time", &VortexKnotSystem::get_time,
+           R"pbdoc(Simulated time accumulated by evolve() since initialisation.)pbdoc")
+      .def("save_checkpoint", &VortexKnotSystem::save_checkpoint, py::arg("path"),
+           py::call_guard<py::gil_scoped_release>(),
+           R"pbdoc(Write the full solver state (positions, integrator stages/progress, caches, config) to a snapshot.)pbdoc")
+      .def("load_checkpoint", &VortexKnotSystem::load_checkpoint, py::arg("path"))
+      .def("set_checkpointing", &VortexKnotSystem::set_checkpointing, py::arg("path"), py::arg("every"),
+           R"pbdoc(Snapshot to `path` every `every` accepted integrator steps during evolve() (0 disables).
+The file is replaced atomically, so it always holds the latest complete state.)pbdoc")
+      .def_property_readonly("has_pending_evolve", &VortexKnotSystem::has_pending_evolve)
+      .def("resume_evolve", [](VortexKnotSystem& self) { self.resume_evolve(); },
+           py::call_guard<py::gil_scoped_release>(),
+           R"pbdoc(Finish the evolve() call that was running when the loaded snapshot was taken.)pbdoc")
+      .def("get_positions",
+           [](const VortexKnotSystem& self) { return sst::vec3_array(self.get_positions()); },
+           R"pbdoc(Get current 3D positions of the knot as an (N,3) array (a snapshot; evolve() does not update it).)pbdoc")
+      .def("get_tangents",
+           [](const VortexKnotSystem& self) { return sst::vec3_array(self.get_tangents()); },
+           R"pbdoc(Get current tangent vectors of the knot as an (N,3) array.)pbdoc");
 }
\ No newline at end of file
@@ -0,0 +1,297 @@
+#include "local_induction.h"
+#include "biot_savart.h"
+#include "checkpoint.h"
+#include "frenet_helicity.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <stdexcept>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace sst {
+
+InductionMode parse_induction_mode(const std::string& name) {
+    std::string s = name;
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    if (s == "biot_savart" || s == "bs") return InductionMode::BiotSavart;
+    if (s == "lia" || s == "local") return InductionMode::LocalInduction;
+    if (s == "hybrid") return InductionMode::Hybrid;
+    if (s == "multirate" || s == "multi_rate") return InductionMode::MultiRate;
+    throw std::invalid_argument("Unknown induction mode '" + name +
+                                "' (expected biot_savart, lia, hybrid or multirate)");
+}
+
+const char* induction_mode_name(InductionMode mode) {
+    switch (mode) {
+        case InductionMode::BiotSavart: return "biot_savart";
+        case InductionMode::LocalInduction: return "lia";
+        case InductionMode::Hybrid: return "hybrid";
+        case InductionMode::MultiRate: return "multirate";
+    }
+    return "unknown";
+}
+
+void local_induction_velocities(const std::vector<Vec3>& X, bool closed, double gamma,
+                                double core_radius, double core_delta, std::size_t window,
+                                std::vector<Vec3>& out) {
+    if (!(core_radius > 0.0)) {
+        throw std::invalid_argument("local_induction_velocities: core_radius must be positive");
+    }
+    const std::size_t n = X.size();
+    FrenetHelicity::compute_curvature_binormal(X, closed, out);
+    if (n < 3) {
+        return;
+    }
+    const double coeff = gamma / (4.0 * M_PI);
+    if (window == 0) {
+        for (std::size_t i = 0; i < n; ++i) {
+            Vec3& kb = out[i];
+            const double kappa = std::sqrt(kb[0] * kb[0] + kb[1] * kb[1] + kb[2] * kb[2]);
+            const double beta =
+                kappa > 0.0 ? std::max(0.0, coeff * (std::log(8.0 / (kappa * core_radius)) - core_delta)) : 0.0;
+            for (int d = 0; d < 3; ++d) kb[d] *= beta;
+        }
+        return;
+    }
+    const std::size_t segments = closed ? n : n - 1;
+    window = std::min(window, std::max<std::size_t>(segments / 2, 1));
+
+    // seg[k] = |X[k+1] - X[k]|; prefix sums give l-/l+ in O(1) per node.
+    std::vector<double> prefix(segments + 1, 0.0);
+    for (std::size_t k = 0; k < segments; ++k) {
+        const Vec3& a = X[k];
+        const Vec3& b = X[(k + 1) % n];
+        const double dx = b[0] - a[0], dy = b[1] - a[1], dz = b[2] - a[2];
+        prefix[k + 1] = prefix[k] + std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+    const double total = prefix[segments];
+    auto span = [&](std::size_t from, std::size_t count) {  // segments from..from+count-1
+        if (!closed) {
+            const std::size_t to = std::min(from + count, segments);
+            return prefix[to] - prefix[from];
+        }
+        const std::size_t to = from + count;
+        if (to <= segments) return prefix[to] - prefix[from];
+        return (total - prefix[from]) + prefix[to - segments];
+    };
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double l_minus, l_plus;
+        if (closed) {
+            l_minus = span((i + n - window) % n, window);
+            l_plus = span(i, window);
+        } else {
+            const std::size_t back = std::min(i, window);
+            l_minus = back > 0 ? span(i - back, back) : 0.0;
+            l_plus = i < segments ? span(i, window) : 0.0;
+            if (l_minus == 0.0) l_minus = l_plus;
+            if (l_plus == 0.0) l_plus = l_minus;
+        }
+        const double lm = std::sqrt(l_minus * l_plus);
+        const double beta = lm > 0.0 ? coeff * (std::log(2.0 * lm / core_radius) - core_delta) : 0.0;
+        for (int d = 0; d < 3; ++d) out[i][d] *= beta;
+    }
+}
+
+void far_field_velocities(const std::vector<Vec3>& X, const std::vector<Vec3>& T, double gamma,
+                          std::size_t window, bool closed, std::vector<Vec3>& out) {
+    const std::size_t n = X.size();
+    out.resize(n);
+    const double coeff = gamma / (4.0 * M_PI);
+    auto row = [&](std::size_t i) {
+        Vec3 v{0.0, 0.0, 0.0};
+        const Vec3& r = X[i];
+        for (std::size_t j = 0; j < n; ++j) {
+            std::size_t gap = i > j ? i - j : j - i;
+            if (closed) gap = std::min(gap, n - gap);
+            if (gap <= window) continue;
+            const double dx = r[0] - X[j][0], dy = r[1] - X[j][1], dz = r[2] - X[j][2];
+            const double d = std::sqrt(dx * dx + dy * dy + dz * dz);
+            if (d > 1e-6) {
+                const double s = coeff / (d * d * d);
+                v[0] += (T[j][1] * dz - T[j][2] * dy) * s;
+                v[1] += (T[j][2] * dx - T[j][0] * dz) * s;
+                v[2] += (T[j][0] * dy - T[j][1] * dx) * s;
+            }
+        }
+        out[i] = v;
+    };
+    constexpr std::size_t kSerialNodes = 256;
+    if (n < kSerialNodes) {
+        for (std::size_t i = 0; i < n; ++i) row(i);
+        return;
+    }
+    parallel_for(0, n, 16, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i) row(i);
+    });
+}
+
+void MultiRateBiotSavart::set_schedule(std::size_t interval, double tolerance, std::size_t max_interval) {
+    initial_interval_ = std::max<std::size_t>(interval, 1);
+    max_interval_ = std::max(max_interval, initial_interval_);
+    tolerance_ = tolerance > 0.0 ? tolerance : 0.0;
+    interval_ = initial_interval_;
+    drift_ = 0.0;
+}
+
+void MultiRateBiotSavart::clear() {
+    near_start_.clear();
+    near_index_.clear();
+    far_.clear();
+}
+
+void MultiRateBiotSavart::reset() {
+    clear();
+    radius_ = 0.0;
+    drift_ = 0.0;
+    interval_ = initial_interval_;
+}
+
+void MultiRateBiotSavart::near_velocities(const std::vector<Vec3>& X, const std::vector<Vec3>& T, double gamma,
+                                          std::vector<Vec3>& out) const {
+    const std::size_t n = X.size();
+    out.resize(n);
+    const double coeff = 1.0 / (4.0 * M_PI);
+    // Same kernel and term order as BiotSavart::velocity restricted to the near list.
+    auto row = [&](std::size_t i) {
+        Vec3 v{0.0, 0.0, 0.0};
+        const Vec3& r = X[i];
+        for (std::size_t k = near_start_[i]; k < near_start_[i + 1]; ++k) {
+            const std::size_t j = near_index_[k];
+            const double dx = r[0] - X[j][0], dy = r[1] - X[j][1], dz = r[2] - X[j][2];
+            const double d = std::sqrt(dx * dx + dy * dy + dz * dz);
+            if (d > 1e-6) {
+                const double scale = gamma / (d * d * d);
+                v[0] += coeff * (T[j][1] * dz - T[j][2] * dy) * scale;
+                v[1] += coeff * (T[j][2] * dx - T[j][0] * dz) * scale;
+                v[2] += coeff * (T[j][0] * dy - T[j][1] * dx) * scale;
+            }
+        }
+        out[i] = v;
+    };
+    constexpr std::size_t kSerialNodes = 256;
+    if (n < kSerialNodes) {
+        for (std::size_t i = 0; i < n; ++i) row(i);
+        return;
+    }
+    parallel_for(0, n, 16, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i) row(i);
+    });
+}
+
+void MultiRateBiotSavart::refresh(const std::vector<Vec3>& X, const std::vector<Vec3>& T, double gamma,
+                                  double radius) {
+    const std::size_t n = X.size();
+    BiotSavart::self_velocities(X, T, gamma, full_);
+
+    // Error monitor: the cached far term against the same pairs evaluated now.
+    if (ready(n)) {
+        near_velocities(X, T, gamma, near_);
+        double drift = 0.0, vmax = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            double e2 = 0.0, v2 = 0.0;
+            for (int d = 0; d < 3; ++d) {
+                const double e = full_[i][d] - near_[i][d] - far_[i][d];
+                e2 += e * e;
+                v2 += full_[i][d] * full_[i][d];
+            }
+            drift = std::max(drift, e2);
+            vmax = std::max(vmax, v2);
+        }
+        drift_ = vmax > 0.0 ? std::sqrt(drift / vmax) : 0.0;
+        if (tolerance_ > 0.0) {
+            const double factor = drift_ > 0.0 ? std::clamp(0.9 * tolerance_ / drift_, 0.5, 2.0) : 2.0;
+            const double m = std::floor(static_cast<double>(interval_) * factor);
+            interval_ = std::clamp<std::size_t>(static_cast<std::size_t>(std::max(m, 1.0)), 1, max_interval_);
+        }
+    }
+
+    if (radius > 0.0) {
+        radius_ = radius;
+    } else if (radius_ <= 0.0 && n > 1) {
+        double length = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const Vec3& a = X[i];
+            const Vec3& b = X[(i + 1) % n];
+            length += std::sqrt((b[0] - a[0]) * (b[0] - a[0]) + (b[1] - a[1]) * (b[1] - a[1]) +
+                                (b[2] - a[2]) * (b[2] - a[2]));
+        }
+        radius_ = 8.0 * length / static_cast<double>(n);
+    }
+
+    // Freeze the near pair list at the current positions.
+    near_start_.assign(n + 1, 0);
+    near_index_.clear();
+    const double r2 = radius_ * radius_;
+    if (n > 0 && radius_ > 0.0 && cells_.build(X.data()->data(), n, radius_)) {
+        for (std::size_t i = 0; i < n; ++i) {
+            cells_.gather_sorted(X[i].data(), 0, candidates_);
+            for (std::size_t j : candidates_) {
+                const double dx = X[i][0] - X[j][0], dy = X[i][1] - X[j][1], dz = X[i][2] - X[j][2];
+                if (j != i && dx * dx + dy * dy + dz * dz < r2) near_index_.push_back(j);
+            }
+            near_start_[i + 1] = near_index_.size();
+        }
+    } else {
+        // No usable grid (degenerate box): treat every pair as near.
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                if (j != i) near_index_.push_back(j);
+            }
+            near_start_[i + 1] = near_index_.size();
+        }
+    }
+
+    near_velocities(X, T, gamma, near_);
+    far_.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (int d = 0; d < 3; ++d) far_[i][d] = full_[i][d] - near_[i][d];
+    }
+}
+
+void MultiRateBiotSavart::velocities(const std::vector<Vec3>& X, const std::vector<Vec3>& T, double gamma,
+                                     std::vector<Vec3>& out) const {
+    near_velocities(X, T, gamma, out);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        for (int d = 0; d < 3; ++d) out[i][d] += far_[i][d];
+    }
+}
+
+void MultiRateBiotSavart::save_state(SnapshotWriter& out) const {
+    out.u64(interval_);
+    out.u64(initial_interval_);
+    out.f64(tolerance_);
+    out.u64(max_interval_);
+    out.f64(drift_);
+    out.f64(radius_);
+    out.indices(near_start_);
+    out.indices(near_index_);
+    out.points(far_);
+}
+
+void MultiRateBiotSavart::load_state(SnapshotReader& in) {
+    interval_ = in.u64();
+    initial_interval_ = in.u64();
+    tolerance_ = in.f64();
+    max_interval_ = in.u64();
+    drift_ = in.f64();
+    radius_ = in.f64();
+    near_start_ = in.indices();
+    near_index_ = in.indices();
+    far_ = in.points();
+    bool valid = near_start_.empty() ? near_index_.empty() && far_.empty()
+                                     : near_start_.size() == far_.size() + 1 && near_start_.front() == 0 &&
+                                           near_start_.back() == near_index_.size();
+    for (std::size_t i = 1; valid && i < near_start_.size(); ++i) valid = near_start_[i - 1] <= near_start_[i];
+    for (std::size_t k = 0; valid && k < near_index_.size(); ++k) valid = near_index_[k] < far_.size();
+    if (!valid) {
+        clear();
+        throw std::runtime_error("MultiRateBiotSavart: inconsistent pair list in snapshot");
+    }
+}
+
+} // namespace sst
@@ -0,0 +1,120 @@
+#ifndef SWIRL_STRING_CORE_LOCAL_INDUCTION_H
+#define SWIRL_STRING_CORE_LOCAL_INDUCTION_H
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "cell_list.h"
+
+namespace sst {
+
+using Vec3 = std::array<double, 3>;
+
+class SnapshotWriter;
+class SnapshotReader;
+
+enum class InductionMode {
+    BiotSavart,      // full O(N^2) Biot–Savart every evaluation (default)
+    LocalInduction,  // LIA binormal flow, O(N)
+    Hybrid,          // LIA inside a window + cached far-field Biot–Savart
+    MultiRate,       // exact near-pair Biot–Savart every stage + far field cached for m steps
+};
+
+// Accepts "biot_savart"/"bs", "lia"/"local", "hybrid", "multirate"/"multi_rate".
+InductionMode parse_induction_mode(const std::string& name);
+const char* induction_mode_name(InductionMode mode);
+
+struct InductionOptions {
+    InductionMode mode = InductionMode::BiotSavart;
+    double core_radius = 1e-2;           // a in the LIA log factor
+    double core_delta = 0.25;            // core constant (uniform vorticity: 1/4)
+    std::size_t local_window = 8;        // hybrid: segments on each side handled by LIA (>= 1)
+    std::size_t far_field_interval = 1;  // hybrid/multirate: refresh far field every m steps (0: every evaluation)
+    // multirate only
+    double near_radius = 0.0;                 // pair cutoff; 0 -> 8 x mean node spacing at the first refresh
+    double far_field_tolerance = 1e-3;        // target far-field drift per refresh relative to max |v|; 0 keeps m fixed
+    std::size_t max_far_field_interval = 64;  // upper bound for the adapted m
+};
+
+/**
+ * @brief Local induction velocity v_i = beta_i (kappa b)_i.
+ *
+ * beta_i = Gamma/(4 pi) * (ln(2 sqrt(l- l+) / a) - delta), where l-/l+ are the
+ * arclengths covered by `window` segments behind/ahead of node i (truncated
+ * at the ends of an open curve). This desingularises the near part of
+ * Biot–Savart that far_field_velocities() leaves out.
+ * window = 0 is classical LIA with the cutoff at the curvature radius,
+ * l- = l+ = 4 / kappa_i, which reproduces the thin-ring speed
+ * Gamma/(4 pi R) (ln(8R/a) - delta) independently of the resolution.
+ */
+void local_induction_velocities(const std::vector<Vec3>& X, bool closed, double gamma,
+                                double core_radius, double core_delta, std::size_t window,
+                                std::vector<Vec3>& out);
+
+/**
+ * @brief Biot–Savart velocity at each node from nodes more than `window`
+ * indices away (cyclically when closed). Same kernel as BiotSavart::velocity;
+ * rows run on the shared thread pool.
+ */
+void far_field_velocities(const std::vector<Vec3>& X, const std::vector<Vec3>& T, double gamma,
+                          std::size_t window, bool closed, std::vector<Vec3>& out);
+
+/**
+ * @brief Multi-rate Biot–Savart: pairs split by distance into a near part
+ * evaluated exactly at every stage and a far part cached between refreshes.
+ *
+ * refresh() freezes the near pair list (cell list, |x_i - x_j| < radius at
+ * the refresh positions) and stores far = full - near. Between refreshes
+ * velocities() sums the frozen near pairs at the current positions and adds
+ * the cached far term, so every pair is counted exactly once however the
+ * nodes move. At each refresh the cached far term is compared with the
+ * fresh one (same pair partition); that drift, relative to max |v|, drives
+ * the refresh interval: m is scaled by 0.9 tol / drift, clamped to
+ * [m/2, 2m] and [1, max_interval].
+ */
+class MultiRateBiotSavart {
+public:
+    void set_schedule(std::size_t interval, double tolerance, std::size_t max_interval);
+    std::size_t interval() const { return interval_; }
+    double last_drift() const { return drift_; }
+    double radius() const { return radius_; }
+    std::size_t near_pairs() const { return near_index_.size(); }
+    bool ready(std::size_t n) const { return far_.size() == n && near_start_.size() == n + 1; }
+    // Drop the pair list and cached far field (nodes were renumbered, e.g.
+    // remeshed); the next refresh rebuilds them without a drift estimate.
+    void clear();
+    // clear() and also forget the resolved radius and the adapted interval.
+    void reset();
+
+    // radius <= 0 resolves 8 x mean closed-polyline spacing once and keeps it.
+    void refresh(const std::vector<Vec3>& X, const std::vector<Vec3>& T, double gamma, double radius);
+    void velocities(const std::vector<Vec3>& X, const std::vector<Vec3>& T, double gamma,
+                    std::vector<Vec3>& out) const;
+
+    void save_state(SnapshotWriter& out) const;
+    void load_state(SnapshotReader& in);
+
+private:
+    void near_velocities(const std::vector<Vec3>& X, const std::vector<Vec3>& T, double gamma,
+                         std::vector<Vec3>& out) const;
+
+    std::size_t interval_ = 1;
+    std::size_t initial_interval_ = 1;
+    double tolerance_ = 0.0;
+    std::size_t max_interval_ = 1;
+    double drift_ = 0.0;
+    double radius_ = 0.0;
+    std::vector<std::size_t> near_start_;  // CSR over nodes
+    std::vector<std::size_t> near_index_;  // ascending j per node
+    std::vector<Vec3> far_;
+    std::vector<Vec3> full_;               // refresh scratch
+    std::vector<Vec3> near_;               // refresh scratch
+    std::vector<std::size_t> candidates_;  // refresh scratch
+    CellList cells_;
+};
+
+} // namespace sst
+
+#endif // SWIRL_STRING_CORE_LOCAL_INDUCTION_H
@@ -20,11 +20,16 @@ void bind_radiation_flow(py::module_& m);
 void bind_swirl_field(py::module_& m);
 void bind_thermo_dynamics(py::module_& m);
 void bind_time_evolution(py::module_& m);
+void bind_filament_system(py::module_& m);
+void bind_trajectory_writer(py::module_& m);
 void bind_vortex_ring(py::module_& m);
 void bind_vorticity_dynamics(py::module_& m);
 void bind_sst_gravity(py::module_& m);
 void bind_sst_integrator(py::module_& m);
 void bind_extensions(py::module_& m);
+void bind_job_system(py::module_& m);
+void bind_profiler(py::module_& m);
+void bind_thread_pool(py::module_& m);
 
 
 PYBIND11_MODULE(sstcore, m) {
@@ -43,11 +48,16 @@ PYBIND11_MODULE(sstcore, m) {
   bind_swirl_field(m);
   bind_thermo_dynamics(m);
   bind_time_evolution(m);
+  bind_filament_system(m);
+  bind_trajectory_writer(m);
   bind_vortex_ring(m);
   bind_vorticity_dynamics(m);
   bind_sst_gravity(m);
   bind_sst_integrator(m);
   bind_extensions(m);
+  bind_job_system(m);
+  bind_profiler(m);
+  bind_thread_pool(m);
  // module-wide listing utility
     m.def(
         "list_bindings",
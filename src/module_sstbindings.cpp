@@ -2,52 +2,21 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <algorithm>
+#include <string>
 
 namespace py = pybind11;
 
-// Forward declaration only!
-void bind_ab_initio(py::module_& m);
-void bind_biot_savart(py::module_& m);
-void bind_fluid_dynamics(py::module_ &m);
-void bind_field_kernels(py::module_ &m);
-void bind_field_ops(py::module_& m);
-void bind_knot(py::module_& m);
-void bind_frenet_helicity(py::module_& m);
-void bind_magnus_integrator(py::module_& m);
-void bind_timefield(py::module_& m);
-void bind_hyperbolic_volume(py::module_& m);
-void bind_radiation_flow(py::module_& m);
-void bind_swirl_field(py::module_& m);
-void bind_thermo_dynamics(py::module_& m);
-void bind_time_evolution(py::module_& m);
-void bind_vortex_ring(py::module_& m);
-void bind_vorticity_dynamics(py::module_& m);
-void bind_sst_gravity(py::module_& m);
-void bind_sst_integrator(py::module_& m);
-void bind_extensions(py::module_& m);
-
-
+// sstbindings is a thin alias: it imports sstcore and re-exports its
+// attributes, so the bindings are registered (and the core is loaded) once
+// per process no matter which of the two names is imported.
 PYBIND11_MODULE(sstbindings, m) {
-  m.doc() = "SST Core Bindings (backwards compatibility alias)";
-  bind_ab_initio(m);
-  bind_biot_savart(m);
-  bind_fluid_dynamics(m);
-  bind_field_kernels(m);
-  bind_field_ops(m);
-  bind_knot(m);
-  bind_frenet_helicity(m);
-  bind_magnus_integrator(m);
-  bind_timefield(m);
-  bind_hyperbolic_volume(m);
-  bind_radiation_flow(m);
-  bind_swirl_field(m);
-  bind_thermo_dynamics(m);
-  bind_time_evolution(m);
-  bind_vortex_ring(m);
-  bind_vorticity_dynamics(m);
-  bind_sst_gravity(m);
-  bind_sst_integrator(m);
-  bind_extensions(m);
+  m.doc() = "SST Core Bindings (backwards compatibility alias of sstcore)";
+  const py::module_ core = py::module_::import("sstcore");
+  for (const auto& [key, value] : core.attr("__dict__").cast<py::dict>()) {
+    const std::string name = py::str(key);
+    if (name.starts_with("__")) continue;
+    m.attr(key) = value;
+  }
 
  // module-wide listing utility
     m.def(
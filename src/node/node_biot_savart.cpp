@@ -8,145 +8,154 @@ using namespace sst;
 // Forward declarations
 void bind_biot_savart(Napi::Env env, Napi::Object exports);
 
+// Grid shape argument [nx, ny, nz]
+static std::array<int, 3> js_to_shape(const Napi::Value& value) {
+    if (!value.IsArray() || value.As<Napi::Array>().Length() != 3) {
+        throw Napi::TypeError::New(value.Env(), "shape must be [x, y, z]");
+    }
+    Napi::Array shapeArr = value.As<Napi::Array>();
+    std::array<int, 3> shape;
+    shape[0] = shapeArr.Get((uint32_t)0u).As<Napi::Number>().Int32Value();
+    shape[1] = shapeArr.Get((uint32_t)1u).As<Napi::Number>().Int32Value();
+    shape[2] = shapeArr.Get((uint32_t)2u).As<Napi::Number>().Int32Value();
+    return shape;
+}
+
+static Napi::Value invariants_to_js(Napi::Env env, const std::tuple<double, double, double>& invariants) {
+    auto [h_charge, h_mass, a_mu] = invariants;
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("hCharge", Napi::Number::New(env, h_charge));
+    result.Set("hMass", Napi::Number::New(env, h_mass));
+    result.Set("aMu", Napi::Number::New(env, a_mu));
+    return result;
+}
+
+static Napi::Value vec3_result_to_js(Napi::Env env, std::vector<Vec3>& result) {
+    return vec3_list_to_js_typedarray(env, std::move(result));
+}
+
 void bind_biot_savart(Napi::Env env, Napi::Object exports) {
-    // BiotSavart class with static methods
-    Napi::Function biotSavartClass = Napi::Object::New(env).Get("constructor").As<Napi::Function>();
-    
+    // Float64Array inputs are read in place (no intermediate std::vector<Vec3>);
+    // nested [x, y, z] arrays are converted once. Every grid/field kernel also
+    // has a Promise-returning `*Async` variant that runs on the libuv thread
+    // pool; its Float64Array inputs must not be modified until it settles.
+
     // Static method: computeVelocity
     exports.Set("computeVelocity", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 2) {
             throw Napi::Error::New(env, "Expected 2 arguments: curve, grid_points");
         }
-        
-        std::vector<Vec3> curve, grid_points;
-        
-        // Handle curve - can be array of arrays or TypedArray
-        if (info[0].IsArray()) {
-            curve = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            curve = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "curve must be array or Float64Array");
-        }
-        
-        // Handle grid_points
-        if (info[1].IsArray()) {
-            grid_points = js_array_to_vec3_list(info[1].As<Napi::Array>());
-        } else if (info[1].IsTypedArray()) {
-            grid_points = js_typedarray_to_vec3_list(info[1].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "grid_points must be array or Float64Array");
-        }
-        
-        std::vector<Vec3> result = BiotSavart::computeVelocity(curve, grid_points);
-        return vec3_list_to_js_typedarray(env, result);
+        Vec3Input curve = js_to_vec3_input(info[0], "curve");
+        Vec3Input grid_points = js_to_vec3_input(info[1], "grid_points");
+
+        std::vector<Vec3> result = BiotSavart::computeVelocity(curve.view, grid_points.view);
+        return vec3_list_to_js_typedarray(env, std::move(result));
     }, "computeVelocity"));
-    
+
+    exports.Set("computeVelocityAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "computeVelocityAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 2) {
+                throw Napi::Error::New(info.Env(), "Expected 2 arguments: curve, grid_points");
+            }
+            return async_kernel(
+                [curve = js_to_vec3_input(info[0], "curve"), grid_points = js_to_vec3_input(info[1], "grid_points")]() {
+                    return BiotSavart::computeVelocity(curve.view, grid_points.view);
+                },
+                vec3_result_to_js);
+        });
+    }, "computeVelocityAsync"));
+
     // Static method: computeVorticity
     exports.Set("computeVorticity", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 3) {
             throw Napi::Error::New(env, "Expected 3 arguments: velocity, shape, spacing");
         }
-        
-        std::vector<Vec3> velocity;
-        if (info[0].IsArray()) {
-            velocity = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            velocity = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "velocity must be array or Float64Array");
-        }
-        
-        Napi::Array shapeArr = info[1].As<Napi::Array>();
-        if (shapeArr.Length() != 3) {
-            throw Napi::TypeError::New(env, "shape must be [x, y, z]");
-        }
-        std::array<int, 3> shape;
-        shape[0] = shapeArr.Get((uint32_t)0u).As<Napi::Number>().Int32Value();
-        shape[1] = shapeArr.Get((uint32_t)1u).As<Napi::Number>().Int32Value();
-        shape[2] = shapeArr.Get((uint32_t)2u).As<Napi::Number>().Int32Value();
-
+        Vec3Input velocity = js_to_vec3_input(info[0], "velocity");
+        std::array<int, 3> shape = js_to_shape(info[1]);
         double spacing = info[2].As<Napi::Number>().DoubleValue();
-        
-        std::vector<Vec3> result = BiotSavart::computeVorticity(velocity, shape, spacing);
-        return vec3_list_to_js_typedarray(env, result);
+
+        std::vector<Vec3> result = BiotSavart::computeVorticity(velocity.view, shape, spacing);
+        return vec3_list_to_js_typedarray(env, std::move(result));
     }, "computeVorticity"));
-    
+
+    exports.Set("computeVorticityAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "computeVorticityAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 3) {
+                throw Napi::Error::New(info.Env(), "Expected 3 arguments: velocity, shape, spacing");
+            }
+            return async_kernel(
+                [velocity = js_to_vec3_input(info[0], "velocity"), shape = js_to_shape(info[1]),
+                 spacing = info[2].As<Napi::Number>().DoubleValue()]() {
+                    return BiotSavart::computeVorticity(velocity.view, shape, spacing);
+                },
+                vec3_result_to_js);
+        });
+    }, "computeVorticityAsync"));
+
     // Static method: extractInterior
     exports.Set("extractInterior", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 3) {
             throw Napi::Error::New(env, "Expected 3 arguments: field, shape, margin");
         }
-        
-        std::vector<Vec3> field;
-        if (info[0].IsArray()) {
-            field = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            field = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "field must be array or Float64Array");
-        }
-        
-        Napi::Array shapeArr = info[1].As<Napi::Array>();
-        if (shapeArr.Length() != 3) {
-            throw Napi::TypeError::New(env, "shape must be [x, y, z]");
-        }
-        std::array<int, 3> shape;
-        shape[0] = shapeArr.Get((uint32_t)0u).As<Napi::Number>().Int32Value();
-        shape[1] = shapeArr.Get((uint32_t)1u).As<Napi::Number>().Int32Value();
-        shape[2] = shapeArr.Get((uint32_t)2u).As<Napi::Number>().Int32Value();
-
+        Vec3Input field = js_to_vec3_input(info[0], "field");
+        std::array<int, 3> shape = js_to_shape(info[1]);
         int margin = info[2].As<Napi::Number>().Int32Value();
-        
-        std::vector<Vec3> result = BiotSavart::extractInterior(field, shape, margin);
-        return vec3_list_to_js_typedarray(env, result);
+
+        std::vector<Vec3> result = BiotSavart::extractInterior(field.view, shape, margin);
+        return vec3_list_to_js_typedarray(env, std::move(result));
     }, "extractInterior"));
-    
+
+    exports.Set("extractInteriorAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "extractInteriorAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 3) {
+                throw Napi::Error::New(info.Env(), "Expected 3 arguments: field, shape, margin");
+            }
+            return async_kernel(
+                [field = js_to_vec3_input(info[0], "field"), shape = js_to_shape(info[1]),
+                 margin = info[2].As<Napi::Number>().Int32Value()]() {
+                    return BiotSavart::extractInterior(field.view, shape, margin);
+                },
+                vec3_result_to_js);
+        });
+    }, "extractInteriorAsync"));
+
     // Static method: computeInvariants
     exports.Set("computeInvariants", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 3) {
             throw Napi::Error::New(env, "Expected 3 arguments: v_sub, w_sub, r_sq");
         }
-        
-        std::vector<Vec3> v_sub, w_sub;
-        if (info[0].IsArray()) {
-            v_sub = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            v_sub = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "v_sub must be array or Float64Array");
-        }
-        
-        if (info[1].IsArray()) {
-            w_sub = js_array_to_vec3_list(info[1].As<Napi::Array>());
-        } else if (info[1].IsTypedArray()) {
-            w_sub = js_typedarray_to_vec3_list(info[1].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "w_sub must be array or Float64Array");
-        }
-        
+        Vec3Input v_sub = js_to_vec3_input(info[0], "v_sub");
+        Vec3Input w_sub = js_to_vec3_input(info[1], "w_sub");
         std::vector<double> r_sq = js_array_to_double_vector(info[2].As<Napi::Array>());
-        
-        auto [h_charge, h_mass, a_mu] = BiotSavart::computeInvariants(v_sub, w_sub, r_sq);
-        
-        Napi::Object result = Napi::Object::New(env);
-        result.Set("hCharge", Napi::Number::New(env, h_charge));
-        result.Set("hMass", Napi::Number::New(env, h_mass));
-        result.Set("aMu", Napi::Number::New(env, a_mu));
-        return result;
+
+        return invariants_to_js(env, BiotSavart::computeInvariants(v_sub.view, w_sub.view, r_sq));
     }, "computeInvariants"));
-    
+
+    exports.Set("computeInvariantsAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "computeInvariantsAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 3) {
+                throw Napi::Error::New(info.Env(), "Expected 3 arguments: v_sub, w_sub, r_sq");
+            }
+            return async_kernel(
+                [v_sub = js_to_vec3_input(info[0], "v_sub"), w_sub = js_to_vec3_input(info[1], "w_sub"),
+                 r_sq = js_array_to_double_vector(info[2].As<Napi::Array>())]() {
+                    return BiotSavart::computeInvariants(v_sub.view, w_sub.view, r_sq);
+                },
+                invariants_to_js);
+        });
+    }, "computeInvariantsAsync"));
+
     // Function: biot_savart_velocity (single point)
     exports.Set("biotSavartVelocity", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 3) {
             throw Napi::Error::New(env, "Expected at least 3 arguments: r, filament_points, tangent_vectors");
         }
-        
+
         Vec3 r;
         if (info[0].IsArray()) {
             Napi::Array rArr = info[0].As<Napi::Array>();
@@ -159,7 +168,7 @@ void bind_biot_savart(Napi::Env env, Napi::Object exports) {
         } else {
             throw Napi::TypeError::New(env, "r must be [x, y, z]");
         }
-        
+
         std::vector<Vec3> filament_points, tangent_vectors;
         if (info[1].IsArray()) {
             filament_points = js_array_to_vec3_list(info[1].As<Napi::Array>());
@@ -168,7 +177,7 @@ void bind_biot_savart(Napi::Env env, Napi::Object exports) {
         } else {
             throw Napi::TypeError::New(env, "filament_points must be array or Float64Array");
         }
-        
+
         if (info[2].IsArray()) {
             tangent_vectors = js_array_to_vec3_list(info[2].As<Napi::Array>());
         } else if (info[2].IsTypedArray()) {
@@ -176,46 +185,44 @@ void bind_biot_savart(Napi::Env env, Napi::Object exports) {
         } else {
             throw Napi::TypeError::New(env, "tangent_vectors must be array or Float64Array");
         }
-        
+
         double circulation = 1.0;
         if (info.Length() > 3) {
             circulation = info[3].As<Napi::Number>().DoubleValue();
         }
-        
+
         Vec3 result = BiotSavart::velocity(r, filament_points, tangent_vectors, circulation);
-        
+
         Napi::Array resultArr = Napi::Array::New(env, 3);
         resultArr.Set((uint32_t)0u, Napi::Number::New(env, result[0]));
         resultArr.Set((uint32_t)1u, Napi::Number::New(env, result[1]));
         resultArr.Set((uint32_t)2u, Napi::Number::New(env, result[2]));
         return resultArr;
     }, "biotSavartVelocity"));
-    
+
     // Function: biot_savart_velocity_grid (grid-based)
     exports.Set("biotSavartVelocityGrid", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 2) {
             throw Napi::Error::New(env, "Expected 2 arguments: polyline, grid");
         }
-        
-        std::vector<Vec3> polyline, grid;
-        if (info[0].IsArray()) {
-            polyline = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            polyline = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "polyline must be array or Float64Array");
-        }
-        
-        if (info[1].IsArray()) {
-            grid = js_array_to_vec3_list(info[1].As<Napi::Array>());
-        } else if (info[1].IsTypedArray()) {
-            grid = js_typedarray_to_vec3_list(info[1].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "grid must be array or Float64Array");
-        }
-        
-        std::vector<Vec3> result = BiotSavart::computeVelocity(polyline, grid);
-        return vec3_list_to_js_typedarray(env, result);
+        Vec3Input polyline = js_to_vec3_input(info[0], "polyline");
+        Vec3Input grid = js_to_vec3_input(info[1], "grid");
+
+        std::vector<Vec3> result = BiotSavart::computeVelocity(polyline.view, grid.view);
+        return vec3_list_to_js_typedarray(env, std::move(result));
     }, "biotSavartVelocityGrid"));
-}
\ No newline at end of file
+
+    exports.Set("biotSavartVelocityGridAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "biotSavartVelocityGridAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 2) {
+                throw Napi::Error::New(info.Env(), "Expected 2 arguments: polyline, grid");
+            }
+            return async_kernel(
+                [polyline = js_to_vec3_input(info[0], "polyline"), grid = js_to_vec3_input(info[1], "grid")]() {
+                    return BiotSavart::computeVelocity(polyline.view, grid.view);
+                },
+                vec3_result_to_js);
+        });
+    }, "biotSavartVelocityGridAsync"));
+}
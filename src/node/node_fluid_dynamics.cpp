@@ -5,6 +5,18 @@
 
 using namespace sst;
 
+static Napi::Value number_to_js(Napi::Env env, double& value) {
+    return Napi::Number::New(env, value);
+}
+
+static Napi::Value doubles_to_js(Napi::Env env, std::vector<double>& values) {
+    return double_vector_to_js_array(env, values);
+}
+
+static Napi::Value vec3_result_to_js(Napi::Env env, std::vector<Vec3>& result) {
+    return vec3_list_to_js_typedarray(env, std::move(result));
+}
+
 void bind_fluid_dynamics(Napi::Env env, Napi::Object exports) {
     // compute_pressure_field
     exports.Set("computePressureField", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
@@ -18,78 +30,88 @@ void bind_fluid_dynamics(Napi::Env env, Napi::Object exports) {
         std::vector<double> result = FluidDynamics::compute_pressure_field(velocity_magnitude, rho_ae, P_infinity);
         return double_vector_to_js_array(env, result);
     }, "computePressureField"));
-    
+
     // compute_velocity_magnitude
     exports.Set("computeVelocityMagnitude", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 1) {
             throw Napi::Error::New(env, "Expected 1 argument: velocity");
         }
-        std::vector<Vec3> velocity;
-        if (info[0].IsArray()) {
-            velocity = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            velocity = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "velocity must be array or Float64Array");
-        }
-        std::vector<double> result = FluidDynamics::compute_velocity_magnitude(velocity);
+        Vec3Input velocity = js_to_vec3_input(info[0], "velocity");
+        std::vector<double> result = FluidDynamics::compute_velocity_magnitude(velocity.view);
         return double_vector_to_js_array(env, result);
     }, "computeVelocityMagnitude"));
-    
+
+    exports.Set("computeVelocityMagnitudeAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "computeVelocityMagnitudeAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 1) {
+                throw Napi::Error::New(info.Env(), "Expected 1 argument: velocity");
+            }
+            return async_kernel(
+                [velocity = js_to_vec3_input(info[0], "velocity")]() {
+                    return FluidDynamics::compute_velocity_magnitude(velocity.view);
+                },
+                doubles_to_js);
+        });
+    }, "computeVelocityMagnitudeAsync"));
+
     // evolve_positions_euler
     exports.Set("evolvePositionsEuler", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 3) {
             throw Napi::Error::New(env, "Expected 3 arguments: positions, velocity, dt");
         }
-        std::vector<Vec3> positions;
-        if (info[0].IsArray()) {
-            positions = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            positions = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "positions must be array or Float64Array");
-        }
-        std::vector<Vec3> velocity;
-        if (info[1].IsArray()) {
-            velocity = js_array_to_vec3_list(info[1].As<Napi::Array>());
-        } else if (info[1].IsTypedArray()) {
-            velocity = js_typedarray_to_vec3_list(info[1].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "velocity must be array or Float64Array");
-        }
+        Vec3Input positions = js_to_vec3_input(info[0], "positions");
+        Vec3Input velocity = js_to_vec3_input(info[1], "velocity");
         double dt = info[2].As<Napi::Number>().DoubleValue();
-        FluidDynamics::evolve_positions_euler(positions, velocity, dt);
-        return vec3_list_to_js_typedarray(env, positions);
+        std::vector<Vec3> result = positions.take();
+        FluidDynamics::evolve_positions_euler(result, velocity.take(), dt);
+        return vec3_list_to_js_typedarray(env, std::move(result));
     }, "evolvePositionsEuler"));
-    
+
+    exports.Set("evolvePositionsEulerAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "evolvePositionsEulerAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 3) {
+                throw Napi::Error::New(info.Env(), "Expected 3 arguments: positions, velocity, dt");
+            }
+            return async_kernel(
+                [positions = js_to_vec3_input(info[0], "positions"), velocity = js_to_vec3_input(info[1], "velocity"),
+                 dt = info[2].As<Napi::Number>().DoubleValue()]() mutable {
+                    std::vector<Vec3> result = positions.take();
+                    FluidDynamics::evolve_positions_euler(result, velocity.take(), dt);
+                    return result;
+                },
+                vec3_result_to_js);
+        });
+    }, "evolvePositionsEulerAsync"));
+
     // compute_helicity (with volume element dV for discretized field)
     exports.Set("computeHelicityField", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 3) {
             throw Napi::Error::New(env, "Expected 3 arguments: velocity, vorticity, dV");
         }
-        std::vector<Vec3> velocity, vorticity;
-        if (info[0].IsArray()) {
-            velocity = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            velocity = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "velocity must be array or Float64Array");
-        }
-        if (info[1].IsArray()) {
-            vorticity = js_array_to_vec3_list(info[1].As<Napi::Array>());
-        } else if (info[1].IsTypedArray()) {
-            vorticity = js_typedarray_to_vec3_list(info[1].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "vorticity must be array or Float64Array");
-        }
+        Vec3Input velocity = js_to_vec3_input(info[0], "velocity");
+        Vec3Input vorticity = js_to_vec3_input(info[1], "vorticity");
         double dV = info[2].As<Napi::Number>().DoubleValue();
-        double result = FluidDynamics::compute_helicity(velocity, vorticity, dV);
+        double result = FluidDynamics::compute_helicity(velocity.view, vorticity.view, dV);
         return Napi::Number::New(env, result);
     }, "computeHelicityField"));
-    
+
+    exports.Set("computeHelicityFieldAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "computeHelicityFieldAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 3) {
+                throw Napi::Error::New(info.Env(), "Expected 3 arguments: velocity, vorticity, dV");
+            }
+            return async_kernel(
+                [velocity = js_to_vec3_input(info[0], "velocity"), vorticity = js_to_vec3_input(info[1], "vorticity"),
+                 dV = info[2].As<Napi::Number>().DoubleValue()]() {
+                    return FluidDynamics::compute_helicity(velocity.view, vorticity.view, dV);
+                },
+                number_to_js);
+        });
+    }, "computeHelicityFieldAsync"));
+
     // Additional utility functions
     exports.Set("swirlClockRate", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
@@ -100,22 +122,27 @@ void bind_fluid_dynamics(Napi::Env env, Napi::Object exports) {
         double du_dy = info[1].As<Napi::Number>().DoubleValue();
         return Napi::Number::New(env, FluidDynamics::swirl_clock_rate(dv_dx, du_dy));
     }, "swirlClockRate"));
-    
+
     exports.Set("computeKineticEnergy", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 2) {
             throw Napi::Error::New(env, "Expected 2 arguments: velocity, rho_ae");
         }
-        std::vector<Vec3> velocity;
-        if (info[0].IsArray()) {
-            velocity = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            velocity = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "velocity must be array or Float64Array");
-        }
+        Vec3Input velocity = js_to_vec3_input(info[0], "velocity");
         double rho_ae = info[1].As<Napi::Number>().DoubleValue();
-        return Napi::Number::New(env, FluidDynamics::compute_kinetic_energy(velocity, rho_ae));
+        return Napi::Number::New(env, FluidDynamics::compute_kinetic_energy(velocity.view, rho_ae));
     }, "computeKineticEnergy"));
-}
 
+    exports.Set("computeKineticEnergyAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "computeKineticEnergyAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 2) {
+                throw Napi::Error::New(info.Env(), "Expected 2 arguments: velocity, rho_ae");
+            }
+            return async_kernel(
+                [velocity = js_to_vec3_input(info[0], "velocity"), rho_ae = info[1].As<Napi::Number>().DoubleValue()]() {
+                    return FluidDynamics::compute_kinetic_energy(velocity.view, rho_ae);
+                },
+                number_to_js);
+        });
+    }, "computeKineticEnergyAsync"));
+}
@@ -5,6 +5,82 @@
 
 using namespace sst;
 
+// FrenetHelicity still takes std::vector<Vec3>, so Float64Array inputs are
+// copied once with Vec3Input::take(); the async variants make that copy on
+// the worker thread.
+
+namespace {
+    struct FrenetFrames {
+        std::vector<Vec3> T, N, B;
+    };
+
+    struct CurvatureTorsion {
+        std::vector<double> curvature, torsion;
+    };
+}
+
+static Napi::Value frenet_frames_to_js(Napi::Env env, FrenetFrames& f) {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("T", vec3_list_to_js_typedarray(env, std::move(f.T)));
+    result.Set("N", vec3_list_to_js_typedarray(env, std::move(f.N)));
+    result.Set("B", vec3_list_to_js_typedarray(env, std::move(f.B)));
+    return result;
+}
+
+static Napi::Value bishop_frames_to_js(Napi::Env env, BishopFrames& f) {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("T", vec3_list_to_js_typedarray(env, std::move(f.T)));
+    result.Set("U", vec3_list_to_js_typedarray(env, std::move(f.U)));
+    result.Set("V", vec3_list_to_js_typedarray(env, std::move(f.V)));
+    result.Set("curvature", double_vector_to_js_array(env, f.curvature));
+    result.Set("torsion", double_vector_to_js_array(env, f.torsion));
+    result.Set("arclength", double_vector_to_js_array(env, f.arclength));
+    result.Set("length", Napi::Number::New(env, f.length));
+    result.Set("holonomy", Napi::Number::New(env, f.holonomy));
+    return result;
+}
+
+static Napi::Value curvature_torsion_to_js(Napi::Env env, CurvatureTorsion& ct) {
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("curvature", double_vector_to_js_array(env, ct.curvature));
+    result.Set("torsion", double_vector_to_js_array(env, ct.torsion));
+    return result;
+}
+
+static Napi::Value helicity_to_js(Napi::Env env, float& value) {
+    return Napi::Number::New(env, value);
+}
+
+static Napi::Value vec3_result_to_js(Napi::Env env, std::vector<Vec3>& result) {
+    return vec3_list_to_js_typedarray(env, std::move(result));
+}
+
+static FrenetFrames frenet_frames(const std::vector<Vec3>& X) {
+    FrenetFrames f;
+    FrenetHelicity::compute_frenet_frames(X, f.T, f.N, f.B);
+    return f;
+}
+
+static BishopFrames bishop_frames(const std::vector<Vec3>& X) {
+    BishopFrames f;
+    FrenetHelicity::compute_bishop_frames(X, f);
+    return f;
+}
+
+static CurvatureTorsion curvature_torsion(const std::vector<Vec3>& T, const std::vector<Vec3>& N) {
+    CurvatureTorsion ct;
+    FrenetHelicity::compute_curvature_torsion(T, N, ct.curvature, ct.torsion);
+    return ct;
+}
+
+static Vec3Input js_to_closed_curve(const Napi::Value& value) {
+    Vec3Input X = js_to_vec3_input(value, "X");
+    if (X.view.size() < 3) {
+        throw Napi::Error::New(value.Env(), "X must have at least 3 points (closed curve)");
+    }
+    return X;
+}
+
 void bind_frenet_helicity(Napi::Env env, Napi::Object exports) {
     // compute_frenet_frames
     exports.Set("computeFrenetFrames", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
@@ -12,135 +88,153 @@ void bind_frenet_helicity(Napi::Env env, Napi::Object exports) {
         if (info.Length() < 1) {
             throw Napi::Error::New(env, "Expected 1 argument: X");
         }
-        std::vector<Vec3> X;
-        if (info[0].IsArray()) {
-            X = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            X = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "X must be array or Float64Array");
-        }
-        std::vector<Vec3> T, N, B;
-        FrenetHelicity::compute_frenet_frames(X, T, N, B);
-        Napi::Object result = Napi::Object::New(env);
-        result.Set("T", vec3_list_to_js_typedarray(env, T));
-        result.Set("N", vec3_list_to_js_typedarray(env, N));
-        result.Set("B", vec3_list_to_js_typedarray(env, B));
-        return result;
+        FrenetFrames f = frenet_frames(js_to_vec3_input(info[0], "X").take());
+        return frenet_frames_to_js(env, f);
     }, "computeFrenetFrames"));
-    
+
+    exports.Set("computeFrenetFramesAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "computeFrenetFramesAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 1) {
+                throw Napi::Error::New(info.Env(), "Expected 1 argument: X");
+            }
+            return async_kernel(
+                [X = js_to_vec3_input(info[0], "X")]() mutable { return frenet_frames(X.take()); },
+                frenet_frames_to_js);
+        });
+    }, "computeFrenetFramesAsync"));
+
+    // compute_bishop_frames
+    exports.Set("computeBishopFrames", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        Napi::Env env = info.Env();
+        if (info.Length() < 1) {
+            throw Napi::Error::New(env, "Expected 1 argument: X");
+        }
+        BishopFrames f = bishop_frames(js_to_closed_curve(info[0]).take());
+        return bishop_frames_to_js(env, f);
+    }, "computeBishopFrames"));
+
+    exports.Set("computeBishopFramesAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "computeBishopFramesAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 1) {
+                throw Napi::Error::New(info.Env(), "Expected 1 argument: X");
+            }
+            return async_kernel(
+                [X = js_to_closed_curve(info[0])]() mutable { return bishop_frames(X.take()); },
+                bishop_frames_to_js);
+        });
+    }, "computeBishopFramesAsync"));
+
     // compute_curvature_torsion
     exports.Set("computeCurvatureTorsion", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 2) {
             throw Napi::Error::New(env, "Expected 2 arguments: T, N");
         }
-        std::vector<Vec3> T, N;
-        if (info[0].IsArray()) {
-            T = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            T = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "T must be array or Float64Array");
-        }
-        if (info[1].IsArray()) {
-            N = js_array_to_vec3_list(info[1].As<Napi::Array>());
-        } else if (info[1].IsTypedArray()) {
-            N = js_typedarray_to_vec3_list(info[1].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "N must be array or Float64Array");
-        }
-        std::vector<double> curvature, torsion;
-        FrenetHelicity::compute_curvature_torsion(T, N, curvature, torsion);
-        Napi::Object result = Napi::Object::New(env);
-        result.Set("curvature", double_vector_to_js_array(env, curvature));
-        result.Set("torsion", double_vector_to_js_array(env, torsion));
-        return result;
+        Vec3Input T = js_to_vec3_input(info[0], "T");
+        Vec3Input N = js_to_vec3_input(info[1], "N");
+        CurvatureTorsion ct = curvature_torsion(T.take(), N.take());
+        return curvature_torsion_to_js(env, ct);
     }, "computeCurvatureTorsion"));
-    
+
+    exports.Set("computeCurvatureTorsionAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "computeCurvatureTorsionAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 2) {
+                throw Napi::Error::New(info.Env(), "Expected 2 arguments: T, N");
+            }
+            return async_kernel(
+                [T = js_to_vec3_input(info[0], "T"), N = js_to_vec3_input(info[1], "N")]() mutable {
+                    return curvature_torsion(T.take(), N.take());
+                },
+                curvature_torsion_to_js);
+        });
+    }, "computeCurvatureTorsionAsync"));
+
     // compute_helicity
     exports.Set("computeHelicity", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 2) {
             throw Napi::Error::New(env, "Expected 2 arguments: velocity, vorticity");
         }
-        std::vector<Vec3> velocity, vorticity;
-        if (info[0].IsArray()) {
-            velocity = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            velocity = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "velocity must be array or Float64Array");
-        }
-        if (info[1].IsArray()) {
-            vorticity = js_array_to_vec3_list(info[1].As<Napi::Array>());
-        } else if (info[1].IsTypedArray()) {
-            vorticity = js_typedarray_to_vec3_list(info[1].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "vorticity must be array or Float64Array");
-        }
-        float result = FrenetHelicity::compute_helicity(velocity, vorticity);
+        Vec3Input velocity = js_to_vec3_input(info[0], "velocity");
+        Vec3Input vorticity = js_to_vec3_input(info[1], "vorticity");
+        float result = FrenetHelicity::compute_helicity(velocity.take(), vorticity.take());
         return Napi::Number::New(env, result);
     }, "computeHelicity"));
-    
+
+    exports.Set("computeHelicityAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "computeHelicityAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 2) {
+                throw Napi::Error::New(info.Env(), "Expected 2 arguments: velocity, vorticity");
+            }
+            return async_kernel(
+                [velocity = js_to_vec3_input(info[0], "velocity"), vorticity = js_to_vec3_input(info[1], "vorticity")]() mutable {
+                    return FrenetHelicity::compute_helicity(velocity.take(), vorticity.take());
+                },
+                helicity_to_js);
+        });
+    }, "computeHelicityAsync"));
+
     // evolve_vortex_knot
     exports.Set("evolveVortexKnot", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 3) {
             throw Napi::Error::New(env, "Expected 3 arguments: positions, tangents, dt");
         }
-        std::vector<Vec3> positions, tangents;
-        if (info[0].IsArray()) {
-            positions = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            positions = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "positions must be array or Float64Array");
-        }
-        if (info[1].IsArray()) {
-            tangents = js_array_to_vec3_list(info[1].As<Napi::Array>());
-        } else if (info[1].IsTypedArray()) {
-            tangents = js_typedarray_to_vec3_list(info[1].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "tangents must be array or Float64Array");
-        }
+        Vec3Input positions = js_to_vec3_input(info[0], "positions");
+        Vec3Input tangents = js_to_vec3_input(info[1], "tangents");
         double dt = info[2].As<Napi::Number>().DoubleValue();
         double gamma = 1.0;
         if (info.Length() > 3) {
             gamma = info[3].As<Napi::Number>().DoubleValue();
         }
-        std::vector<Vec3> result = FrenetHelicity::evolve_vortex_knot(positions, tangents, dt, gamma);
-        return vec3_list_to_js_typedarray(env, result);
+        std::vector<Vec3> result = FrenetHelicity::evolve_vortex_knot(positions.take(), tangents.take(), dt, gamma);
+        return vec3_list_to_js_typedarray(env, std::move(result));
     }, "evolveVortexKnot"));
-    
+
+    exports.Set("evolveVortexKnotAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "evolveVortexKnotAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 3) {
+                throw Napi::Error::New(info.Env(), "Expected 3 arguments: positions, tangents, dt");
+            }
+            return async_kernel(
+                [positions = js_to_vec3_input(info[0], "positions"), tangents = js_to_vec3_input(info[1], "tangents"),
+                 dt = info[2].As<Napi::Number>().DoubleValue(),
+                 gamma = info.Length() > 3 ? info[3].As<Napi::Number>().DoubleValue() : 1.0]() mutable {
+                    return FrenetHelicity::evolve_vortex_knot(positions.take(), tangents.take(), dt, gamma);
+                },
+                vec3_result_to_js);
+        });
+    }, "evolveVortexKnotAsync"));
+
     // rk4_integrate
     exports.Set("rk4Integrate", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
         Napi::Env env = info.Env();
         if (info.Length() < 3) {
             throw Napi::Error::New(env, "Expected 3 arguments: positions, tangents, dt");
         }
-        std::vector<Vec3> positions, tangents;
-        if (info[0].IsArray()) {
-            positions = js_array_to_vec3_list(info[0].As<Napi::Array>());
-        } else if (info[0].IsTypedArray()) {
-            positions = js_typedarray_to_vec3_list(info[0].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "positions must be array or Float64Array");
-        }
-        if (info[1].IsArray()) {
-            tangents = js_array_to_vec3_list(info[1].As<Napi::Array>());
-        } else if (info[1].IsTypedArray()) {
-            tangents = js_typedarray_to_vec3_list(info[1].As<Napi::TypedArray>());
-        } else {
-            throw Napi::TypeError::New(env, "tangents must be array or Float64Array");
-        }
+        Vec3Input positions = js_to_vec3_input(info[0], "positions");
+        Vec3Input tangents = js_to_vec3_input(info[1], "tangents");
         double dt = info[2].As<Napi::Number>().DoubleValue();
         double gamma = 1.0;
         if (info.Length() > 3) {
             gamma = info[3].As<Napi::Number>().DoubleValue();
         }
-        std::vector<Vec3> result = FrenetHelicity::rk4_integrate(positions, tangents, dt, gamma);
-        return vec3_list_to_js_typedarray(env, result);
+        std::vector<Vec3> result = FrenetHelicity::rk4_integrate(positions.take(), tangents.take(), dt, gamma);
+        return vec3_list_to_js_typedarray(env, std::move(result));
     }, "rk4Integrate"));
-}
 
+    exports.Set("rk4IntegrateAsync", Napi::Function::New(env, [](const Napi::CallbackInfo& info) -> Napi::Value {
+        return run_async(info, "rk4IntegrateAsync", [](const Napi::CallbackInfo& info) {
+            if (info.Length() < 3) {
+                throw Napi::Error::New(info.Env(), "Expected 3 arguments: positions, tangents, dt");
+            }
+            return async_kernel(
+                [positions = js_to_vec3_input(info[0], "positions"), tangents = js_to_vec3_input(info[1], "tangents"),
+                 dt = info[2].As<Napi::Number>().DoubleValue(),
+                 gamma = info.Length() > 3 ? info[3].As<Napi::Number>().DoubleValue() : 1.0]() mutable {
+                    return FrenetHelicity::rk4_integrate(positions.take(), tangents.take(), dt, gamma);
+                },
+                vec3_result_to_js);
+        });
+    }, "rk4IntegrateAsync"));
+}
@@ -5,6 +5,12 @@
 #include <napi.h>
 #include <vector>
 #include <array>
+#include <exception>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include "../../include/vec3_utils.h"
 
 namespace sst {
@@ -14,6 +20,7 @@ namespace sst {
 // Convert JavaScript array of [x, y, z] arrays to std::vector<Vec3>
 static std::vector<sst::Vec3> js_array_to_vec3_list(const Napi::Array& arr) {
     std::vector<sst::Vec3> result;
+    result.reserve(arr.Length());
     for (uint32_t i = 0; i < arr.Length(); i++) {
         // Use Get() instead of operator[] to avoid ambiguity with node-addon-api v7
         Napi::Value val = arr.Get(i);
@@ -33,29 +40,66 @@ static std::vector<sst::Vec3> js_array_to_vec3_list(const Napi::Array& arr) {
     return result;
 }
 
-// Convert JavaScript TypedArray (Float64Array) with shape [N, 3] to std::vector<Vec3>
-static std::vector<sst::Vec3> js_typedarray_to_vec3_list(const Napi::TypedArray& arr) {
+// View a JavaScript Float64Array (flat [x1, y1, z1, ...]) as Vec3 rows without
+// copying. The view honours the array's byteOffset; Float64Array offsets are
+// always multiples of 8, so the rows are suitably aligned. The array must stay
+// alive (and attached) while the span is used.
+static std::span<const sst::Vec3> js_typedarray_as_vec3_span(const Napi::TypedArray& arr) {
     if (arr.TypedArrayType() != napi_float64_array) {
         throw Napi::TypeError::New(arr.Env(), "Expected Float64Array");
     }
-    Napi::ArrayBuffer buffer = arr.ArrayBuffer();
-    double* data = static_cast<double*>(buffer.Data());
-    size_t length = arr.ElementLength();
-    
+    Napi::Float64Array f64 = arr.As<Napi::Float64Array>();
+    size_t length = f64.ElementLength();
+
     if (length % 3 != 0) {
         throw Napi::TypeError::New(arr.Env(), "Array length must be multiple of 3");
     }
-    
-    std::vector<sst::Vec3> result;
-    size_t count = length / 3;
-    for (size_t i = 0; i < count; i++) {
-        sst::Vec3 v;
-        v[0] = data[i * 3];
-        v[1] = data[i * 3 + 1];
-        v[2] = data[i * 3 + 2];
-        result.push_back(v);
+    if (length == 0) {
+        return {};
     }
-    return result;
+    return {reinterpret_cast<const sst::Vec3*>(f64.Data()), length / 3};
+}
+
+// Convert JavaScript TypedArray (Float64Array) with shape [N, 3] to std::vector<Vec3>
+static std::vector<sst::Vec3> js_typedarray_to_vec3_list(const Napi::TypedArray& arr) {
+    std::span<const sst::Vec3> rows = js_typedarray_as_vec3_span(arr);
+    return std::vector<sst::Vec3>(rows.begin(), rows.end());
+}
+
+// (N,3) kernel input. A Float64Array is viewed in place; a nested
+// [[x, y, z], ...] array is converted once into `storage`. `keep` holds a
+// reference on the Float64Array so it cannot be collected while an async
+// worker reads it off the main thread.
+struct Vec3Input {
+    std::vector<sst::Vec3> storage;
+    std::span<const sst::Vec3> view;
+    Napi::ObjectReference keep;
+
+    // Owned rows for kernels that still take std::vector<Vec3>: the converted
+    // nested array is moved out, a Float64Array view is copied in one pass.
+    std::vector<sst::Vec3> take() {
+        if (view.data() == storage.data()) {
+            view = {};
+            return std::move(storage);
+        }
+        return std::vector<sst::Vec3>(view.begin(), view.end());
+    }
+};
+
+// Accepts an array of [x, y, z] arrays or a flat Float64Array; `name` is used
+// in the TypeError for anything else.
+static Vec3Input js_to_vec3_input(const Napi::Value& value, const char* name) {
+    Vec3Input input;
+    if (value.IsTypedArray()) {
+        input.view = js_typedarray_as_vec3_span(value.As<Napi::TypedArray>());
+        input.keep = Napi::Persistent(value.As<Napi::Object>());
+    } else if (value.IsArray()) {
+        input.storage = js_array_to_vec3_list(value.As<Napi::Array>());
+        input.view = input.storage;
+    } else {
+        throw Napi::TypeError::New(value.Env(), std::string(name) + " must be array or Float64Array");
+    }
+    return input;
 }
 
 // Convert std::vector<Vec3> to JavaScript array
@@ -86,6 +130,22 @@ static Napi::TypedArray vec3_list_to_js_typedarray(Napi::Env env, const std::vec
     return Napi::Float64Array::New(env, length, buffer, 0);
 }
 
+// Float64Array that takes over the buffer of vecs, as above but without the
+// copy: the vector moves to the heap and is freed when the array is collected.
+static Napi::TypedArray vec3_list_to_js_typedarray(Napi::Env env, std::vector<sst::Vec3>&& vecs) {
+#ifndef NODE_API_NO_EXTERNAL_BUFFERS_ALLOWED
+    if (!vecs.empty()) {
+        auto* owned = new std::vector<sst::Vec3>(std::move(vecs));
+        size_t length = owned->size() * 3;
+        Napi::ArrayBuffer buffer = Napi::ArrayBuffer::New(
+            env, owned->front().data(), length * sizeof(double),
+            [](Napi::Env, void*, std::vector<sst::Vec3>* hint) { delete hint; }, owned);
+        return Napi::Float64Array::New(env, length, buffer, 0);
+    }
+#endif
+    return vec3_list_to_js_typedarray(env, static_cast<const std::vector<sst::Vec3>&>(vecs));
+}
+
 // Convert JavaScript array to std::vector<double>
 static std::vector<double> js_array_to_double_vector(const Napi::Array& arr) {
     std::vector<double> result;
@@ -105,4 +165,90 @@ static Napi::Array double_vector_to_js_array(Napi::Env env, const std::vector<do
     return result;
 }
 
+// Promise-returning worker: `compute` runs on the libuv thread pool, then
+// `convert(env, result)` builds the resolution value on the main thread. A C++
+// exception from compute (or a pending JS exception from convert) rejects.
+// Inputs captured by compute are destroyed with the worker, on the main thread.
+template <class Compute, class Convert>
+class PromiseWorker : public Napi::AsyncWorker {
+public:
+    using Result = std::invoke_result_t<Compute&>;
+
+    PromiseWorker(Napi::Env env, const char* resource_name, Compute compute, Convert convert)
+        : Napi::AsyncWorker(env, resource_name),
+          deferred_(Napi::Promise::Deferred::New(env)),
+          compute_(std::move(compute)),
+          convert_(std::move(convert)) {}
+
+    Napi::Promise Promise() const { return deferred_.Promise(); }
+
+protected:
+    void Execute() override {
+        try {
+            result_.emplace(compute_());
+        } catch (const std::exception& e) {
+            SetError(e.what());
+        } catch (...) {
+            SetError("unknown C++ exception");
+        }
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::Value value = convert_(env, *result_);
+        if (env.IsExceptionPending()) {
+            deferred_.Reject(env.GetAndClearPendingException().Value());
+        } else {
+            deferred_.Resolve(value);
+        }
+    }
+
+    void OnError(const Napi::Error& e) override {
+        deferred_.Reject(e.Value());
+    }
+
+private:
+    Napi::Promise::Deferred deferred_;
+    Compute compute_;
+    Convert convert_;
+    std::optional<Result> result_;
+};
+
+template <class Compute, class Convert>
+struct AsyncKernel {
+    Compute compute;
+    Convert convert;
+};
+
+template <class Compute, class Convert>
+static AsyncKernel<Compute, Convert> async_kernel(Compute compute, Convert convert) {
+    return {std::move(compute), std::move(convert)};
+}
+
+// Body of a `*Async` export. `prepare(info)` validates the arguments on the
+// main thread and returns an async_kernel(); argument errors reject the
+// returned Promise instead of throwing.
+template <class Prepare>
+static Napi::Value run_async(const Napi::CallbackInfo& info, const char* resource_name, Prepare prepare) {
+    Napi::Env env = info.Env();
+    auto rejected = [env](Napi::Value reason) -> Napi::Value {
+        Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+        deferred.Reject(reason);
+        return deferred.Promise();
+    };
+    try {
+        auto kernel = prepare(info);
+        if (env.IsExceptionPending()) {
+            return rejected(env.GetAndClearPendingException().Value());
+        }
+        using Worker = PromiseWorker<decltype(kernel.compute), decltype(kernel.convert)>;
+        auto* worker = new Worker(env, resource_name, std::move(kernel.compute), std::move(kernel.convert));
+        Napi::Promise promise = worker->Promise();
+        worker->Queue();
+        return promise;
+    } catch (const Napi::Error& e) {
+        return rejected(e.Value());
+    }
+}
+
 #endif // NODE_UTILS_H
\ No newline at end of file
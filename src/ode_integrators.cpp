@@ -0,0 +1,355 @@
+#include "ode_integrators.h"
+#include "checkpoint.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <stdexcept>
+
+namespace sst {
+
+namespace {
+
+// Dormand & Prince (1980) RK5(4)7M tableau.
+constexpr double c2 = 1.0 / 5.0, c3 = 3.0 / 10.0, c4 = 4.0 / 5.0, c5 = 8.0 / 9.0;
+constexpr double a21 = 1.0 / 5.0;
+constexpr double a31 = 3.0 / 40.0, a32 = 9.0 / 40.0;
+constexpr double a41 = 44.0 / 45.0, a42 = -56.0 / 15.0, a43 = 32.0 / 9.0;
+constexpr double a51 = 19372.0 / 6561.0, a52 = -25360.0 / 2187.0, a53 = 64448.0 / 6561.0, a54 = -212.0 / 729.0;
+constexpr double a61 = 9017.0 / 3168.0, a62 = -355.0 / 33.0, a63 = 46732.0 / 5247.0, a64 = 49.0 / 176.0,
+                 a65 = -5103.0 / 18656.0;
+constexpr double a71 = 35.0 / 384.0, a73 = 500.0 / 1113.0, a74 = 125.0 / 192.0, a75 = -2187.0 / 6784.0,
+                 a76 = 11.0 / 84.0;
+// Error weights e = b5 - b4.
+constexpr double e1 = 71.0 / 57600.0, e3 = -71.0 / 16695.0, e4 = 71.0 / 1920.0, e5 = -17253.0 / 339200.0,
+                 e6 = 22.0 / 525.0, e7 = -1.0 / 40.0;
+
+// Carpenter & Kennedy (1994) five-stage fourth-order 2N-storage scheme.
+constexpr double lsA[5] = {0.0,
+                           -567301805773.0 / 1357537059087.0,
+                           -2404267990393.0 / 2016746695238.0,
+                           -3550918686646.0 / 2091501179385.0,
+                           -1275806237668.0 / 842570457699.0};
+constexpr double lsB[5] = {1432997174477.0 / 9575080441755.0,
+                           5161836677717.0 / 13612068292357.0,
+                           1720146321549.0 / 2090206949498.0,
+                           3134564353537.0 / 4481467310338.0,
+                           2277821191437.0 / 14882151754819.0};
+
+}  // namespace
+
+IntegratorScheme parse_integrator_scheme(const std::string& name) {
+    std::string s = name;
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    if (s == "euler") return IntegratorScheme::Euler;
+    if (s == "rk4") return IntegratorScheme::RK4;
+    if (s == "rk45" || s == "dopri5" || s == "dormand_prince") return IntegratorScheme::DormandPrince45;
+    if (s == "lsrk4" || s == "lsrk" || s == "low_storage") return IntegratorScheme::LowStorageRK4;
+    throw std::invalid_argument("Unknown integrator scheme '" + name + "' (expected euler, rk4, rk45 or lsrk4)");
+}
+
+const char* integrator_scheme_name(IntegratorScheme scheme) {
+    switch (scheme) {
+        case IntegratorScheme::Euler: return "euler";
+        case IntegratorScheme::RK4: return "rk4";
+        case IntegratorScheme::DormandPrince45: return "rk45";
+        case IntegratorScheme::LowStorageRK4: return "lsrk4";
+    }
+    return "unknown";
+}
+
+CurveIntegrator::CurveIntegrator(IntegratorOptions options) {
+    set_options(options);
+}
+
+void CurveIntegrator::set_options(const IntegratorOptions& options) {
+    if (!(options.rtol >= 0.0) || !(options.atol >= 0.0) || (options.rtol == 0.0 && options.atol == 0.0)) {
+        throw std::invalid_argument("IntegratorOptions: rtol/atol must be non-negative and not both zero");
+    }
+    if (options.dt_max != 0.0 && options.dt_min > options.dt_max) {
+        throw std::invalid_argument("IntegratorOptions: dt_min exceeds dt_max");
+    }
+    opts_ = options;
+    fsal_valid_ = false;
+    stats_.next_dt = 0.0;
+}
+
+void CurveIntegrator::reset_stats() {
+    stats_ = IntegratorStats{};
+}
+
+void CurveIntegrator::ensure_size(std::size_t n, std::size_t stages) {
+    if (k_.size() < stages) {
+        k_.resize(stages);
+    }
+    for (std::size_t s = 0; s < stages; ++s) {
+        if (k_[s].size() != n) {
+            k_[s].resize(n);
+            fsal_valid_ = false;
+        }
+    }
+    stage_.resize(n);
+    acc_.resize(n);
+}
+
+void CurveIntegrator::integrate(const Rhs& f, std::vector<Vec3>& y, double dt, std::size_t steps,
+                                const StepCallback& on_step) {
+    if (steps == 0 || y.empty()) {
+        return;
+    }
+    progress_ = IntegratorProgress{true, dt, steps, 0, dt * static_cast<double>(steps), 0.0};
+    run(f, y, on_step);
+}
+
+void CurveIntegrator::resume(const Rhs& f, std::vector<Vec3>& y, const StepCallback& on_step) {
+    if (!progress_.active || y.empty()) {
+        return;
+    }
+    run(f, y, on_step);
+}
+
+void CurveIntegrator::run(const Rhs& f, std::vector<Vec3>& y, const StepCallback& on_step) {
+    if (opts_.scheme == IntegratorScheme::DormandPrince45) {
+        integrate_adaptive(f, y, on_step);
+        progress_.active = false;
+        return;
+    }
+    const double dt = progress_.dt;
+    while (progress_.steps_done < progress_.steps) {
+        switch (opts_.scheme) {
+            case IntegratorScheme::Euler: step_euler(f, y, dt); break;
+            case IntegratorScheme::RK4: step_rk4(f, y, dt); break;
+            case IntegratorScheme::LowStorageRK4: step_lsrk4(f, y, dt); break;
+            default: break;
+        }
+        ++progress_.steps_done;
+        ++stats_.accepted_steps;
+        stats_.last_dt = dt;
+        if (on_step) on_step(dt);
+    }
+    progress_.active = false;
+}
+
+void CurveIntegrator::save_state(SnapshotWriter& out) const {
+    out.u64(static_cast<std::uint64_t>(opts_.scheme));
+    out.f64(opts_.rtol);
+    out.f64(opts_.atol);
+    out.f64(opts_.dt_min);
+    out.f64(opts_.dt_max);
+    out.f64(opts_.safety);
+    out.u64(opts_.max_steps);
+    out.u64(stats_.rhs_evaluations);
+    out.u64(stats_.accepted_steps);
+    out.u64(stats_.rejected_steps);
+    out.f64(stats_.last_dt);
+    out.f64(stats_.next_dt);
+    out.f64(stats_.last_error);
+    out.boolean(progress_.active);
+    out.f64(progress_.dt);
+    out.u64(progress_.steps);
+    out.u64(progress_.steps_done);
+    out.f64(progress_.span);
+    out.f64(progress_.t);
+    const bool fsal = fsal_valid_ && !k_.empty();
+    out.boolean(fsal);
+    out.points(fsal ? k_[0] : std::vector<Vec3>{});
+}
+
+void CurveIntegrator::load_state(SnapshotReader& in) {
+    IntegratorOptions o;
+    const std::uint64_t scheme = in.u64();
+    if (scheme > static_cast<std::uint64_t>(IntegratorScheme::LowStorageRK4)) {
+        throw std::runtime_error("CurveIntegrator: snapshot holds an unknown integrator scheme");
+    }
+    o.scheme = static_cast<IntegratorScheme>(scheme);
+    o.rtol = in.f64();
+    o.atol = in.f64();
+    o.dt_min = in.f64();
+    o.dt_max = in.f64();
+    o.safety = in.f64();
+    o.max_steps = in.u64();
+    set_options(o);
+    stats_.rhs_evaluations = in.u64();
+    stats_.accepted_steps = in.u64();
+    stats_.rejected_steps = in.u64();
+    stats_.last_dt = in.f64();
+    stats_.next_dt = in.f64();
+    stats_.last_error = in.f64();
+    progress_.active = in.boolean();
+    progress_.dt = in.f64();
+    progress_.steps = in.u64();
+    progress_.steps_done = in.u64();
+    progress_.span = in.f64();
+    progress_.t = in.f64();
+    const bool fsal = in.boolean();
+    std::vector<Vec3> k0 = in.points();
+    fsal_valid_ = false;
+    if (fsal) {
+        ensure_size(k0.size(), 7);
+        k_[0] = std::move(k0);
+        fsal_valid_ = true;
+    }
+}
+
+void CurveIntegrator::step_euler(const Rhs& f, std::vector<Vec3>& y, double h) {
+    const std::size_t n = y.size();
+    ensure_size(n, 1);
+    f(y, k_[0]);
+    ++stats_.rhs_evaluations;
+    for (std::size_t i = 0; i < n; ++i) {
+        for (int d = 0; d < 3; ++d) y[i][d] += h * k_[0][i][d];
+    }
+}
+
+void CurveIntegrator::step_rk4(const Rhs& f, std::vector<Vec3>& y, double h) {
+    const std::size_t n = y.size();
+    ensure_size(n, 4);
+    auto& k1 = k_[0];
+    auto& k2 = k_[1];
+    auto& k3 = k_[2];
+    auto& k4 = k_[3];
+    f(y, k1);
+    for (std::size_t i = 0; i < n; ++i)
+        for (int d = 0; d < 3; ++d) stage_[i][d] = y[i][d] + 0.5 * h * k1[i][d];
+    f(stage_, k2);
+    for (std::size_t i = 0; i < n; ++i)
+        for (int d = 0; d < 3; ++d) stage_[i][d] = y[i][d] + 0.5 * h * k2[i][d];
+    f(stage_, k3);
+    for (std::size_t i = 0; i < n; ++i)
+        for (int d = 0; d < 3; ++d) stage_[i][d] = y[i][d] + h * k3[i][d];
+    f(stage_, k4);
+    stats_.rhs_evaluations += 4;
+    const double h6 = h / 6.0;
+    for (std::size_t i = 0; i < n; ++i)
+        for (int d = 0; d < 3; ++d) y[i][d] += h6 * (k1[i][d] + 2.0 * k2[i][d] + 2.0 * k3[i][d] + k4[i][d]);
+}
+
+void CurveIntegrator::step_lsrk4(const Rhs& f, std::vector<Vec3>& y, double h) {
+    // Registers: y and the accumulator dY, plus one derivative buffer.
+    const std::size_t n = y.size();
+    ensure_size(n, 1);
+    auto& k = k_[0];
+    for (std::size_t i = 0; i < n; ++i) acc_[i] = {0.0, 0.0, 0.0};
+    for (int s = 0; s < 5; ++s) {
+        f(y, k);
+        ++stats_.rhs_evaluations;
+        for (std::size_t i = 0; i < n; ++i) {
+            for (int d = 0; d < 3; ++d) {
+                acc_[i][d] = lsA[s] * acc_[i][d] + h * k[i][d];
+                y[i][d] += lsB[s] * acc_[i][d];
+            }
+        }
+    }
+}
+
+double CurveIntegrator::attempt_dopri(const Rhs& f, std::vector<Vec3>& y, double h) {
+    const std::size_t n = y.size();
+    ensure_size(n, 7);
+    auto& k1 = k_[0];
+    auto& k2 = k_[1];
+    auto& k3 = k_[2];
+    auto& k4 = k_[3];
+    auto& k5 = k_[4];
+    auto& k6 = k_[5];
+    auto& k7 = k_[6];
+    if (!fsal_valid_) {
+        f(y, k1);
+        ++stats_.rhs_evaluations;
+        fsal_valid_ = true;
+    }
+    for (std::size_t i = 0; i < n; ++i)
+        for (int d = 0; d < 3; ++d) stage_[i][d] = y[i][d] + h * a21 * k1[i][d];
+    f(stage_, k2);
+    for (std::size_t i = 0; i < n; ++i)
+        for (int d = 0; d < 3; ++d) stage_[i][d] = y[i][d] + h * (a31 * k1[i][d] + a32 * k2[i][d]);
+    f(stage_, k3);
+    for (std::size_t i = 0; i < n; ++i)
+        for (int d = 0; d < 3; ++d)
+            stage_[i][d] = y[i][d] + h * (a41 * k1[i][d] + a42 * k2[i][d] + a43 * k3[i][d]);
+    f(stage_, k4);
+    for (std::size_t i = 0; i < n; ++i)
+        for (int d = 0; d < 3; ++d)
+            stage_[i][d] = y[i][d] + h * (a51 * k1[i][d] + a52 * k2[i][d] + a53 * k3[i][d] + a54 * k4[i][d]);
+    f(stage_, k5);
+    for (std::size_t i = 0; i < n; ++i)
+        for (int d = 0; d < 3; ++d)
+            stage_[i][d] = y[i][d] + h * (a61 * k1[i][d] + a62 * k2[i][d] + a63 * k3[i][d] + a64 * k4[i][d] +
+                                          a65 * k5[i][d]);
+    f(stage_, k6);
+    // 5th-order solution (also the FSAL point) into acc_.
+    for (std::size_t i = 0; i < n; ++i)
+        for (int d = 0; d < 3; ++d)
+            acc_[i][d] = y[i][d] + h * (a71 * k1[i][d] + a73 * k3[i][d] + a74 * k4[i][d] + a75 * k5[i][d] +
+                                        a76 * k6[i][d]);
+    f(acc_, k7);
+    stats_.rhs_evaluations += 6;
+
+    double err2 = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        for (int d = 0; d < 3; ++d) {
+            const double e = h * (e1 * k1[i][d] + e3 * k3[i][d] + e4 * k4[i][d] + e5 * k5[i][d] +
+                                  e6 * k6[i][d] + e7 * k7[i][d]);
+            const double sc = opts_.atol + opts_.rtol * std::max(std::fabs(y[i][d]), std::fabs(acc_[i][d]));
+            err2 += (e / sc) * (e / sc);
+        }
+    }
+    const double err = std::sqrt(err2 / static_cast<double>(3 * n));
+    if (err <= 1.0 && std::isfinite(err)) {
+        y.swap(acc_);
+        k1.swap(k7);  // FSAL: f(y_{n+1}) is the next step's first stage
+    }
+    return err;
+}
+
+void CurveIntegrator::integrate_adaptive(const Rhs& f, std::vector<Vec3>& y, const StepCallback& on_step) {
+    const double span = progress_.span;
+    if (!(span > 0.0)) {
+        return;
+    }
+    const double floor_dt = std::max(opts_.dt_min, 1e-14 * span);
+    double h = stats_.next_dt > 0.0 ? stats_.next_dt : progress_.dt;
+    if (opts_.dt_max > 0.0) h = std::min(h, opts_.dt_max);
+    double& t = progress_.t;
+    std::size_t taken = 0;
+    while (t < span) {
+        if (++taken > opts_.max_steps) {
+            throw std::runtime_error("CurveIntegrator: max_steps exceeded (tolerance too tight for dt_min?)");
+        }
+        const double remaining = span - t;
+        const bool last = h >= remaining;
+        const double h_try = last ? remaining : h;
+        const double err = attempt_dopri(f, y, h_try);
+        stats_.last_error = err;
+
+        double factor;
+        if (!std::isfinite(err)) {
+            factor = 0.2;
+        } else if (err == 0.0) {
+            factor = 5.0;
+        } else {
+            factor = std::clamp(opts_.safety * std::pow(err, -0.2), 0.2, 5.0);
+        }
+
+        if (err <= 1.0 && std::isfinite(err)) {
+            t = last ? span : t + h_try;
+            ++stats_.accepted_steps;
+            stats_.last_dt = h_try;
+            // A clipped final step says nothing about the natural step size.
+            if (!last || h_try >= h) {
+                h = h_try * std::min(factor, 5.0);
+            }
+            if (opts_.dt_max > 0.0) h = std::min(h, opts_.dt_max);
+            stats_.next_dt = h;
+            if (on_step) on_step(h_try);
+            // The callback may have changed y (size or values).
+            if (k_[0].size() != y.size()) fsal_valid_ = false;
+        } else {
+            ++stats_.rejected_steps;
+            if (h_try <= floor_dt) {
+                throw std::runtime_error("CurveIntegrator: step size underflow (dt below dt_min)");
+            }
+            h = std::max(h_try * std::min(factor, 1.0), floor_dt);
+        }
+    }
+}
+
+} // namespace sst
@@ -0,0 +1,130 @@
+#ifndef SWIRL_STRING_CORE_ODE_INTEGRATORS_H
+#define SWIRL_STRING_CORE_ODE_INTEGRATORS_H
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace sst {
+
+using Vec3 = std::array<double, 3>;
+
+enum class IntegratorScheme {
+    Euler,            // forward Euler (historical default)
+    RK4,              // classical 4-stage Runge-Kutta
+    DormandPrince45,  // embedded RK5(4), FSAL, adaptive dt
+    LowStorageRK4,    // Carpenter-Kennedy 5-stage 4th order, 2N storage
+};
+
+// Accepts "euler", "rk4", "rk45"/"dopri5"/"dormand_prince", "lsrk4"/"lsrk"/"low_storage".
+IntegratorScheme parse_integrator_scheme(const std::string& name);
+const char* integrator_scheme_name(IntegratorScheme scheme);
+
+struct IntegratorOptions {
+    IntegratorScheme scheme = IntegratorScheme::Euler;
+    // Adaptive control (DormandPrince45 only): per-component tolerance atol + rtol*|y|.
+    double rtol = 1e-6;
+    double atol = 1e-9;
+    double dt_min = 0.0;       // 0 -> no floor beyond round-off
+    double dt_max = 0.0;       // 0 -> unbounded
+    double safety = 0.9;
+    std::size_t max_steps = 1000000;  // per integrate() call
+};
+
+class SnapshotWriter;
+class SnapshotReader;
+
+struct IntegratorStats {
+    std::size_t rhs_evaluations = 0;
+    std::size_t accepted_steps = 0;
+    std::size_t rejected_steps = 0;
+    double last_dt = 0.0;     // size of the last accepted step
+    double next_dt = 0.0;     // controller proposal for the next step (adaptive)
+    double last_error = 0.0;  // normalized error estimate of the last attempt (adaptive)
+};
+
+// Position inside the current integrate() call. It stays set while step
+// callbacks run (and after an exception escapes one), so a snapshot taken
+// there can continue the call exactly via CurveIntegrator::resume().
+struct IntegratorProgress {
+    bool active = false;
+    double dt = 0.0;
+    std::size_t steps = 0;
+    std::size_t steps_done = 0;  // fixed-step schemes
+    double span = 0.0;           // adaptive: dt * steps
+    double t = 0.0;              // adaptive: part of span already covered
+};
+
+/**
+ * @brief Explicit integrators for autonomous curve ODEs dy/dt = f(y), y = N points.
+ *
+ * Stage buffers are members sized on first use and reused across steps and
+ * calls, so a running evolution allocates nothing per step. The right-hand
+ * side writes into a caller-provided buffer of the same size as y.
+ */
+class CurveIntegrator {
+public:
+    using Rhs = std::function<void(const std::vector<Vec3>& y, std::vector<Vec3>& dydt)>;
+    // Called after every accepted step with its size. It may modify y (even
+    // resize it) provided it calls invalidate().
+    using StepCallback = std::function<void(double h)>;
+
+    explicit CurveIntegrator(IntegratorOptions options = {});
+
+    void set_options(const IntegratorOptions& options);
+    const IntegratorOptions& options() const { return opts_; }
+    const IntegratorStats& stats() const { return stats_; }
+    void reset_stats();
+
+    // Fixed-step schemes take `steps` steps of dt. DormandPrince45 covers the
+    // same span dt*steps with adaptive sub-steps, starting from the previous
+    // call's proposal (or dt) and landing exactly on the end time.
+    void integrate(const Rhs& f, std::vector<Vec3>& y, double dt, std::size_t steps,
+                   const StepCallback& on_step = nullptr);
+
+    // Drop the cached derivative (FSAL) after y was modified outside the
+    // stepper (e.g. remeshed from a step callback).
+    void invalidate() { fsal_valid_ = false; }
+
+    // invalidate() and forget the adaptive step proposal (new initial state).
+    void reset() {
+        fsal_valid_ = false;
+        stats_.next_dt = 0.0;
+        progress_ = IntegratorProgress{};
+    }
+
+    const IntegratorProgress& progress() const { return progress_; }
+    // Finish the integrate() call recorded in progress() (no-op when none is
+    // pending), e.g. after load_state() from a mid-call snapshot.
+    void resume(const Rhs& f, std::vector<Vec3>& y, const StepCallback& on_step = nullptr);
+
+    // Options, stats, progress and the FSAL derivative: everything needed to
+    // continue bit-identically. Scratch stage buffers are not saved.
+    void save_state(SnapshotWriter& out) const;
+    void load_state(SnapshotReader& in);
+
+private:
+    void ensure_size(std::size_t n, std::size_t stages);
+    void step_euler(const Rhs& f, std::vector<Vec3>& y, double h);
+    void step_rk4(const Rhs& f, std::vector<Vec3>& y, double h);
+    void step_lsrk4(const Rhs& f, std::vector<Vec3>& y, double h);
+    // Returns the normalized error; on success (<= 1) y holds the new state.
+    double attempt_dopri(const Rhs& f, std::vector<Vec3>& y, double h);
+    void run(const Rhs& f, std::vector<Vec3>& y, const StepCallback& on_step);
+    void integrate_adaptive(const Rhs& f, std::vector<Vec3>& y, const StepCallback& on_step);
+
+    IntegratorOptions opts_;
+    IntegratorStats stats_;
+    std::vector<std::vector<Vec3>> k_;  // stage derivatives
+    std::vector<Vec3> stage_;           // stage state
+    std::vector<Vec3> acc_;             // low-storage accumulator / embedded solution
+    bool fsal_valid_ = false;           // k_[0] == f(y) from the previous DP step
+    IntegratorProgress progress_;
+};
+
+} // namespace sst
+
+#endif // SWIRL_STRING_CORE_ODE_INTEGRATORS_H
@@ -1,38 +1,1000 @@
 #include "potential_timefield.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cctype>
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
 namespace sst {
 
+        namespace {
+
+                constexpr std::size_t kSerialTargets = 256;  // below this, threads cost more than they save
+                constexpr std::size_t kTargetGrain = 16;
+                // Relative per-item costs for select_gauss_sum_method, in units of one
+                // all-pairs term (distance + exp + 3 FMAs).
+                constexpr double kCutoffPairCost = 0.3;      // contiguous, vectorized rows
+                constexpr double kFgtTermCost = 0.1;       // one monomial times 3 coefficients
+                constexpr double kFgtClusterTestCost = 0.1;
+                constexpr std::size_t kFgtMaxOrder = 40;
+                constexpr std::size_t kFgtCostSamples = 64;
+                constexpr std::size_t kFgtMaxGridCells = std::size_t(1) << 21;
+                constexpr std::size_t kFgtMaxCoefficients = std::size_t(1) << 23;  // 64 MB of doubles
+                // Candidate cluster edges, in units of the kernel length h = sqrt(2) eps.
+                constexpr double kFgtCellSides[] = {0.35, 0.5, 0.75, 1.0};
+
+                // Kernel sum g_i = sum_{j != i} exp(-|x_i - x_j|^2 / h2) w_j, all pairs.
+                void gauss_sum_direct(const std::vector<Vec3>& X, const std::vector<Vec3>& W,
+                                      double h2, std::vector<Vec3>& g) {
+                        const std::size_t n = X.size();
+                        const double inv = 1.0 / h2;
+                        auto rows = [&](std::size_t lo, std::size_t hi) {
+                                for (std::size_t i = lo; i < hi; ++i) {
+                                        double gx = 0.0, gy = 0.0, gz = 0.0;
+                                        for (std::size_t j = 0; j < n; ++j) {
+                                                if (i == j) continue;
+                                                const double dx = X[i][0] - X[j][0];
+                                                const double dy = X[i][1] - X[j][1];
+                                                const double dz = X[i][2] - X[j][2];
+                                                const double w = std::exp(-(dx * dx + dy * dy + dz * dz) * inv);
+                                                gx += w * W[j][0];
+                                                gy += w * W[j][1];
+                                                gz += w * W[j][2];
+                                        }
+                                        g[i] = {gx, gy, gz};
+                                }
+                        };
+                        if (n < kSerialTargets) {
+                                rows(0, n);
+                        } else {
+                                parallel_for(0, n, kTargetGrain, rows);
+                        }
+                }
+
+                // Occupied cells of an unbounded cubic grid, found by sorting points on
+                // a packed 21-bit-per-axis cell key. Unlike CellList, memory scales with
+                // the points rather than the bounding box, so a cutoff of a few eps over
+                // a large, sparse cloud (a long filament) keeps cells at the cutoff size.
+                struct SparseCellGrid {
+                        static constexpr std::uint64_t kAxisCells = (std::uint64_t(1) << 21) - 1;
+
+                        std::vector<std::size_t> order;       // point indices grouped by cell
+                        std::vector<std::size_t> start;       // CSR into order, cells + 1
+                        std::vector<std::size_t> nb_start;    // CSR into nb, cells + 1
+                        std::vector<std::size_t> nb;          // the <= 27 cells around each cell
+                        std::size_t candidate_pairs = 0;      // sum of count(c) * count(block(c))
+
+                        std::size_t cells() const { return start.size() - 1; }
+
+                        bool build(const std::vector<Vec3>& X, double edge) {
+                                const std::size_t n = X.size();
+                                double lo[3], hi[3];
+                                for (int d = 0; d < 3; ++d) {
+                                        lo[d] = std::numeric_limits<double>::infinity();
+                                        hi[d] = -std::numeric_limits<double>::infinity();
+                                }
+                                for (const Vec3& x : X) {
+                                        for (int d = 0; d < 3; ++d) {
+                                                lo[d] = std::min(lo[d], x[d]);
+                                                hi[d] = std::max(hi[d], x[d]);
+                                        }
+                                }
+                                for (int d = 0; d < 3; ++d) {
+                                        if (!(hi[d] - lo[d] < std::numeric_limits<double>::max())) {
+                                                return false;  // non-finite coordinates
+                                        }
+                                        // Larger cells stay correct (neighbours still within the 27 block).
+                                        edge = std::max(edge, (hi[d] - lo[d]) / static_cast<double>(kAxisCells - 1));
+                                }
+                                auto key_of = [&](const Vec3& x) {
+                                        std::uint64_t key = 0;
+                                        for (int d = 0; d < 3; ++d) {
+                                                const auto c = std::min(static_cast<std::uint64_t>((x[d] - lo[d]) / edge), kAxisCells - 1);
+                                                key = (key << 21) | c;
+                                        }
+                                        return key;
+                                };
+                                std::vector<std::pair<std::uint64_t, std::size_t>> keyed(n);
+                                for (std::size_t i = 0; i < n; ++i) {
+                                        keyed[i] = {key_of(X[i]), i};
+                                }
+                                std::sort(keyed.begin(), keyed.end());
+
+                                std::vector<std::uint64_t> keys;
+                                order.resize(n);
+                                start.clear();
+                                for (std::size_t k = 0; k < n; ++k) {
+                                        if (k == 0 || keyed[k].first != keyed[k - 1].first) {
+                                                keys.push_back(keyed[k].first);
+                                                start.push_back(k);
+                                        }
+                                        order[k] = keyed[k].second;
+                                }
+                                start.push_back(n);
+
+                                // Neighbour cells by a merge sweep: for each of the 9 (x, y)
+                                // row offsets the first wanted key only grows with c, so one
+                                // forward-only cursor per offset finds every block in O(cells).
+                                const std::size_t K = keys.size();
+                                nb_start.assign(1, 0);
+                                nb.clear();
+                                nb.reserve(9 * K);
+                                candidate_pairs = 0;
+                                std::size_t cursor[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+                                for (std::size_t c = 0; c < K; ++c) {
+                                        const std::uint64_t cx = keys[c] >> 42, cy = (keys[c] >> 21) & kAxisCells,
+                                                            cz = keys[c] & kAxisCells;
+                                        const std::uint64_t z0 = cz > 0 ? cz - 1 : 0, z1 = std::min(cz + 1, kAxisCells - 1);
+                                        std::size_t block = 0;
+                                        for (int o = 0; o < 9; ++o) {
+                                                const std::uint64_t x = cx + static_cast<std::uint64_t>(o / 3) - 1;
+                                                const std::uint64_t y = cy + static_cast<std::uint64_t>(o % 3) - 1;
+                                                if (x > kAxisCells - 1 || y > kAxisCells - 1) {
+                                                        continue;  // off the grid (unsigned wrap below 0)
+                                                }
+                                                const std::uint64_t row = (x << 42) | (y << 21);
+                                                std::size_t& q = cursor[o];
+                                                while (q < K && keys[q] < (row | z0)) ++q;
+                                                for (std::size_t j = q; j < K && keys[j] <= (row | z1); ++j) {
+                                                        nb.push_back(j);
+                                                        block += start[j + 1] - start[j];
+                                                }
+                                        }
+                                        nb_start.push_back(nb.size());
+                                        candidate_pairs += (start[c + 1] - start[c]) * block;
+                                }
+                                return true;
+                        }
+                };
+
+                // Same sum over the 27 cells around each point of a grid whose edge is
+                // at least the cutoff radius. Sources are copied into cell order so each
+                // neighbour cell is one contiguous, branch-free inner loop, and targets
+                // are processed cell by cell so they share that block.
+                void gauss_sum_cutoff(const std::vector<Vec3>& X, const std::vector<Vec3>& W,
+                                      double h2, const SparseCellGrid& grid, std::vector<Vec3>& g) {
+                        const std::size_t n = X.size();
+                        const std::vector<std::size_t>& order = grid.order;
+                        std::vector<double> xs(n), ys(n), zs(n), wx(n), wy(n), wz(n);
+                        for (std::size_t k = 0; k < n; ++k) {
+                                const std::size_t j = order[k];
+                                xs[k] = X[j][0]; ys[k] = X[j][1]; zs[k] = X[j][2];
+                                wx[k] = W[j][0]; wy[k] = W[j][1]; wz[k] = W[j][2];
+                        }
+                        const double inv = 1.0 / h2;
+                        auto cells = [&](std::size_t lo, std::size_t hi) {
+                                for (std::size_t c = lo; c < hi; ++c) {
+                                        for (std::size_t self = grid.start[c]; self < grid.start[c + 1]; ++self) {
+                                                const double px = xs[self], py = ys[self], pz = zs[self];
+                                                double gx = 0.0, gy = 0.0, gz = 0.0;
+                                                for (std::size_t q = grid.nb_start[c]; q < grid.nb_start[c + 1]; ++q) {
+                                                        const std::size_t b = grid.start[grid.nb[q]], e = grid.start[grid.nb[q] + 1];
+                                                        for (std::size_t k = b; k < e; ++k) {
+                                                                const double dx = px - xs[k];
+                                                                const double dy = py - ys[k];
+                                                                const double dz = pz - zs[k];
+                                                                double w = std::exp(-(dx * dx + dy * dy + dz * dz) * inv);
+                                                                w = k == self ? 0.0 : w;
+                                                                gx += w * wx[k];
+                                                                gy += w * wy[k];
+                                                                gz += w * wz[k];
+                                                        }
+                                                }
+                                                g[order[self]] = {gx, gy, gz};
+                                        }
+                                }
+                        };
+                        if (n < kSerialTargets) {
+                                cells(0, grid.cells());
+                        } else {
+                                parallel_for(0, grid.cells(), 1, cells);
+                        }
+                }
+
+                // Improved fast Gauss transform (Yang, Duraiswami, Gumerov 2003):
+                //   g(y) ~ sum_k exp(-|y-c_k|^2/h^2) sum_{|a|<p} C_ka ((y-c_k)/h)^a,
+                //   C_ka = 2^|a|/a! sum_{x_j in k} w_j exp(-|x_j-c_k|^2/h^2) ((x_j-c_k)/h)^a,
+                // with clusters = occupied cells of a grid of edge side*h centred on
+                // c_k, and only clusters within cutoff*h of y evaluated.
+                struct FgtPlan {
+                        bool feasible = false;
+                        double h = 0.0;
+                        double side = 0.0;       // cell edge / h
+                        double cutoff = 0.0;     // target-centre radius / h
+                        std::size_t order = 0;   // p: monomials of total degree < p
+                        std::size_t terms = 0;   // C(p + 2, 3)
+                        double lo[3] = {0.0, 0.0, 0.0};
+                        std::size_t dims[3] = {0, 0, 0};
+                        std::vector<std::uint32_t> cell_count;  // points per grid cell
+                        std::size_t clusters = 0;
+                        double cost = 0.0;
+                };
+
+                // Smallest p whose truncation bound (2^p/p!) (rx ry)^p exp(-(ry-rx)^2)
+                // stays below tol for every evaluated centre distance ry <= cutoff
+                // (all lengths in units of h); 0 if none up to kFgtMaxOrder.
+                std::size_t fgt_order(double rx, double cutoff, double tol) {
+                        constexpr int kSamples = 256;
+                        for (std::size_t p = 1; p <= kFgtMaxOrder; ++p) {
+                                double lgamma_p = std::lgamma(static_cast<double>(p) + 1.0);
+                                double worst = -std::numeric_limits<double>::infinity();
+                                for (int k = 1; k <= kSamples; ++k) {
+                                        const double ry = cutoff * k / kSamples;
+                                        const double gap = std::max(ry - rx, 0.0);
+                                        const double log_bound = static_cast<double>(p) * std::log(2.0 * rx * ry)
+                                                                 - lgamma_p - gap * gap;
+                                        worst = std::max(worst, log_bound);
+                                }
+                                if (worst <= std::log(tol)) {
+                                        return p;
+                                }
+                        }
+                        return 0;
+                }
+
+                FgtPlan plan_fgt(const std::vector<Vec3>& X, double h, double tol, double side,
+                                 const double lo[3], const double hi[3]) {
+                        FgtPlan plan;
+                        const std::size_t n = X.size();
+                        plan.h = h;
+                        plan.side = side;
+                        const double rx = side * std::sqrt(3.0) / 2.0;
+                        plan.cutoff = rx + std::sqrt(std::log(1.0 / tol));
+                        plan.order = fgt_order(rx, plan.cutoff, tol);
+                        if (plan.order == 0) {
+                                return plan;
+                        }
+                        plan.terms = plan.order * (plan.order + 1) * (plan.order + 2) / 6;
+                        const double edge = side * h;
+                        double cells = 1.0;
+                        for (int d = 0; d < 3; ++d) {
+                                plan.lo[d] = lo[d];
+                                const double span = std::floor((hi[d] - lo[d]) / edge) + 1.0;
+                                cells *= span;
+                                if (!(cells <= static_cast<double>(kFgtMaxGridCells))) {
+                                        return plan;
+                                }
+                                plan.dims[d] = static_cast<std::size_t>(span);
+                        }
+                        plan.cell_count.assign(static_cast<std::size_t>(cells), 0);
+                        for (const Vec3& x : X) {
+                                std::size_t c[3];
+                                for (int d = 0; d < 3; ++d) {
+                                        c[d] = std::min(static_cast<std::size_t>((x[d] - lo[d]) / edge), plan.dims[d] - 1);
+                                }
+                                if (plan.cell_count[(c[0] * plan.dims[1] + c[1]) * plan.dims[2] + c[2]]++ == 0) {
+                                        ++plan.clusters;
+                                }
+                        }
+                        if (plan.clusters * plan.terms * 3 > kFgtMaxCoefficients) {
+                                return plan;
+                        }
+                        // Clusters a target visits, averaged over a sample of targets.
+                        std::vector<Vec3> centres;
+                        centres.reserve(plan.clusters);
+                        for (std::size_t c = 0; c < plan.cell_count.size(); ++c) {
+                                if (plan.cell_count[c] == 0) continue;
+                                const std::size_t cz = c % plan.dims[2];
+                                const std::size_t cy = (c / plan.dims[2]) % plan.dims[1];
+                                const std::size_t cx = c / (plan.dims[1] * plan.dims[2]);
+                                centres.push_back({lo[0] + (cx + 0.5) * edge, lo[1] + (cy + 0.5) * edge,
+                                                   lo[2] + (cz + 0.5) * edge});
+                        }
+                        const std::size_t samples = std::min<std::size_t>(n, kFgtCostSamples);
+                        const double reach2 = plan.cutoff * plan.cutoff * h * h;
+                        std::size_t hits = 0;
+                        for (std::size_t s = 0; s < samples; ++s) {
+                                const Vec3& y = X[s * n / samples];
+                                for (const Vec3& c : centres) {
+                                        const double dx = y[0] - c[0], dy = y[1] - c[1], dz = y[2] - c[2];
+                                        hits += dx * dx + dy * dy + dz * dz <= reach2 ? 1 : 0;
+                                }
+                        }
+                        const double visited = static_cast<double>(hits) / static_cast<double>(samples);
+                        const double nd = static_cast<double>(n);
+                        plan.cost = nd * static_cast<double>(plan.terms) * (1.0 + visited) * kFgtTermCost
+                                    + nd * static_cast<double>(plan.clusters) * kFgtClusterTestCost;
+                        plan.feasible = true;
+                        return plan;
+                }
+
+                // Monomials ((d)^a) for |a| < p in graded order, m[0] = 1.
+                void fgt_monomials(const double d[3], std::size_t p, double* m) {
+                        m[0] = 1.0;
+                        std::size_t heads[3] = {0, 0, 0};
+                        std::size_t t = 1;
+                        for (std::size_t k = 1; k < p; ++k) {
+                                const std::size_t tail = t;
+                                for (int i = 0; i < 3; ++i) {
+                                        const std::size_t head = heads[i];
+                                        heads[i] = t;
+                                        for (std::size_t j = head; j < tail; ++j) {
+                                                m[t++] = d[i] * m[j];
+                                        }
+                                }
+                        }
+                }
+
+                void gauss_sum_fgt(const std::vector<Vec3>& X, const std::vector<Vec3>& W,
+                                   const FgtPlan& plan, std::vector<Vec3>& g) {
+                        const std::size_t n = X.size();
+                        const std::size_t p = plan.order, terms = plan.terms;
+                        const double h = plan.h, inv_h = 1.0 / h, edge = plan.side * h;
+                        const std::size_t cells = plan.cell_count.size();
+
+                        // 2^|a| / a! in the monomial order: same recursion on exponents.
+                        std::vector<double> scale(terms);
+                        {
+                                std::vector<std::array<int, 3>> alpha(terms);
+                                alpha[0] = {0, 0, 0};
+                                std::size_t heads[3] = {0, 0, 0};
+                                std::size_t t = 1;
+                                for (std::size_t k = 1; k < p; ++k) {
+                                        const std::size_t tail = t;
+                                        for (int i = 0; i < 3; ++i) {
+                                                const std::size_t head = heads[i];
+                                                heads[i] = t;
+                                                for (std::size_t j = head; j < tail; ++j) {
+                                                        alpha[t] = alpha[j];
+                                                        ++alpha[t++][i];
+                                                }
+                                        }
+                                }
+                                for (std::size_t t2 = 0; t2 < terms; ++t2) {
+                                        const auto& a = alpha[t2];
+                                        scale[t2] = std::exp2(a[0] + a[1] + a[2]) /
+                                                    (std::tgamma(a[0] + 1.0) * std::tgamma(a[1] + 1.0) * std::tgamma(a[2] + 1.0));
+                                }
+                        }
+
+                        // Clusters: occupied cells, sources grouped by cluster (counting sort).
+                        std::vector<std::int64_t> cluster_of_cell(cells, -1);
+                        std::vector<Vec3> centre;
+                        std::vector<std::size_t> start(1, 0);
+                        centre.reserve(plan.clusters);
+                        for (std::size_t c = 0; c < cells; ++c) {
+                                if (plan.cell_count[c] == 0) continue;
+                                cluster_of_cell[c] = static_cast<std::int64_t>(centre.size());
+                                const std::size_t cz = c % plan.dims[2];
+                                const std::size_t cy = (c / plan.dims[2]) % plan.dims[1];
+                                const std::size_t cx = c / (plan.dims[1] * plan.dims[2]);
+                                centre.push_back({plan.lo[0] + (cx + 0.5) * edge, plan.lo[1] + (cy + 0.5) * edge,
+                                                  plan.lo[2] + (cz + 0.5) * edge});
+                                start.push_back(start.back() + plan.cell_count[c]);
+                        }
+                        const std::size_t K = centre.size();
+                        std::vector<std::size_t> members(n);
+                        {
+                                std::vector<std::size_t> fill(start.begin(), start.end() - 1);
+                                for (std::size_t i = 0; i < n; ++i) {
+                                        std::size_t c[3];
+                                        for (int d = 0; d < 3; ++d) {
+                                                c[d] = std::min(static_cast<std::size_t>((X[i][d] - plan.lo[d]) / edge),
+                                                                plan.dims[d] - 1);
+                                        }
+                                        const auto k = cluster_of_cell[(c[0] * plan.dims[1] + c[1]) * plan.dims[2] + c[2]];
+                                        members[fill[static_cast<std::size_t>(k)]++] = i;
+                                }
+                        }
+
+                        // Source pass: coefficients per cluster, laid out [k][t][xyz].
+                        std::vector<double> coeff(K * terms * 3, 0.0);
+                        parallel_for(0, K, 1, [&](std::size_t lo, std::size_t hi) {
+                                std::vector<double> m(terms);
+                                for (std::size_t k = lo; k < hi; ++k) {
+                                        double* C = coeff.data() + k * terms * 3;
+                                        for (std::size_t s = start[k]; s < start[k + 1]; ++s) {
+                                                const std::size_t j = members[s];
+                                                const double d[3] = {(X[j][0] - centre[k][0]) * inv_h,
+                                                                     (X[j][1] - centre[k][1]) * inv_h,
+                                                                     (X[j][2] - centre[k][2]) * inv_h};
+                                                const double w = std::exp(-(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]));
+                                                fgt_monomials(d, p, m.data());
+                                                const double qx = w * W[j][0], qy = w * W[j][1], qz = w * W[j][2];
+                                                for (std::size_t t = 0; t < terms; ++t) {
+                                                        C[3 * t] += qx * m[t];
+                                                        C[3 * t + 1] += qy * m[t];
+                                                        C[3 * t + 2] += qz * m[t];
+                                                }
+                                        }
+                                        for (std::size_t t = 0; t < terms; ++t) {
+                                                C[3 * t] *= scale[t];
+                                                C[3 * t + 1] *= scale[t];
+                                                C[3 * t + 2] *= scale[t];
+                                        }
+                                }
+                        });
+
+                        // Target pass: nearby clusters only, then drop the self term
+                        // (the kernel is exactly 1 at zero distance).
+                        const double reach2 = plan.cutoff * plan.cutoff;
+                        auto rows = [&](std::size_t lo, std::size_t hi) {
+                                std::vector<double> m(terms);
+                                for (std::size_t i = lo; i < hi; ++i) {
+                                        double gx = 0.0, gy = 0.0, gz = 0.0;
+                                        for (std::size_t k = 0; k < K; ++k) {
+                                                const double d[3] = {(X[i][0] - centre[k][0]) * inv_h,
+                                                                     (X[i][1] - centre[k][1]) * inv_h,
+                                                                     (X[i][2] - centre[k][2]) * inv_h};
+                                                const double r2 = d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+                                                if (r2 > reach2) continue;
+                                                fgt_monomials(d, p, m.data());
+                                                const double* C = coeff.data() + k * terms * 3;
+                                                double sx = 0.0, sy = 0.0, sz = 0.0;
+                                                for (std::size_t t = 0; t < terms; ++t) {
+                                                        sx += C[3 * t] * m[t];
+                                                        sy += C[3 * t + 1] * m[t];
+                                                        sz += C[3 * t + 2] * m[t];
+                                                }
+                                                const double w = std::exp(-r2);
+                                                gx += w * sx;
+                                                gy += w * sy;
+                                                gz += w * sz;
+                                        }
+                                        g[i] = {gx - W[i][0], gy - W[i][1], gz - W[i][2]};
+                                }
+                        };
+                        if (n < kSerialTargets) {
+                                rows(0, n);
+                        } else {
+                                parallel_for(0, n, kTargetGrain, rows);
+                        }
+                }
+
+                struct GaussSumChoice {
+                        GaussSumMethod method = GaussSumMethod::Direct;
+                        SparseCellGrid cells;
+                        FgtPlan fgt;
+                };
+
+                double cutoff_radius(double epsilon, double tol) {
+                        return epsilon * std::sqrt(2.0 * std::log(1.0 / tol));
+                }
+
+                // Prepares the requested method (building its cell list or cluster
+                // grid) or, for Auto, the cheapest by estimated work.
+                void choose_gauss_sum(const std::vector<Vec3>& X, double epsilon, double tol,
+                                      GaussSumMethod requested, GaussSumChoice& choice) {
+                        const std::size_t n = X.size();
+                        choice.method = GaussSumMethod::Direct;
+                        if (requested == GaussSumMethod::Direct || n < 2) {
+                                return;
+                        }
+                        const double nd = static_cast<double>(n);
+                        double best = nd * (nd - 1.0);
+
+                        if (requested == GaussSumMethod::Auto || requested == GaussSumMethod::Cutoff) {
+                                if (choice.cells.build(X, cutoff_radius(epsilon, tol))) {
+                                        const double cost = static_cast<double>(choice.cells.candidate_pairs) * kCutoffPairCost;
+                                        if (requested == GaussSumMethod::Cutoff || cost < best) {
+                                                best = cost;
+                                                choice.method = GaussSumMethod::Cutoff;
+                                        }
+                                }
+                        }
+                        if (requested == GaussSumMethod::Auto || requested == GaussSumMethod::FastGauss) {
+                                double lo[3], hi[3];
+                                for (int d = 0; d < 3; ++d) {
+                                        lo[d] = std::numeric_limits<double>::infinity();
+                                        hi[d] = -std::numeric_limits<double>::infinity();
+                                }
+                                for (const Vec3& x : X) {
+                                        for (int d = 0; d < 3; ++d) {
+                                                lo[d] = std::min(lo[d], x[d]);
+                                                hi[d] = std::max(hi[d], x[d]);
+                                        }
+                                }
+                                const double h = std::sqrt(2.0) * epsilon;
+                                for (double side : kFgtCellSides) {
+                                        FgtPlan plan = plan_fgt(X, h, tol, side, lo, hi);
+                                        if (!plan.feasible) continue;
+                                        if ((requested == GaussSumMethod::FastGauss && choice.method != GaussSumMethod::FastGauss)
+                                            || plan.cost < best) {
+                                                best = plan.cost;
+                                                choice.method = GaussSumMethod::FastGauss;
+                                                choice.fgt = std::move(plan);
+                                        }
+                                }
+                                if (requested == GaussSumMethod::FastGauss && choice.method != GaussSumMethod::FastGauss) {
+                                        throw std::invalid_argument(
+                                                "compute_gravitational_potential_gradient: epsilon is too small relative to the "
+                                                "point cloud for the fast Gauss transform; use method 'cutoff' or 'auto'");
+                                }
+                        }
+                }
+
+                void check_gauss_sum_args(const std::vector<Vec3>& positions, const std::vector<Vec3>& vorticity,
+                                          double epsilon, double tolerance) {
+                        if (positions.size() != vorticity.size()) {
+                                throw std::invalid_argument(
+                                        "compute_gravitational_potential_gradient: positions and vorticity must have the same length");
+                        }
+                        if (!(epsilon > 0.0) || !std::isfinite(epsilon)) {
+                                throw std::invalid_argument("compute_gravitational_potential_gradient: epsilon must be positive");
+                        }
+                        if (!(tolerance > 0.0 && tolerance < 1.0)) {
+                                throw std::invalid_argument("compute_gravitational_potential_gradient: tolerance must be in (0, 1)");
+                        }
+                }
+
+                // ---- Softened dipole sum S(x) = sum_j (x - y_j).w_j / (|x - y_j|^2 + eps^2)^{3/2} ----
+
+                constexpr std::size_t kDipoleLeafSize = 32;
+                constexpr std::size_t kDipoleBatchSize = 64;  // targets sharing one tree walk
+                constexpr std::size_t kDipoleMaxDepth = 48;
+                constexpr int kDipoleMaxOrder = 16;
+                // Below this many target-source pairs, building trees costs more than it saves.
+                constexpr double kDipoleTreeMinPairs = 4e9;
+                // One Taylor coefficient (recurrence + moment FMA) in units of one direct pair;
+                // a cluster is only expanded when that beats its direct sum.
+                constexpr double kDipoleTermCost = 0.6;
+
+                // Multi-indices g with |g| <= P in graded order, plus the index of
+                // g - e_k and g - 2 e_k for the Taylor recurrence (or `zero`, a slot
+                // that always holds 0, when that component is missing).
+                struct DipoleIndex {
+                        std::size_t count = 0;           // all g with |g| <= P
+                        std::size_t lower_count = 0;     // all g with |g| <= P - 1
+                        std::size_t zero = 0;
+                        std::vector<std::array<int, 3>> exps;
+                        std::vector<std::array<std::size_t, 3>> minus1, minus2;
+                        std::vector<double> c1, c2;      // -(2n-1)/n, -(n-1)/n for n = |g|
+                        std::vector<std::size_t> mono_from;
+                        std::vector<int> mono_axis;
+
+                        explicit DipoleIndex(int P) {
+                                std::vector<std::size_t> at((P + 1) * (P + 1) * (P + 1), 0);
+                                auto slot = [&](int a, int b, int c) { return (a * (P + 1) + b) * (P + 1) + c; };
+                                for (int n = 0; n <= P; ++n) {
+                                        if (n == P) lower_count = exps.size();
+                                        for (int a = n; a >= 0; --a) {
+                                                for (int b = n - a; b >= 0; --b) {
+                                                        at[slot(a, b, n - a - b)] = exps.size();
+                                                        exps.push_back({a, b, n - a - b});
+                                                }
+                                        }
+                                }
+                                if (P == 0) lower_count = 0;
+                                count = exps.size();
+                                zero = count;
+                                minus1.resize(count);
+                                minus2.resize(count);
+                                c1.assign(count, 0.0);
+                                c2.assign(count, 0.0);
+                                mono_from.assign(count, 0);
+                                mono_axis.assign(count, 0);
+                                for (std::size_t i = 0; i < count; ++i) {
+                                        const auto& e = exps[i];
+                                        const int n = e[0] + e[1] + e[2];
+                                        for (int k = 0; k < 3; ++k) {
+                                                auto down = e;
+                                                down[k] -= 1;
+                                                minus1[i][k] = down[k] >= 0 ? at[slot(down[0], down[1], down[2])] : zero;
+                                                down[k] -= 1;
+                                                minus2[i][k] = down[k] >= 0 ? at[slot(down[0], down[1], down[2])] : zero;
+                                        }
+                                        if (n > 0) {
+                                                c1[i] = -(2.0 * n - 1.0) / n;
+                                                c2[i] = -(n - 1.0) / n;
+                                                const int k = e[0] > 0 ? 0 : (e[1] > 0 ? 1 : 2);
+                                                mono_axis[i] = k;
+                                                mono_from[i] = minus1[i][k];
+                                        }
+                                }
+                        }
+                };
+
+                // Octree over a point set, split at the midpoint of each node's tight
+                // bounding box. Points are permuted into tree order so every node is a
+                // contiguous range of the SoA copies; children of a node are adjacent.
+                struct DipoleTree {
+                        struct Node {
+                                double cx, cy, cz, radius;   // centre of the bounding box, max distance to it
+                                std::size_t begin, end;
+                                std::size_t first_child = 0, children = 0;
+                        };
+                        std::vector<Node> nodes;
+                        std::vector<std::size_t> order;
+                        std::vector<double> xs, ys, zs;
+                        std::vector<std::size_t> batches;   // largest nodes of <= kDipoleBatchSize points
+
+                        explicit DipoleTree(const std::vector<Vec3>& X) {
+                                const std::size_t n = X.size();
+                                order.resize(n);
+                                for (std::size_t i = 0; i < n; ++i) order[i] = i;
+                                std::vector<std::size_t> scratch(n);
+                                nodes.push_back(Node{0, 0, 0, 0, 0, n});
+                                split(X, 0, 0, false, scratch);
+                                xs.resize(n); ys.resize(n); zs.resize(n);
+                                for (std::size_t k = 0; k < n; ++k) {
+                                        xs[k] = X[order[k]][0]; ys[k] = X[order[k]][1]; zs[k] = X[order[k]][2];
+                                }
+                        }
+
+                private:
+                        void split(const std::vector<Vec3>& X, std::size_t id, std::size_t depth, bool in_batch,
+                                   std::vector<std::size_t>& scratch) {
+                                const std::size_t b = nodes[id].begin, e = nodes[id].end;
+                                if (!in_batch && (e - b <= kDipoleBatchSize || depth >= kDipoleMaxDepth)) {
+                                        batches.push_back(id);
+                                        in_batch = true;
+                                }
+                                double lo[3] = {X[order[b]][0], X[order[b]][1], X[order[b]][2]};
+                                double hi[3] = {lo[0], lo[1], lo[2]};
+                                for (std::size_t k = b + 1; k < e; ++k) {
+                                        for (int d = 0; d < 3; ++d) {
+                                                lo[d] = std::min(lo[d], X[order[k]][d]);
+                                                hi[d] = std::max(hi[d], X[order[k]][d]);
+                                        }
+                                }
+                                const double c[3] = {0.5 * (lo[0] + hi[0]), 0.5 * (lo[1] + hi[1]), 0.5 * (lo[2] + hi[2])};
+                                double r2 = 0.0;
+                                for (std::size_t k = b; k < e; ++k) {
+                                        const Vec3& x = X[order[k]];
+                                        r2 = std::max(r2, (x[0] - c[0]) * (x[0] - c[0]) + (x[1] - c[1]) * (x[1] - c[1])
+                                                                  + (x[2] - c[2]) * (x[2] - c[2]));
+                                }
+                                Node& node = nodes[id];
+                                node.cx = c[0]; node.cy = c[1]; node.cz = c[2];
+                                node.radius = std::sqrt(r2);
+                                if (e - b <= kDipoleLeafSize || depth >= kDipoleMaxDepth || !(r2 > 0.0)) {
+                                        if (!in_batch) batches.push_back(id);  // many copies of one point
+                                        return;
+                                }
+
+                                // Counting sort of the range by octant.
+                                std::size_t counts[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+                                auto octant = [&](std::size_t i) {
+                                        return (X[i][0] > c[0] ? 1 : 0) | (X[i][1] > c[1] ? 2 : 0) | (X[i][2] > c[2] ? 4 : 0);
+                                };
+                                for (std::size_t k = b; k < e; ++k) ++counts[octant(order[k])];
+                                std::size_t offsets[9] = {b};
+                                for (int o = 0; o < 8; ++o) offsets[o + 1] = offsets[o] + counts[o];
+                                std::size_t fill[8];
+                                std::copy(offsets, offsets + 8, fill);
+                                for (std::size_t k = b; k < e; ++k) scratch[fill[octant(order[k])]++] = order[k];
+                                std::copy(scratch.begin() + b, scratch.begin() + e, order.begin() + b);
+
+                                const std::size_t first = nodes.size();
+                                for (int o = 0; o < 8; ++o) {
+                                        if (counts[o] > 0) nodes.push_back(Node{0, 0, 0, 0, offsets[o], offsets[o + 1]});
+                                }
+                                nodes[id].first_child = first;
+                                nodes[id].children = nodes.size() - first;
+                                for (std::size_t ch = first, last = nodes.size(); ch < last; ++ch) {
+                                        split(X, ch, depth + 1, in_batch, scratch);
+                                }
+                        }
+                };
+
+                // One step of the Taylor recurrence below for m targets:
+                // b_g = (c1 d.b_{g-e} + c2 sum b_{g-2e}) / rho, and acc += N_g b_g. Kept
+                // out of line so the restrict-qualified outputs let it vectorize.
+                void taylor_row(std::size_t m, double c1, double c2, double Ng,
+                                const double* dx, const double* dy, const double* dz, const double* inv_rho,
+                                const double* const rows[6], double* __restrict bg, double* __restrict acc) {
+                        const double* b1x = rows[0];
+                        const double* b1y = rows[1];
+                        const double* b1z = rows[2];
+                        const double* b2x = rows[3];
+                        const double* b2y = rows[4];
+                        const double* b2z = rows[5];
+                        for (std::size_t t = 0; t < m; ++t) {
+                                const double v = (c1 * (dx[t] * b1x[t] + dy[t] * b1y[t] + dz[t] * b1z[t])
+                                                  + c2 * (b2x[t] + b2y[t] + b2z[t])) * inv_rho[t];
+                                bg[t] = v;
+                                acc[t] += Ng * v;
+                        }
+                }
+
+                // Treecode for S at every target (Barnes-Hut with Taylor expansions,
+                // batched over small target subtrees as in Lindsay & Krasny 2001). With
+                // G(d) = (|d|^2 + eps^2)^{-1/2} the dipole term is w.grad_y G(x - y), so
+                // a cluster about c contributes sum_g N_g b_g(x - c), where b_g = d^g G/g!
+                // obeys the recurrence
+                //   n rho b_g + (2n-1) sum_k d_k b_{g-e_k} + (n-1) sum_k b_{g-2e_k} = 0,
+                // rho = |d|^2 + eps^2, n = |g|, and the moments are
+                //   N_g = (-1)^|g| sum_j sum_k g_k w_jk (y_j - c)^{g-e_k}.
+                // A cluster of radius r is expanded for a batch of radius r_b when
+                // r / theta + r_b < |c - c_b| and it holds enough points for the
+                // expansion to beat its direct sum; each such term then errs by
+                // O(theta^(order+1)).
+                void dipole_sum_tree(const std::vector<Vec3>& targets, const std::vector<Vec3>& Y,
+                                     const std::vector<Vec3>& W, double eps2, const DipoleSumOptions& opt,
+                                     std::vector<double>& S) {
+                        const DipoleTree src(Y);
+                        const bool same = &targets == &Y;
+                        std::optional<DipoleTree> own_tgt;
+                        if (!same) own_tgt.emplace(targets);
+                        const DipoleTree& tgt = same ? src : *own_tgt;
+
+                        const std::size_t ns = Y.size();
+                        std::vector<double> wx(ns), wy(ns), wz(ns);
+                        for (std::size_t k = 0; k < ns; ++k) {
+                                wx[k] = W[src.order[k]][0]; wy[k] = W[src.order[k]][1]; wz[k] = W[src.order[k]][2];
+                        }
+
+                        const int P = opt.order + 1;
+                        const DipoleIndex idx(P);
+                        const std::size_t T = idx.count;
+                        const double expand_min = kDipoleTermCost * static_cast<double>(T);
+                        std::vector<char> expandable(src.nodes.size(), 0);
+                        for (std::size_t id = 0; id < src.nodes.size(); ++id) {
+                                const auto& node = src.nodes[id];
+                                expandable[id] = static_cast<double>(node.end - node.begin) > expand_min;
+                        }
+
+                        // Moments of every expandable node, straight from its points.
+                        std::vector<double> moments(src.nodes.size() * T, 0.0);
+                        auto node_moments = [&](std::size_t lo, std::size_t hi) {
+                                const std::size_t L = idx.lower_count;
+                                std::vector<double> mono(std::max<std::size_t>(L, 1));
+                                std::vector<double> A(3 * L);
+                                for (std::size_t id = lo; id < hi; ++id) {
+                                        if (!expandable[id]) continue;
+                                        const auto& node = src.nodes[id];
+                                        std::fill(A.begin(), A.end(), 0.0);
+                                        for (std::size_t k = node.begin; k < node.end; ++k) {
+                                                const double s[3] = {src.xs[k] - node.cx, src.ys[k] - node.cy, src.zs[k] - node.cz};
+                                                mono[0] = 1.0;
+                                                for (std::size_t a = 1; a < L; ++a) {
+                                                        mono[a] = mono[idx.mono_from[a]] * s[idx.mono_axis[a]];
+                                                }
+                                                for (std::size_t a = 0; a < L; ++a) {
+                                                        A[3 * a] += wx[k] * mono[a];
+                                                        A[3 * a + 1] += wy[k] * mono[a];
+                                                        A[3 * a + 2] += wz[k] * mono[a];
+                                                }
+                                        }
+                                        double* N = &moments[id * T];
+                                        for (std::size_t g = 1; g < T; ++g) {
+                                                const auto& e = idx.exps[g];
+                                                double sum = 0.0;
+                                                for (int k = 0; k < 3; ++k) {
+                                                        if (e[k] > 0) sum += e[k] * A[3 * idx.minus1[g][k] + k];
+                                                }
+                                                N[g] = ((e[0] + e[1] + e[2]) % 2 == 0) ? sum : -sum;
+                                        }
+                                }
+                        };
+                        parallel_for(0, src.nodes.size(), 8, node_moments);
+
+                        const double theta = opt.theta;
+                        auto batches = [&](std::size_t lo, std::size_t hi) {
+                                // Recurrence rows b_g for the whole batch at once, so the inner
+                                // loop runs over targets and vectorizes; row T stays 0 (idx.zero).
+                                std::vector<double> B((T + 1) * kDipoleBatchSize, 0.0);
+                                std::vector<double> dx(kDipoleBatchSize), dy(kDipoleBatchSize), dz(kDipoleBatchSize);
+                                std::vector<double> inv_rho(kDipoleBatchSize);
+                                std::vector<double> acc;
+                                std::vector<std::size_t> stack;
+                                for (std::size_t q = lo; q < hi; ++q) {
+                                        const auto& batch = tgt.nodes[tgt.batches[q]];
+                                        const std::size_t tb = batch.begin, te = batch.end;
+                                        acc.assign(te - tb, 0.0);
+                                        stack.assign(1, 0);
+                                        while (!stack.empty()) {
+                                                const std::size_t id = stack.back();
+                                                stack.pop_back();
+                                                const auto& node = src.nodes[id];
+                                                const double ox = batch.cx - node.cx, oy = batch.cy - node.cy, oz = batch.cz - node.cz;
+                                                // Every target lies within r_b of the batch centre, so
+                                                // r < theta (d - r_b) bounds r / |x - c| by theta for all of them.
+                                                const double reach = node.radius / theta + batch.radius;
+                                                if (expandable[id] && reach * reach < ox * ox + oy * oy + oz * oz) {
+                                                        const double* N = &moments[id * T];
+                                                        // A batch capped by depth may be larger; take it in slices.
+                                                        for (std::size_t t0 = tb; t0 < te; t0 += kDipoleBatchSize) {
+                                                                const std::size_t m = std::min(kDipoleBatchSize, te - t0);
+                                                                for (std::size_t t = 0; t < m; ++t) {
+                                                                        dx[t] = tgt.xs[t0 + t] - node.cx;
+                                                                        dy[t] = tgt.ys[t0 + t] - node.cy;
+                                                                        dz[t] = tgt.zs[t0 + t] - node.cz;
+                                                                        inv_rho[t] = 1.0 / (dx[t] * dx[t] + dy[t] * dy[t] + dz[t] * dz[t] + eps2);
+                                                                        B[t] = std::sqrt(inv_rho[t]);
+                                                                }
+                                                                for (std::size_t g = 1; g < T; ++g) {
+                                                                        const auto& m1 = idx.minus1[g];
+                                                                        const auto& m2 = idx.minus2[g];
+                                                                        const double* rows[6] = {
+                                                                                &B[m1[0] * kDipoleBatchSize], &B[m1[1] * kDipoleBatchSize], &B[m1[2] * kDipoleBatchSize],
+                                                                                &B[m2[0] * kDipoleBatchSize], &B[m2[1] * kDipoleBatchSize], &B[m2[2] * kDipoleBatchSize]};
+                                                                        taylor_row(m, idx.c1[g], idx.c2[g], N[g], dx.data(), dy.data(), dz.data(),
+                                                                                   inv_rho.data(), rows, &B[g * kDipoleBatchSize], &acc[t0 - tb]);
+                                                                }
+                                                        }
+                                                } else if (node.children == 0 || !expandable[id]) {
+                                                        // Too close to expand and nothing smaller is worth
+                                                        // expanding either: sum the whole range directly.
+                                                        for (std::size_t t = tb; t < te; ++t) {
+                                                                const double px = tgt.xs[t], py = tgt.ys[t], pz = tgt.zs[t];
+                                                                double s = 0.0;
+                                                                for (std::size_t k = node.begin; k < node.end; ++k) {
+                                                                        const double rx = px - src.xs[k], ry = py - src.ys[k], rz = pz - src.zs[k];
+                                                                        const double r2 = rx * rx + ry * ry + rz * rz + eps2;
+                                                                        const double r3 = r2 > 0.0 ? r2 * std::sqrt(r2) : 1.0;  // coincident, eps = 0
+                                                                        s += (rx * wx[k] + ry * wy[k] + rz * wz[k]) / r3;
+                                                                }
+                                                                acc[t - tb] += s;
+                                                        }
+                                                } else {
+                                                        for (std::size_t ch = 0; ch < node.children; ++ch) {
+                                                                stack.push_back(node.first_child + ch);
+                                                        }
+                                                }
+                                        }
+                                        for (std::size_t t = tb; t < te; ++t) {
+                                                S[tgt.order[t]] = acc[t - tb];
+                                        }
+                                }
+                        };
+                        parallel_for(0, tgt.batches.size(), 1, batches);
+                }
+
+                // Every target against every source; exact up to rounding. A source at
+                // the target itself contributes 0 (x - y = 0), as the i != j skip did;
+                // with eps = 0 that pair is 0/0, so its denominator is replaced by 1.
+                void dipole_sum_direct(const std::vector<Vec3>& targets, const std::vector<Vec3>& Y,
+                                       const std::vector<Vec3>& W, double eps2, std::vector<double>& S) {
+                        const std::size_t ns = Y.size();
+                        std::vector<double> xs(ns), ys(ns), zs(ns), wx(ns), wy(ns), wz(ns);
+                        for (std::size_t k = 0; k < ns; ++k) {
+                                xs[k] = Y[k][0]; ys[k] = Y[k][1]; zs[k] = Y[k][2];
+                                wx[k] = W[k][0]; wy[k] = W[k][1]; wz[k] = W[k][2];
+                        }
+                        auto rows = [&](std::size_t lo, std::size_t hi) {
+                                for (std::size_t i = lo; i < hi; ++i) {
+                                        const double px = targets[i][0], py = targets[i][1], pz = targets[i][2];
+                                        double s = 0.0;
+                                        for (std::size_t k = 0; k < ns; ++k) {
+                                                const double rx = px - xs[k], ry = py - ys[k], rz = pz - zs[k];
+                                                const double r2 = rx * rx + ry * ry + rz * rz + eps2;
+                                                const double r3 = r2 > 0.0 ? r2 * std::sqrt(r2) : 1.0;  // coincident, eps = 0
+                                                s += (rx * wx[k] + ry * wy[k] + rz * wz[k]) / r3;
+                                        }
+                                        S[i] = s;
+                                }
+                        };
+                        if (targets.size() < kSerialTargets) {
+                                rows(0, targets.size());
+                        } else {
+                                parallel_for(0, targets.size(), kTargetGrain, rows);
+                        }
+                }
+
+                std::vector<double> dipole_potential(const std::vector<Vec3>& targets, const std::vector<Vec3>& positions,
+                                                     const std::vector<Vec3>& vorticity, double epsilon,
+                                                     const DipoleSumOptions& options) {
+                        if (positions.size() != vorticity.size()) {
+                                throw std::invalid_argument(
+                                        "compute_gravitational_potential_direct: positions and vorticity must have the same length");
+                        }
+                        if (!std::isfinite(epsilon)) {
+                                throw std::invalid_argument("compute_gravitational_potential_direct: epsilon must be finite");
+                        }
+                        if (!(options.theta > 0.0 && options.theta < 1.0)) {
+                                throw std::invalid_argument("compute_gravitational_potential_direct: theta must be in (0, 1)");
+                        }
+                        if (options.order < 0 || options.order > kDipoleMaxOrder) {
+                                throw std::invalid_argument("compute_gravitational_potential_direct: order must be in [0, "
+                                                            + std::to_string(kDipoleMaxOrder) + "]");
+                        }
+                        std::vector<double> S(targets.size(), 0.0);
+                        if (targets.empty() || positions.empty()) {
+                                return S;
+                        }
+                        const double pairs = static_cast<double>(targets.size()) * static_cast<double>(positions.size());
+                        const double eps2 = epsilon * epsilon;
+                        if (options.method == DipoleSumMethod::Tree
+                            || (options.method == DipoleSumMethod::Auto && pairs >= kDipoleTreeMinPairs)) {
+                                dipole_sum_tree(targets, positions, vorticity, eps2, options, S);
+                        } else {
+                                dipole_sum_direct(targets, positions, vorticity, eps2, S);
+                        }
+                        constexpr double inv_prefactor = 1.0 / (4.0 * M_PI);
+                        for (double& s : S) s *= -inv_prefactor;
+                        return S;
+                }
+
+        } // namespace
+
+        GaussSumMethod parse_gauss_sum_method(const std::string& name) {
+                std::string s = name;
+                std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+                if (s == "auto") return GaussSumMethod::Auto;
+                if (s == "direct") return GaussSumMethod::Direct;
+                if (s == "cutoff" || s == "grid") return GaussSumMethod::Cutoff;
+                if (s == "fgt" || s == "ifgt" || s == "fast_gauss") return GaussSumMethod::FastGauss;
+                throw std::invalid_argument("Unknown Gauss sum method '" + name + "' (expected auto, direct, cutoff or fgt)");
+        }
+
+        const char* gauss_sum_method_name(GaussSumMethod method) {
+                switch (method) {
+                        case GaussSumMethod::Auto: return "auto";
+                        case GaussSumMethod::Direct: return "direct";
+                        case GaussSumMethod::Cutoff: return "cutoff";
+                        case GaussSumMethod::FastGauss: return "fgt";
+                }
+                return "unknown";
+        }
+
+        DipoleSumMethod parse_dipole_sum_method(const std::string& name) {
+                std::string s = name;
+                std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+                if (s == "auto") return DipoleSumMethod::Auto;
+                if (s == "direct") return DipoleSumMethod::Direct;
+                if (s == "tree" || s == "treecode" || s == "barnes_hut") return DipoleSumMethod::Tree;
+                throw std::invalid_argument("Unknown dipole sum method '" + name + "' (expected auto, direct or tree)");
+        }
+
+        const char* dipole_sum_method_name(DipoleSumMethod method) {
+                switch (method) {
+                        case DipoleSumMethod::Auto: return "auto";
+                        case DipoleSumMethod::Direct: return "direct";
+                        case DipoleSumMethod::Tree: return "tree";
+                }
+                return "unknown";
+        }
+
         std::vector<double> TimeField::compute_gravitational_potential_gradient(
                         const std::vector<Vec3>& positions,
                         const std::vector<Vec3>& vorticity,
                         double epsilon) {
-                size_t n = positions.size();
+                return compute_gravitational_potential_gradient(positions, vorticity, epsilon, GaussSumOptions{});
+        }
+
+        std::vector<double> TimeField::compute_gravitational_potential_gradient(
+                        const std::vector<Vec3>& positions,
+                        const std::vector<Vec3>& vorticity,
+                        double epsilon,
+                        const GaussSumOptions& options) {
+                check_gauss_sum_args(positions, vorticity, epsilon, options.tolerance);
+                const size_t n = positions.size();
                 std::vector<double> potential(n, 0.0);
+                if (n == 0) {
+                        return potential;
+                }
 
-                for (size_t i = 0; i < n; ++i) {
-                        Vec3 grad_w = {0.0, 0.0, 0.0};
-                        for (size_t j = 0; j < n; ++j) {
-                                if (i == j) continue;
-                                Vec3 dr = {positions[i][0] - positions[j][0],
-                                                   positions[i][1] - positions[j][1],
-                                                   positions[i][2] - positions[j][2]};
-                                double r2 = dr[0]*dr[0] + dr[1]*dr[1] + dr[2]*dr[2];
-                                double w = std::exp(-r2 / (2 * epsilon * epsilon));
-                                grad_w[0] += w * vorticity[j][0];
-                                grad_w[1] += w * vorticity[j][1];
-                                grad_w[2] += w * vorticity[j][2];
-                        }
-                        double mag2 = grad_w[0]*grad_w[0] + grad_w[1]*grad_w[1] + grad_w[2]*grad_w[2];
-                        potential[i] = -0.5 * mag2;
+                GaussSumChoice choice;
+                choose_gauss_sum(positions, epsilon, options.tolerance, options.method, choice);
+                std::vector<Vec3> grad_w(n);
+                const double h2 = 2.0 * epsilon * epsilon;
+                switch (choice.method) {
+                        case GaussSumMethod::Cutoff:
+                                gauss_sum_cutoff(positions, vorticity, h2, choice.cells, grad_w);
+                                break;
+                        case GaussSumMethod::FastGauss:
+                                gauss_sum_fgt(positions, vorticity, choice.fgt, grad_w);
+                                break;
+                        default:
+                                gauss_sum_direct(positions, vorticity, h2, grad_w);
+                                break;
                 }
 
+                for (size_t i = 0; i < n; ++i) {
+                        const Vec3& g = grad_w[i];
+                        potential[i] = -0.5 * (g[0]*g[0] + g[1]*g[1] + g[2]*g[2]);
+                }
                 return potential;
         }
 
+        GaussSumMethod TimeField::select_gauss_sum_method(
+                        const std::vector<Vec3>& positions,
+                        double epsilon,
+                        double tolerance) {
+                check_gauss_sum_args(positions, positions, epsilon, tolerance);
+                GaussSumChoice choice;
+                choose_gauss_sum(positions, epsilon, tolerance, GaussSumMethod::Auto, choice);
+                return choice.method;
+        }
+
         std::vector<double> TimeField::compute_time_dilation_map_sqrt(const std::vector<Vec3>& tangents,
                         double C_e) {
                 size_t n = tangents.size();
@@ -54,28 +1016,22 @@ namespace sst {
         std::vector<double> TimeField::compute_gravitational_potential_direct(const std::vector<Vec3>& positions,
                                                                                const std::vector<Vec3>& vorticity,
                                                                                double epsilon) {
-                size_t n = positions.size();
-                std::vector<double> potential(n, 0.0);
-                constexpr double inv_prefactor = 1.0 / (4.0 * M_PI);
-
-                for (size_t i = 0; i < n; ++i) {
-                        double phi = 0.0;
-                        const auto& ri = positions[i];
-
-                        for (size_t j = 0; j < n; ++j) {
-                                if (i == j) continue;
-                                const auto& rj = positions[j];
-                                const auto& wj = vorticity[j];
+                return dipole_potential(positions, positions, vorticity, epsilon, DipoleSumOptions{});
+        }
 
-                                Vec3 dr = { ri[0] - rj[0], ri[1] - rj[1], ri[2] - rj[2] };
-                                double r2 = dr[0]*dr[0] + dr[1]*dr[1] + dr[2]*dr[2] + epsilon * epsilon;
-                                double dot = dr[0]*wj[0] + dr[1]*wj[1] + dr[2]*wj[2];
+        std::vector<double> TimeField::compute_gravitational_potential_direct(const std::vector<Vec3>& positions,
+                                                                               const std::vector<Vec3>& vorticity,
+                                                                               double epsilon,
+                                                                               const DipoleSumOptions& options) {
+                return dipole_potential(positions, positions, vorticity, epsilon, options);
+        }
 
-                                phi += dot / std::pow(r2, 1.5);
-                        }
-                        potential[i] = -inv_prefactor * phi;
-                }
-                return potential;
+        std::vector<double> TimeField::compute_gravitational_potential_direct_at(const std::vector<Vec3>& targets,
+                                                                                  const std::vector<Vec3>& positions,
+                                                                                  const std::vector<Vec3>& vorticity,
+                                                                                  double epsilon,
+                                                                                  const DipoleSumOptions& options) {
+                return dipole_potential(targets, positions, vorticity, epsilon, options);
         }
 
         // Linear method from GravityTimeField
@@ -1,17 +1,46 @@
 // src/potential_timefield_py.cpp
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <string>
 #include "potential_timefield.h"
 
 namespace py = pybind11;
 
 void bind_timefield(py::module_& m) {
-        m.def("compute_gravitational_potential_gradient", &sst::TimeField::compute_gravitational_potential_gradient,
+        m.def("compute_gravitational_potential_gradient",
+		  [](const std::vector<sst::Vec3>& positions, const std::vector<sst::Vec3>& vorticity,
+		     double epsilon, const std::string& method, double tolerance) {
+			  sst::GaussSumOptions options;
+			  options.method = sst::parse_gauss_sum_method(method);
+			  options.tolerance = tolerance;
+			  return sst::TimeField::compute_gravitational_potential_gradient(positions, vorticity, epsilon, options);
+		  },
 		  py::arg("positions"),
 		  py::arg("vorticity"),
 		  py::arg("epsilon") = 7e-7,
+		  py::arg("method") = "auto",
+		  py::arg("tolerance") = 1e-10,
+		  py::call_guard<py::gil_scoped_release>(),
 		  R"pbdoc(
             Compute Ætheric gravitational potential field from vorticity gradients.
+
+            method: "direct" (all pairs), "cutoff" (only pairs within
+            epsilon * sqrt(2 ln(1/tolerance)), via a sparse cell grid), "fgt" (improved
+            fast Gauss transform, for epsilon comparable to the point cloud) or "auto"
+            (cheapest by estimated work; see select_gauss_sum_method).
+            tolerance bounds the dropped or truncated kernel weight per source.
+        )pbdoc");
+
+        m.def("select_gauss_sum_method",
+		  [](const std::vector<sst::Vec3>& positions, double epsilon, double tolerance) {
+			  return std::string(sst::gauss_sum_method_name(
+				  sst::TimeField::select_gauss_sum_method(positions, epsilon, tolerance)));
+		  },
+		  py::arg("positions"),
+		  py::arg("epsilon") = 7e-7,
+		  py::arg("tolerance") = 1e-10,
+		  R"pbdoc(
+            Method that compute_gravitational_potential_gradient(method="auto") uses for these points.
         )pbdoc");
 
         m.def("compute_time_dilation_map_sqrt", &sst::TimeField::compute_time_dilation_map_sqrt,
@@ -21,12 +50,54 @@ void bind_timefield(py::module_& m) {
             Compute time dilation factors from knot tangential velocities (sqrt method).
         )pbdoc");
 
-        m.def("compute_gravitational_potential_direct", &sst::TimeField::compute_gravitational_potential_direct,
+        m.def("compute_gravitational_potential_direct",
+		  [](const std::vector<sst::Vec3>& positions, const std::vector<sst::Vec3>& vorticity,
+		     double epsilon, const std::string& method, double theta, int order) {
+			  sst::DipoleSumOptions options;
+			  options.method = sst::parse_dipole_sum_method(method);
+			  options.theta = theta;
+			  options.order = order;
+			  return sst::TimeField::compute_gravitational_potential_direct(positions, vorticity, epsilon, options);
+		  },
 		  py::arg("positions"),
 		  py::arg("vorticity"),
 		  py::arg("epsilon") = 0.1,
+		  py::arg("method") = "auto",
+		  py::arg("theta") = 0.4,
+		  py::arg("order") = 10,
+		  py::call_guard<py::gil_scoped_release>(),
 		  R"pbdoc(
             Compute Æther gravitational potential field from vorticity.
+
+            method: "direct" (all pairs, threaded), "tree" (Barnes-Hut treecode with
+            order-`order` Taylor expansions, opening angle `theta`) or "auto" (tree
+            only for very large inputs). Smaller theta / higher order is more accurate;
+            the defaults give ~1e-6 of max |phi|.
+        )pbdoc");
+
+        m.def("compute_gravitational_potential_direct_at",
+		  [](const std::vector<sst::Vec3>& targets, const std::vector<sst::Vec3>& positions,
+		     const std::vector<sst::Vec3>& vorticity, double epsilon, const std::string& method,
+		     double theta, int order) {
+			  sst::DipoleSumOptions options;
+			  options.method = sst::parse_dipole_sum_method(method);
+			  options.theta = theta;
+			  options.order = order;
+			  return sst::TimeField::compute_gravitational_potential_direct_at(targets, positions, vorticity,
+											   epsilon, options);
+		  },
+		  py::arg("targets"),
+		  py::arg("positions"),
+		  py::arg("vorticity"),
+		  py::arg("epsilon") = 0.1,
+		  py::arg("method") = "auto",
+		  py::arg("theta") = 0.4,
+		  py::arg("order") = 10,
+		  py::call_guard<py::gil_scoped_release>(),
+		  R"pbdoc(
+            Potential of the (positions, vorticity) sources at arbitrary target points,
+            e.g. a grid around the filaments. Same kernel and options as
+            compute_gravitational_potential_direct.
         )pbdoc");
 
         m.def("compute_time_dilation_map_linear", &sst::TimeField::compute_time_dilation_map_linear,
@@ -40,6 +111,7 @@ void bind_timefield(py::module_& m) {
 		  py::arg("positions"),
 		  py::arg("vorticity"),
 		  py::arg("epsilon") = 7e-7,
+		  py::call_guard<py::gil_scoped_release>(),
 		  R"pbdoc(
             Compute Ætheric gravitational potential field (backward compatibility).
         )pbdoc");
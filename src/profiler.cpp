@@ -0,0 +1,163 @@
+#include "profiler.h"
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace sst::profiler {
+
+    namespace detail {
+        std::atomic<bool> g_enabled{false};
+    }
+
+    namespace {
+        struct TraceEvent {
+            const char* stage;
+            std::int64_t ts_ns;   // since origin
+            std::int64_t dur_ns;
+            std::uint32_t tid;
+        };
+
+        // Scopes close at stage granularity (not per pair), so one mutex is
+        // cheap enough and keeps snapshot()/reset() simple.
+        struct State {
+            std::mutex m;
+            std::unordered_map<const char*, StageStats> stages;  // keyed by literal address
+            std::vector<TraceEvent> events;
+            bool trace = false;
+            std::size_t max_events = 0;
+            std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+        };
+
+        State& state() {
+            static State s;
+            return s;
+        }
+
+        std::uint32_t thread_index() {
+            static std::atomic<std::uint32_t> next{1};
+            thread_local const std::uint32_t index = next.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+
+        std::string json_escape(const char* s) {
+            std::string out;
+            for (; *s; ++s) {
+                if (*s == '"' || *s == '\\') out += '\\';
+                out += *s;
+            }
+            return out;
+        }
+    }
+
+    bool is_enabled() {
+        return enabled();
+    }
+
+    void enable(bool trace, std::size_t max_trace_events) {
+        State& s = state();
+        {
+            std::lock_guard<std::mutex> lk(s.m);
+            s.trace = trace;
+            s.max_events = max_trace_events;
+        }
+        detail::g_enabled.store(true, std::memory_order_relaxed);
+    }
+
+    void disable() {
+        detail::g_enabled.store(false, std::memory_order_relaxed);
+    }
+
+    bool tracing() {
+        State& s = state();
+        std::lock_guard<std::mutex> lk(s.m);
+        return s.trace;
+    }
+
+    void reset() {
+        State& s = state();
+        std::lock_guard<std::mutex> lk(s.m);
+        s.stages.clear();
+        s.events.clear();
+        s.origin = std::chrono::steady_clock::now();
+    }
+
+    std::map<std::string, StageStats> snapshot() {
+        State& s = state();
+        std::lock_guard<std::mutex> lk(s.m);
+        // Merge by name: the same literal may have several addresses across
+        // translation units.
+        std::map<std::string, StageStats> out;
+        for (const auto& [stage, st] : s.stages) {
+            StageStats& o = out[stage];
+            o.total_s += st.total_s;
+            o.calls += st.calls;
+            o.pairs += st.pairs;
+        }
+        return out;
+    }
+
+    std::size_t trace_event_count() {
+        State& s = state();
+        std::lock_guard<std::mutex> lk(s.m);
+        return s.events.size();
+    }
+
+    void add_pairs(const char* stage, std::uint64_t pairs) {
+        if (!enabled()) return;
+        State& s = state();
+        std::lock_guard<std::mutex> lk(s.m);
+        s.stages[stage].pairs += pairs;
+    }
+
+    void ScopedTimer::record(const char* stage, std::chrono::steady_clock::time_point start,
+                             std::chrono::steady_clock::time_point end, std::uint64_t pairs) {
+        const std::uint32_t tid = thread_index();
+        State& s = state();
+        std::lock_guard<std::mutex> lk(s.m);
+        try {
+            StageStats& st = s.stages[stage];
+            st.total_s += std::chrono::duration<double>(end - start).count();
+            ++st.calls;
+            st.pairs += pairs;
+            if (s.trace && s.events.size() < s.max_events && start >= s.origin) {
+                s.events.push_back({stage,
+                                    std::chrono::duration_cast<std::chrono::nanoseconds>(start - s.origin).count(),
+                                    std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), tid});
+            }
+        } catch (const std::bad_alloc&) {
+            // Called from a destructor: drop the sample rather than terminate.
+        }
+    }
+
+    void write_chrome_trace(const std::string& path) {
+        std::vector<TraceEvent> events;
+        {
+            State& s = state();
+            std::lock_guard<std::mutex> lk(s.m);
+            events = s.events;
+        }
+        std::ofstream out(path);
+        if (!out) {
+            throw std::runtime_error("write_chrome_trace: cannot open " + path);
+        }
+        // Complete ("X") events; timestamps and durations in microseconds.
+        out << std::fixed << std::setprecision(3);
+        out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+        for (std::size_t i = 0; i < events.size(); ++i) {
+            const TraceEvent& e = events[i];
+            out << "{\"name\": \"" << json_escape(e.stage) << "\", \"cat\": \"sst\", \"ph\": \"X\", \"ts\": "
+                << double(e.ts_ns) * 1e-3 << ", \"dur\": " << double(e.dur_ns) * 1e-3
+                << ", \"pid\": 1, \"tid\": " << e.tid << "}" << (i + 1 < events.size() ? ",\n" : "\n");
+        }
+        out << "]}\n";
+        if (!out) {
+            throw std::runtime_error("write_chrome_trace: failed writing " + path);
+        }
+    }
+
+} // namespace sst::profiler
@@ -0,0 +1,98 @@
+#ifndef SWIRL_STRING_CORE_PROFILER_H
+#define SWIRL_STRING_CORE_PROFILER_H
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace sst::profiler {
+
+/**
+ * @brief Hot-path stage profiler.
+ *
+ * Kernels mark their major stages with SST_PROFILE_SCOPE("stage.name"); while
+ * the profiler is enabled every scope adds its wall time, one call and an
+ * optional pair count to the per-stage totals, and (with tracing on) records
+ * a Chrome trace event. Disabled, a scope costs one relaxed atomic load.
+ * Totals are inclusive: a pipeline stage also contains the kernel stages it
+ * calls. Define SST_DISABLE_PROFILER to compile the scopes out entirely.
+ */
+struct StageStats {
+    double total_s = 0.0;
+    std::uint64_t calls = 0;
+    std::uint64_t pairs = 0;
+};
+
+namespace detail {
+    extern std::atomic<bool> g_enabled;
+}
+
+inline bool enabled() noexcept {
+    return detail::g_enabled.load(std::memory_order_relaxed);
+}
+// Out-of-line query for code outside the core library (bindings): a shared
+// core does not export detail::g_enabled on every platform.
+bool is_enabled();
+
+// trace: also keep one trace event per scope (capped at max_trace_events).
+void enable(bool trace = false, std::size_t max_trace_events = 1000000);
+void disable();
+bool tracing();
+void reset();
+
+std::map<std::string, StageStats> snapshot();
+std::size_t trace_event_count();
+
+// Write the recorded events as Chrome trace-event JSON (chrome://tracing,
+// Perfetto). Throws std::runtime_error when the file cannot be written.
+void write_chrome_trace(const std::string& path);
+
+// Add to a stage without timing it (e.g. a pair count known only afterwards).
+void add_pairs(const char* stage, std::uint64_t pairs);
+
+class ScopedTimer {
+public:
+    explicit ScopedTimer(const char* stage, std::uint64_t pairs = 0) noexcept
+        : stage_(enabled() ? stage : nullptr), pairs_(pairs) {
+        if (stage_) start_ = std::chrono::steady_clock::now();
+    }
+    ~ScopedTimer() {
+        if (stage_) record(stage_, start_, std::chrono::steady_clock::now(), pairs_);
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    void add_pairs(std::uint64_t pairs) noexcept { pairs_ += pairs; }
+
+private:
+    static void record(const char* stage, std::chrono::steady_clock::time_point start,
+                       std::chrono::steady_clock::time_point end, std::uint64_t pairs);
+
+    const char* stage_;
+    std::uint64_t pairs_;
+    std::chrono::steady_clock::time_point start_{};
+};
+
+} // namespace sst::profiler
+
+#define SST_PROFILE_CONCAT_INNER(a, b) a##b
+#define SST_PROFILE_CONCAT(a, b) SST_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef SST_DISABLE_PROFILER
+#define SST_PROFILE_SCOPE(stage) ((void)0)
+#define SST_PROFILE_SCOPE_PAIRS(stage, pairs) ((void)0)
+#else
+// Stage names must be string literals (they are stored by pointer).
+#define SST_PROFILE_SCOPE(stage) \
+    ::sst::profiler::ScopedTimer SST_PROFILE_CONCAT(sst_profile_scope_, __LINE__)(stage)
+#define SST_PROFILE_SCOPE_PAIRS(stage, pairs) \
+    ::sst::profiler::ScopedTimer SST_PROFILE_CONCAT(sst_profile_scope_, __LINE__)( \
+        stage, ::sst::profiler::enabled() ? static_cast<std::uint64_t>(pairs) : 0)
+#endif
+
+#endif // SWIRL_STRING_CORE_PROFILER_H
@@ -0,0 +1,69 @@
+// src/profiler_py.cpp
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <string>
+#include "profiler.h"
+
+namespace py = pybind11;
+
+void bind_profiler(py::module_& m) {
+    py::module_ p = m.def_submodule("profiler", R"pbdoc(
+        Built-in stage profiler for the native kernels.
+
+        Stages are named like 'helicity.biot_savart' or 'relax.forces'. Totals
+        are inclusive: an outer stage also contains the stages it calls.
+        Disabled (the default) the instrumentation costs one atomic load per
+        stage.
+    )pbdoc");
+
+    p.def("enable", &sst::profiler::enable,
+          py::arg("trace") = false, py::arg("max_trace_events") = 1000000,
+          R"pbdoc(
+        Start collecting per-stage totals.
+
+        Args:
+          trace (bool): also record one Chrome trace event per stage call.
+          max_trace_events (int): cap on the number of stored trace events.
+    )pbdoc");
+
+    p.def("disable", &sst::profiler::disable,
+          "Stop collecting; totals and trace events are kept until reset().");
+
+    p.def("is_enabled", &sst::profiler::is_enabled,
+          "True while the profiler is collecting.");
+
+    p.def("reset", &sst::profiler::reset,
+          "Clear all stage totals and trace events.");
+
+    p.def("stats", []() {
+        py::dict out;
+        for (const auto& [stage, st] : sst::profiler::snapshot()) {
+            py::dict d;
+            d["total_s"] = st.total_s;
+            d["calls"] = st.calls;
+            d["pairs"] = st.pairs;
+            d["mean_s"] = st.calls ? st.total_s / static_cast<double>(st.calls) : 0.0;
+            out[py::str(stage)] = d;
+        }
+        return out;
+    }, R"pbdoc(
+        Per-stage totals collected since the last reset().
+
+        Returns:
+          dict mapping stage name -> {'total_s', 'calls', 'pairs', 'mean_s'}.
+          'pairs' counts the interaction pairs (or samples) a stage processed.
+    )pbdoc");
+
+    p.def("trace_event_count", &sst::profiler::trace_event_count,
+          "Number of trace events recorded (enable(trace=True)).");
+
+    p.def("export_chrome_trace", [](const std::string& path) {
+        py::gil_scoped_release release;
+        sst::profiler::write_chrome_trace(path);
+    }, py::arg("path"), R"pbdoc(
+        Write the recorded events as Chrome trace-event JSON.
+
+        Open the file in chrome://tracing or https://ui.perfetto.dev.
+        Requires enable(trace=True) before the profiled calls.
+    )pbdoc");
+}
@@ -323,26 +323,42 @@ std::vector<HelicityResult> batch_helicity_from_dir(
     int nsamples,
     bool recurse
 ) {
-    std::vector<HelicityResult> out;
+    return batch_helicity_from_dir(root_dir, grid_size, spacing, interior_margin, nsamples, recurse, nullptr);
+}
+
+std::vector<HelicityResult> batch_helicity_from_dir(
+    const std::string& root_dir,
+    int grid_size,
+    double spacing,
+    int interior_margin,
+    int nsamples,
+    bool recurse,
+    const std::function<void(std::size_t done, std::size_t total)>& on_file
+) {
     fs::path root(root_dir);
     if (!fs::exists(root)) throw std::runtime_error("directory does not exist: " + root_dir);
 
-    if (recurse) {
-        for (const auto& entry : fs::recursive_directory_iterator(root)) {
-            if (!entry.is_regular_file()) continue;
-            if (entry.path().extension() != ".fseries") continue;
-            out.push_back(helicity_from_fseries(entry.path().string(), grid_size, spacing, interior_margin, nsamples));
+    // List first so progress has a total; results are sorted by path anyway.
+    std::vector<std::string> paths;
+    auto collect = [&paths](const fs::directory_entry& entry) {
+        if (entry.is_regular_file() && entry.path().extension() == ".fseries") {
+            paths.push_back(entry.path().string());
         }
+    };
+    if (recurse) {
+        for (const auto& entry : fs::recursive_directory_iterator(root)) collect(entry);
     } else {
-        for (const auto& entry : fs::directory_iterator(root)) {
-            if (!entry.is_regular_file()) continue;
-            if (entry.path().extension() != ".fseries") continue;
-            out.push_back(helicity_from_fseries(entry.path().string(), grid_size, spacing, interior_margin, nsamples));
-        }
+        for (const auto& entry : fs::directory_iterator(root)) collect(entry);
+    }
+    std::sort(paths.begin(), paths.end());
+
+    std::vector<HelicityResult> out;
+    out.reserve(paths.size());
+    if (on_file) on_file(0, paths.size());
+    for (const auto& path : paths) {
+        out.push_back(helicity_from_fseries(path, grid_size, spacing, interior_margin, nsamples));
+        if (on_file) on_file(out.size(), paths.size());
     }
-    std::sort(out.begin(), out.end(), [](const HelicityResult& a, const HelicityResult& b) {
-        return a.path < b.path;
-    });
     return out;
 }
 
@@ -2,6 +2,8 @@
 #define SWIRL_STRING_CORE_SST_EXTENSIONS_H
 
 #pragma once
+#include <cstddef>
+#include <functional>
 #include <map>
 #include <optional>
 #include <string>
@@ -121,6 +123,18 @@ std::vector<HelicityResult> batch_helicity_from_dir(
     bool recurse = false
 );
 
+// Same, calling on_file(done, total) before the first file and after each
+// one; on_file may throw to abort the batch.
+std::vector<HelicityResult> batch_helicity_from_dir(
+    const std::string& root_dir,
+    int grid_size,
+    double spacing,
+    int interior_margin,
+    int nsamples,
+    bool recurse,
+    const std::function<void(std::size_t done, std::size_t total)>& on_file
+);
+
 std::map<std::string, double> compare_fseries_files(
     const std::string& path_a,
     const std::string& path_b,
@@ -69,7 +69,8 @@ void bind_extensions(py::module_& m) {
 
     m.def("canonicalize_fseries_file_inplace",
           &canonicalize_fseries_file_inplace,
-          py::arg("path"));
+          py::arg("path"),
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("compute_helicity_from_fseries",
           &helicity_from_fseries,
@@ -77,18 +78,21 @@ void bind_extensions(py::module_& m) {
           py::arg("grid_size")=32,
           py::arg("spacing")=0.1,
           py::arg("interior_margin")=8,
-          py::arg("nsamples")=1000);
+          py::arg("nsamples")=1000,
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("sample_curve_centered",
           &sample_curve_centered,
           py::arg("path"),
-          py::arg("nsamples")=1024);
+          py::arg("nsamples")=1024,
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("compute_curve_metrics_from_fseries",
           &curve_metrics_from_fseries,
           py::arg("path"),
           py::arg("nsamples")=2048,
-          py::arg("skip")=3);
+          py::arg("skip")=3,
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("curve_length_from_fseries",
           [](const std::string& path, int nsamples) {
@@ -96,7 +100,8 @@ void bind_extensions(py::module_& m) {
               return curve_length(pts);
           },
           py::arg("path"),
-          py::arg("nsamples")=2048);
+          py::arg("nsamples")=2048,
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("min_non_neighbor_distance_from_fseries",
           [](const std::string& path, int nsamples, int skip) {
@@ -105,7 +110,8 @@ void bind_extensions(py::module_& m) {
           },
           py::arg("path"),
           py::arg("nsamples")=2048,
-          py::arg("skip")=3);
+          py::arg("skip")=3,
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("reach_proxy_from_fseries",
           [](const std::string& path, int nsamples, int skip) {
@@ -114,26 +120,30 @@ void bind_extensions(py::module_& m) {
           },
           py::arg("path"),
           py::arg("nsamples")=2048,
-          py::arg("skip")=3);
+          py::arg("skip")=3,
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("compute_filament_energy_from_fseries",
           &filament_energy_from_fseries,
           py::arg("path"),
-          py::arg("params"));
+          py::arg("params"),
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("batch_helicity_from_dir",
-          &batch_helicity_from_dir,
+          py::overload_cast<const std::string&, int, double, int, int, bool>(&batch_helicity_from_dir),
           py::arg("root_dir"),
           py::arg("grid_size")=32,
           py::arg("spacing")=0.1,
           py::arg("interior_margin")=8,
           py::arg("nsamples")=1000,
-          py::arg("recurse")=false);
+          py::arg("recurse")=false,
+          py::call_guard<py::gil_scoped_release>());
 
     m.def("compare_fseries_files",
           &compare_fseries_files,
           py::arg("path_a"),
           py::arg("path_b"),
           py::arg("nsamples")=2048,
-          py::arg("skip")=3);
+          py::arg("skip")=3,
+          py::call_guard<py::gil_scoped_release>());
 }
\ No newline at end of file
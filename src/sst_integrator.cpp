@@ -1,12 +1,10 @@
 #include "sst_integrator.h"
 #include "../include/SST_Constants.h"
+#include "profiler.h"
+#include "thread_pool.h"
 #include <cmath>
 #include <vector>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 namespace sst {
 
 namespace {
@@ -26,6 +24,7 @@ namespace {
 
 void compute_sst_mass(const std::vector<Vec3>& points, double chi_spin,
                       double& m_core, double& m_fluid) {
+    SST_PROFILE_SCOPE_PAIRS("sst_integrator.mass", points.size() * points.size());
     using namespace SST::Constants;
     const size_t N = points.size();
     std::vector<Vec3> dp(N);
@@ -39,24 +38,27 @@ void compute_sst_mass(const std::vector<Vec3>& points, double chi_spin,
 
     m_core = static_cast<double>(pi * (RC_CORE * RC_CORE) * RHO_CORE * L_K);
 
-    double neumann_integral = 0.0;
     const double r_c = static_cast<double>(RC_CORE);
     const double r_c_sq = r_c * r_c;
 
-#ifdef _OPENMP
-    #pragma omp parallel for reduction(+:neumann_integral) schedule(dynamic)
-#endif
-    for (size_t i = 0; i < N; ++i) {
-        double local_sum = 0.0;
-        for (size_t j = 0; j < N; ++j) {
-            Vec3 r_diff = subtract(points[i], points[j]);
-            double dist_sq = norm_squared(r_diff);
-            double denom = std::sqrt(dist_sq + r_c_sq);
-            double num = dot_product(dp[i], dp[j]);
-            local_sum += num / denom;
+    // Row sums on the shared pool, reduced in row order: the result does not
+    // depend on the thread count.
+    std::vector<double> row_sum(N, 0.0);
+    parallel_for(0, N, 16, [&](std::size_t lo, std::size_t hi) {
+        for (size_t i = lo; i < hi; ++i) {
+            double local_sum = 0.0;
+            for (size_t j = 0; j < N; ++j) {
+                Vec3 r_diff = subtract(points[i], points[j]);
+                double dist_sq = norm_squared(r_diff);
+                double denom = std::sqrt(dist_sq + r_c_sq);
+                double num = dot_product(dp[i], dp[j]);
+                local_sum += num / denom;
+            }
+            row_sum[i] = local_sum;
         }
-        neumann_integral += local_sum;
-    }
+    });
+    double neumann_integral = 0.0;
+    for (double s : row_sum) neumann_integral += s;
 
     const double v_swirl = static_cast<double>(V_SWIRL);
     const double rho_f = static_cast<double>(RHO_FLUID);
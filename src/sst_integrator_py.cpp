@@ -10,7 +10,10 @@ void bind_sst_integrator(py::module_& m) {
     m.def("compute_sst_mass",
           [](const std::vector<std::array<double, 3>>& points, double chi_spin) {
               double m_core = 0.0, m_fluid = 0.0;
-              compute_sst_mass(points, chi_spin, m_core, m_fluid);
+              {
+                  py::gil_scoped_release release;
+                  compute_sst_mass(points, chi_spin, m_core, m_fluid);
+              }
               return py::make_tuple(m_core, m_fluid);
           },
           py::arg("points"),
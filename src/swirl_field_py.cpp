@@ -7,7 +7,7 @@ namespace py = pybind11;
 
 void bind_swirl_field(py::module_& m) {
 	m.def("compute_swirl_field", &sst::compute_swirl_field,
-				py::arg("res"), py::arg("time"),
+				py::arg("res"), py::arg("time"), py::call_guard<py::gil_scoped_release>(),
 				R"pbdoc(
 				Compute 2D swirl force field at a given resolution and time.
 			)pbdoc");
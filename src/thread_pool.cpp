@@ -0,0 +1,378 @@
+#include "thread_pool.h"
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace sst {
+
+    namespace {
+        thread_local const WorkStealingPool* tl_pool = nullptr;
+        thread_local std::size_t tl_index = 0;
+
+        // Positive count from an environment variable, 0 when unset or invalid.
+        // OMP_NUM_THREADS may hold one count per nesting level ("4,2"): the
+        // first one applies.
+        std::size_t threads_from_env(const char* name) {
+            const char* env = std::getenv(name);
+            if (!env || !*env) return 0;
+            char* end = nullptr;
+            const unsigned long n = std::strtoul(env, &end, 10);
+            return ((*end == '\0' || *end == ',') && n > 0) ? static_cast<std::size_t>(n) : 0;
+        }
+
+        // CPUs the process may run on (taskset, cpuset cgroups, Windows process
+        // affinity), so a process confined to a few cores does not start a
+        // worker for every core of the machine.
+        std::vector<int> allowed_cpus() {
+            std::vector<int> cpus;
+#if defined(_WIN32)
+            DWORD_PTR process_mask = 0, system_mask = 0;
+            if (GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask)) {
+                for (int c = 0; c < static_cast<int>(sizeof(DWORD_PTR) * 8); ++c) {
+                    if (process_mask & (DWORD_PTR(1) << c)) cpus.push_back(c);
+                }
+            }
+#elif defined(__linux__) && !defined(__EMSCRIPTEN__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+                for (int c = 0; c < CPU_SETSIZE; ++c) {
+                    if (CPU_ISSET(c, &set)) cpus.push_back(c);
+                }
+            }
+#endif
+            if (cpus.empty()) {
+                const unsigned n = std::max(1u, std::thread::hardware_concurrency());
+                for (unsigned c = 0; c < n; ++c) cpus.push_back(static_cast<int>(c));
+            }
+            return cpus;
+        }
+
+        void pin_current_thread(int cpu) {
+#if defined(_WIN32)
+            if (cpu < static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+                SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu);
+            }
+#elif defined(__linux__) && !defined(__EMSCRIPTEN__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+            (void)cpu;  // macOS has no hard affinity; wasm has no CPUs to pick
+#endif
+        }
+
+        // The process-wide pool and the settings it is (re)built from.
+        struct Registry {
+            std::mutex m;
+            std::shared_ptr<WorkStealingPool> pool;
+            std::size_t requested = 0;  // set_num_threads(); 0 = default
+            bool pin = threads_from_env("SST_PIN_THREADS") > 0;
+            bool forked_child = false;
+            std::atomic<NestedPolicy> nested{NestedPolicy::Serial};
+        };
+
+        Registry& registry();
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+        // fork() copies only the calling thread: the child must not touch the
+        // parent's workers. The registry lock is held across fork so the child
+        // never inherits it mid-update.
+        void fork_prepare() { registry().m.lock(); }
+        void fork_parent() { registry().m.unlock(); }
+        void fork_child() {
+            Registry& r = registry();
+            if (r.pool) {
+                // Leaked on purpose: destroying it would join threads that do
+                // not exist in this process.
+                new std::shared_ptr<WorkStealingPool>(std::move(r.pool));
+            }
+            r.forked_child = true;
+            r.m.unlock();
+        }
+#endif
+
+        // Never destroyed: kernels may still run from other static destructors,
+        // and the fork handlers stay registered for the life of the process.
+        Registry& registry() {
+            static Registry* r = []() {
+                auto* reg = new Registry();
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+                pthread_atfork(fork_prepare, fork_parent, fork_child);
+#endif
+                return reg;
+            }();
+            return *r;
+        }
+
+        std::size_t resolved_threads(const Registry& r) {
+            if (r.requested) return r.requested;
+            if (std::size_t n = threads_from_env("SST_NUM_THREADS")) return n;
+            if (std::size_t n = threads_from_env("OMP_NUM_THREADS")) return n;
+            if (r.forked_child) return 1;
+            return allowed_cpus().size();
+        }
+
+        std::shared_ptr<WorkStealingPool> acquire_pool() {
+            Registry& r = registry();
+            std::lock_guard<std::mutex> lk(r.m);
+            if (!r.pool) {
+                r.pool = std::make_shared<WorkStealingPool>(resolved_threads(r), r.pin);
+            }
+            return r.pool;
+        }
+
+        // Apply a settings change and drop the current pool; the next kernel
+        // builds a new one. The old pool is destroyed (draining its queue)
+        // when the last parallel_for still running on it returns.
+        template <class Update>
+        void replace_pool(const char* who, Update update) {
+            if (tl_pool) {
+                throw std::runtime_error(std::string(who) + ": cannot be called from a thread-pool worker");
+            }
+            std::shared_ptr<WorkStealingPool> old;
+            {
+                Registry& r = registry();
+                std::lock_guard<std::mutex> lk(r.m);
+                update(r);
+                old = std::move(r.pool);
+            }
+        }
+    }
+
+    WorkStealingPool::WorkStealingPool(std::size_t num_threads, bool pin_threads) {
+        const std::vector<int> cpus = allowed_cpus();
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+        // Single-threaded wasm build: no worker can be spawned, so submit()
+        // runs every task inline and parallel_for never fans out.
+        num_threads = 0;
+#else
+        if (num_threads == 0) {
+            num_threads = cpus.size();
+        }
+#endif
+        queues_.reserve(num_threads);
+        for (std::size_t i = 0; i < num_threads; ++i) {
+            queues_.push_back(std::make_unique<WorkerQueue>());
+        }
+        threads_.reserve(num_threads);
+        for (std::size_t i = 0; i < num_threads; ++i) {
+            const int cpu = pin_threads ? cpus[i % cpus.size()] : -1;
+            threads_.emplace_back([this, i, cpu]() {
+                if (cpu >= 0) pin_current_thread(cpu);
+                worker_loop(i);
+            });
+        }
+    }
+
+    WorkStealingPool::~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lk(state_m_);
+            stop_ = true;
+        }
+        wake_cv_.notify_all();
+        for (auto& t : threads_) {
+            if (t.joinable()) t.join();
+        }
+    }
+
+    int WorkStealingPool::current_worker_index() const {
+        return (tl_pool == this) ? static_cast<int>(tl_index) : -1;
+    }
+
+    void WorkStealingPool::submit(Task task) {
+        if (threads_.empty()) {
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lk(state_m_);
+                if (!first_error_) first_error_ = std::current_exception();
+            }
+            return;
+        }
+        const int self = current_worker_index();
+        const std::size_t q = (self >= 0)
+            ? static_cast<std::size_t>(self)
+            : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+        // Count first so a worker that grabs the task immediately never sees
+        // the counters go negative.
+        {
+            std::lock_guard<std::mutex> lk(state_m_);
+            ++queued_;
+            ++in_flight_;
+        }
+        {
+            std::lock_guard<std::mutex> lk(queues_[q]->m);
+            queues_[q]->tasks.push_back(std::move(task));
+        }
+        wake_cv_.notify_one();
+    }
+
+    bool WorkStealingPool::try_pop_local(std::size_t index, Task& out) {
+        auto& q = *queues_[index];
+        std::lock_guard<std::mutex> lk(q.m);
+        if (q.tasks.empty()) return false;
+        out = std::move(q.tasks.back());
+        q.tasks.pop_back();
+        return true;
+    }
+
+    bool WorkStealingPool::try_steal(std::size_t thief, Task& out) {
+        const std::size_t n = queues_.size();
+        for (std::size_t k = 1; k < n; ++k) {
+            auto& q = *queues_[(thief + k) % n];
+            std::lock_guard<std::mutex> lk(q.m);
+            if (q.tasks.empty()) continue;
+            out = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    void WorkStealingPool::worker_loop(std::size_t index) {
+        tl_pool = this;
+        tl_index = index;
+        for (;;) {
+            Task task;
+            if (try_pop_local(index, task) || try_steal(index, task)) {
+                {
+                    std::lock_guard<std::mutex> lk(state_m_);
+                    --queued_;
+                }
+                try {
+                    task();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lk(state_m_);
+                    if (!first_error_) first_error_ = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lk(state_m_);
+                if (--in_flight_ == 0) idle_cv_.notify_all();
+                continue;
+            }
+            std::unique_lock<std::mutex> lk(state_m_);
+            wake_cv_.wait(lk, [this]() { return stop_ || queued_ > 0; });
+            if (stop_ && queued_ == 0) return;
+        }
+    }
+
+    void WorkStealingPool::wait_idle() {
+        std::unique_lock<std::mutex> lk(state_m_);
+        idle_cv_.wait(lk, [this]() { return in_flight_ == 0; });
+        if (first_error_) {
+            std::exception_ptr err = first_error_;
+            first_error_ = nullptr;
+            std::rethrow_exception(err);
+        }
+    }
+
+    void set_num_threads(std::size_t n) {
+        replace_pool("set_num_threads", [n](Registry& r) { r.requested = n; });
+    }
+
+    std::size_t get_num_threads() {
+        return std::max<std::size_t>(1, acquire_pool()->size());
+    }
+
+    void set_thread_pinning(bool on) {
+        replace_pool("set_thread_pinning", [on](Registry& r) { r.pin = on; });
+    }
+
+    bool get_thread_pinning() {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lk(r.m);
+        return r.pin;
+    }
+
+    void set_nested_policy(NestedPolicy policy) {
+        registry().nested.store(policy, std::memory_order_relaxed);
+    }
+
+    NestedPolicy get_nested_policy() {
+        return registry().nested.load(std::memory_order_relaxed);
+    }
+
+    WorkStealingPool& shared_pool() {
+        return *acquire_pool();
+    }
+
+    void parallel_for(std::size_t begin, std::size_t end, std::size_t grain,
+                      const std::function<void(std::size_t, std::size_t)>& body) {
+        if (end <= begin) return;
+        if (grain == 0) grain = 1;
+        const std::size_t chunks = (end - begin + grain - 1) / grain;
+        if (chunks <= 1) {
+            body(begin, end);
+            return;
+        }
+        // Held for the whole call: a concurrent set_num_threads() retires the
+        // pool but cannot destroy it under us.
+        const std::shared_ptr<WorkStealingPool> pool = acquire_pool();
+        // Nested means running on one of this pool's own workers; tasks on
+        // other pools (JobQueue) still fan out.
+        if (pool->size() <= 1
+            || (tl_pool == pool.get() && get_nested_policy() == NestedPolicy::Serial)) {
+            body(begin, end);
+            return;
+        }
+
+        // Shared so helpers that start after the caller returned still see
+        // valid state (they find no chunk left and exit without touching body).
+        struct State {
+            std::atomic<std::size_t> next{0};
+            std::size_t done = 0;
+            std::mutex m;
+            std::condition_variable cv;
+            std::exception_ptr error;
+        };
+        auto st = std::make_shared<State>();
+        const auto* fn = &body;
+
+        auto run_chunks = [st, fn, begin, end, grain, chunks]() {
+            std::size_t local_done = 0;
+            std::exception_ptr local_error;
+            for (;;) {
+                const std::size_t c = st->next.fetch_add(1, std::memory_order_relaxed);
+                if (c >= chunks) break;
+                const std::size_t lo = begin + c * grain;
+                const std::size_t hi = std::min(end, lo + grain);
+                if (!local_error) {
+                    try {
+                        (*fn)(lo, hi);
+                    } catch (...) {
+                        local_error = std::current_exception();
+                    }
+                }
+                ++local_done;
+            }
+            if (local_done == 0) return;
+            std::lock_guard<std::mutex> lk(st->m);
+            if (local_error && !st->error) st->error = local_error;
+            st->done += local_done;
+            if (st->done == chunks) st->cv.notify_all();
+        };
+
+        // The caller works too, so get_num_threads() threads in total.
+        const std::size_t helpers = std::min(pool->size() - 1, chunks - 1);
+        for (std::size_t h = 0; h < helpers; ++h) {
+            pool->submit(run_chunks);
+        }
+        run_chunks();
+
+        std::unique_lock<std::mutex> lk(st->m);
+        st->cv.wait(lk, [&]() { return st->done == chunks; });
+        if (st->error) std::rethrow_exception(st->error);
+    }
+
+} // namespace sst
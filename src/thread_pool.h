@@ -0,0 +1,129 @@
+#ifndef SWIRL_STRING_CORE_THREAD_POOL_H
+#define SWIRL_STRING_CORE_THREAD_POOL_H
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sst {
+
+/**
+ * @brief Work-stealing task pool.
+ *
+ * Every worker owns a deque: it pops its own work LIFO (cache-warm) and, when
+ * empty, steals FIFO from the other workers. Tasks submitted from inside a
+ * worker land on that worker's deque; external submissions are dealt
+ * round-robin. Suited to batches whose per-task cost varies by orders of
+ * magnitude (e.g. one knot vs. a three-component link in the particle zoo).
+ */
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+    // num_threads == 0 -> the CPUs this process may run on (at least 1).
+    // pin_threads binds worker i to the i-th of those CPUs (Linux, Windows;
+    // ignored elsewhere). A wasm build without pthreads has no workers:
+    // submit() runs inline.
+    explicit WorkStealingPool(std::size_t num_threads = 0, bool pin_threads = false);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    std::size_t size() const { return threads_.size(); }
+
+    void submit(Task task);
+
+    // Block until every submitted task has finished. Rethrows the first
+    // exception escaping a task (later ones are dropped).
+    void wait_idle();
+
+    // Index of the calling worker inside this pool, or -1 for outside threads.
+    int current_worker_index() const;
+
+private:
+    struct WorkerQueue {
+        std::mutex m;
+        std::deque<Task> tasks;
+    };
+
+    void worker_loop(std::size_t index);
+    bool try_pop_local(std::size_t index, Task& out);
+    bool try_steal(std::size_t thief, Task& out);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> threads_;
+
+    std::mutex state_m_;
+    std::condition_variable wake_cv_;
+    std::condition_variable idle_cv_;
+    std::size_t queued_ = 0;     // tasks sitting in some deque
+    std::size_t in_flight_ = 0;  // queued + running
+    bool stop_ = false;
+    std::exception_ptr first_error_;
+
+    std::atomic<std::size_t> next_queue_{0};
+};
+
+/**
+ * @brief Library-wide pool controls.
+ *
+ * Every parallel kernel runs on one process-wide pool, created on first use
+ * with get_num_threads() workers. Its size is, in order of precedence:
+ * set_num_threads(n), the SST_NUM_THREADS environment variable,
+ * OMP_NUM_THREADS (which joblib/loky set in their worker processes) and the
+ * number of CPUs in the process affinity mask. A child created by fork()
+ * rebuilds the pool on first use and defaults to one thread, because its
+ * parent already runs in parallel across processes; set_num_threads() or the
+ * environment variables override that.
+ *
+ * set_num_threads() and set_thread_pinning() replace the pool: the old one
+ * finishes the kernels already running on it and is then torn down. They
+ * throw std::runtime_error when called from a pool worker.
+ */
+void set_num_threads(std::size_t n);  // 0 restores the default
+std::size_t get_num_threads();
+
+// Bind pool workers to distinct CPUs (also SST_PIN_THREADS=1). Helps
+// NUMA machines and benchmarks; leave off when several processes share
+// the CPUs, as they would all pin to the same first cores.
+void set_thread_pinning(bool on);
+bool get_thread_pinning();
+
+// What parallel_for does when called from inside a shared_pool() task.
+// Tasks on other pools (JobQueue workers) are not nested and fan out.
+enum class NestedPolicy {
+    Serial,  // run inline on the calling worker (default): the outer level already fills the pool
+    Shared,  // split across the same pool; the caller keeps claiming chunks, so it cannot deadlock
+};
+void set_nested_policy(NestedPolicy policy);
+NestedPolicy get_nested_policy();
+
+// The current process-wide pool. The reference is invalidated by
+// set_num_threads() / set_thread_pinning(); do not keep it across them.
+WorkStealingPool& shared_pool();
+
+/**
+ * @brief Run body(lo, hi) over [begin, end) split into chunks of `grain`.
+ *
+ * Chunks are claimed dynamically by the calling thread and by shared_pool()
+ * workers, so uneven rows (e.g. triangular pair loops) balance themselves.
+ * Which thread runs which chunk is unspecified: callers that need
+ * deterministic results write per-index partials and reduce them serially.
+ * Called from inside a shared_pool() worker it follows get_nested_policy().
+ * The first exception thrown by body is rethrown here.
+ */
+void parallel_for(std::size_t begin, std::size_t end, std::size_t grain,
+                  const std::function<void(std::size_t, std::size_t)>& body);
+
+} // namespace sst
+
+#endif // SWIRL_STRING_CORE_THREAD_POOL_H
@@ -0,0 +1,65 @@
+// src/thread_pool_py.cpp
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include "thread_pool.h"
+
+namespace py = pybind11;
+
+void bind_thread_pool(py::module_& m) {
+    m.def("set_num_threads", [](std::size_t n) {
+        py::gil_scoped_release release;  // joins the old workers
+        sst::set_num_threads(n);
+    }, py::arg("n"), R"pbdoc(
+        Set the number of threads every parallel kernel uses (0 = default).
+
+        The default is SST_NUM_THREADS, else OMP_NUM_THREADS, else the CPUs
+        this process may run on. In multiprocessing workers it is 1, so a
+        process pool does not oversubscribe the machine; call this (e.g. in
+        the pool initializer) to give each worker more threads.
+    )pbdoc");
+
+    m.def("get_num_threads", &sst::get_num_threads,
+          "Number of threads the parallel kernels use.");
+
+    m.def("set_thread_pinning", [](bool on) {
+        py::gil_scoped_release release;
+        sst::set_thread_pinning(on);
+    }, py::arg("on"), R"pbdoc(
+        Bind the pool workers to distinct CPUs (also SST_PIN_THREADS=1).
+
+        Leave off when several processes share the machine: each would pin
+        its workers to the same first CPUs of its affinity mask.
+    )pbdoc");
+
+    m.def("get_thread_pinning", &sst::get_thread_pinning,
+          "True when pool workers are bound to CPUs.");
+
+    m.def("set_nested_parallelism", [](const std::string& policy) {
+        if (policy == "serial") sst::set_nested_policy(sst::NestedPolicy::Serial);
+        else if (policy == "shared") sst::set_nested_policy(sst::NestedPolicy::Shared);
+        else throw std::invalid_argument("set_nested_parallelism: expected 'serial' or 'shared', got '" + policy + "'");
+    }, py::arg("policy"), R"pbdoc(
+        What a parallel kernel does when it runs inside another one's task.
+
+        'serial' (default) runs it on the calling worker; 'shared' splits it
+        across the same pool.
+    )pbdoc");
+
+    m.def("get_nested_parallelism", []() {
+        return std::string(sst::get_nested_policy() == sst::NestedPolicy::Shared ? "shared" : "serial");
+    }, "The current nested-parallelism policy ('serial' or 'shared').");
+
+    // Workers started with the spawn/forkserver methods import the module
+    // afresh; forked workers are handled by the pool itself.
+    if (!std::getenv("SST_NUM_THREADS") && !std::getenv("OMP_NUM_THREADS")) {
+        try {
+            py::object parent = py::module_::import("multiprocessing").attr("parent_process")();
+            if (!parent.is_none()) sst::set_num_threads(1);
+        } catch (const py::error_already_set&) {
+            // multiprocessing unavailable (embedded interpreter): keep the default
+        }
+    }
+}
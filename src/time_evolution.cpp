@@ -7,6 +7,7 @@
 // src/time_evolution.cpp
 #include "biot_savart.h"  // assumes sst::biot_savart_velocity is defined
 #include "frenet_helicity.h"
+#include <stdexcept>
 
 namespace sst {
 
@@ -18,20 +19,105 @@ namespace sst {
 			  circulation(gamma) {}
 
 	void TimeEvolution::evolve(double dt, int steps) {
-		for (int step = 0; step < steps; ++step) {
-			std::vector<Vec3> velocity;
-			for (const auto& p : positions) {
-				velocity.push_back(biot_savart_velocity(p, positions, tangents, circulation));
+		if (steps <= 0) {
+			return;
+		}
+		if (tangents.size() != positions.size()) {
+			throw std::invalid_argument("TimeEvolution: tangents must have one entry per position");
+		}
+		auto rhs = [this](const std::vector<Vec3>& X, std::vector<Vec3>& v) { induced_velocity(X, v); };
+		integrator.integrate(rhs, positions, dt, static_cast<size_t>(steps), [this](double h) {
+			sim_time += h;
+			if (induction.mode == InductionMode::Hybrid && induction.far_field_interval > 0 &&
+				++steps_since_far_field >= induction.far_field_interval) {
+				far_field_stale = true;
+				steps_since_far_field = 0;
+				integrator.invalidate();
+			}
+			if (positions.size() >= 3) {
+				compute_frenet_frames(positions, tangents, stage_normals, stage_binormals);
+			}
+			if (trajectory) {
+				trajectory->offer(sim_time, h, positions, tangents);
+			}
+		});
+	}
+
+	void TimeEvolution::attach_trajectory(std::shared_ptr<TrajectoryWriter> writer) {
+		trajectory = std::move(writer);
+		if (trajectory) {
+			trajectory->record(sim_time, 0.0, positions, tangents);
+		}
+	}
+
+	double TimeEvolution::get_time() const {
+		return sim_time;
+	}
+
+	void TimeEvolution::induced_velocity(const std::vector<Vec3>& X, std::vector<Vec3>& v) {
+		// Caller tangents serve the first evaluation; Frenet tangents afterwards.
+		const std::vector<Vec3>* T = &tangents;
+		if (initial_tangents_pending || X.size() < 3) {
+			initial_tangents_pending = false;
+		} else if (induction.mode != InductionMode::LocalInduction) {
+			compute_frenet_frames(X, stage_tangents, stage_normals, stage_binormals);
+			T = &stage_tangents;
+		}
+		switch (induction.mode) {
+		case InductionMode::LocalInduction:
+			local_induction_velocities(X, false, circulation, induction.core_radius,
+									   induction.core_delta, 0, v);
+			return;
+		case InductionMode::Hybrid:
+			if (far_field_stale || induction.far_field_interval == 0 || far_velocity.size() != X.size()) {
+				far_field_velocities(X, *T, circulation, induction.local_window, false, far_velocity);
+				far_field_stale = false;
 			}
-			for (size_t i = 0; i < positions.size(); ++i) {
-				positions[i][0] += dt * velocity[i][0];
-				positions[i][1] += dt * velocity[i][1];
-				positions[i][2] += dt * velocity[i][2];
+			local_induction_velocities(X, false, circulation, induction.core_radius,
+									   induction.core_delta, induction.local_window, v);
+			for (size_t i = 0; i < v.size(); ++i) {
+				for (int d = 0; d < 3; ++d) v[i][d] += far_velocity[i][d];
 			}
-			compute_frenet_frames(positions, tangents, tangents, tangents); // T updated, dummy for N, B
+			return;
+		case InductionMode::BiotSavart:
+		default:
+			biot_savart_self_velocities(X, *T, circulation, v);
+			return;
 		}
 	}
 
+	void TimeEvolution::set_induction(const InductionOptions& options) {
+		if (!(options.core_radius > 0.0)) {
+			throw std::invalid_argument("set_induction: core_radius must be positive");
+		}
+		if (options.mode == InductionMode::Hybrid && options.local_window == 0) {
+			throw std::invalid_argument("set_induction: hybrid mode needs local_window >= 1");
+		}
+		if (options.mode == InductionMode::MultiRate) {
+			throw std::invalid_argument("set_induction: multirate mode is available for closed filaments (VortexKnotSystem)");
+		}
+		induction = options;
+		far_field_stale = true;
+		steps_since_far_field = 0;
+		integrator.invalidate();
+	}
+
+	const InductionOptions& TimeEvolution::get_induction_options() const {
+		return induction;
+	}
+
+	void TimeEvolution::set_integrator(const IntegratorOptions& options) {
+		integrator.set_options(options);
+	}
+
+	const IntegratorOptions& TimeEvolution::get_integrator_options() const {
+		return integrator.options();
+	}
+
+	const IntegratorStats& TimeEvolution::get_integrator_stats() const {
+		return integrator.stats();
+	}
+
 	const std::vector<Vec3>& TimeEvolution::get_positions() const {
 		return positions;
 	}
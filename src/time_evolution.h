@@ -10,6 +10,10 @@
 
 #include <vector>
 #include <array>
+#include <memory>
+#include "ode_integrators.h"
+#include "local_induction.h"
+#include "trajectory_writer.h"
 
 namespace sst {
 
@@ -21,8 +25,24 @@ namespace sst {
 					  std::vector<Vec3> initial_tangents,
 					  double gamma = 1.0);
 
+		// Advance with the configured integrator (forward Euler by default).
+		// The first evaluation uses the tangents given at construction; later
+		// stages use Frenet tangents of the stage positions.
 		void evolve(double dt, int steps);
 
+		void set_integrator(const IntegratorOptions& options);
+		const IntegratorOptions& get_integrator_options() const;
+		const IntegratorStats& get_integrator_stats() const;
+
+		// Velocity model (open filament): Biot–Savart, LIA or hybrid.
+		void set_induction(const InductionOptions& options);
+		const InductionOptions& get_induction_options() const;
+
+		// Stream frames to `writer` from evolve(); the current state is the
+		// first frame. Use TrajectoryOptions::closed = false for diagnostics.
+		void attach_trajectory(std::shared_ptr<TrajectoryWriter> writer);
+		double get_time() const;
+
 		const std::vector<Vec3>& get_positions() const;
 		const std::vector<Vec3>& get_tangents() const;
 
@@ -30,6 +50,19 @@ namespace sst {
 		std::vector<Vec3> positions;
 		std::vector<Vec3> tangents;
 		double circulation;
+		double sim_time = 0.0;
+		std::shared_ptr<TrajectoryWriter> trajectory;
+
+		CurveIntegrator integrator;
+		bool initial_tangents_pending = true;
+		std::vector<Vec3> stage_tangents, stage_normals, stage_binormals;
+
+		InductionOptions induction;
+		std::vector<Vec3> far_velocity;
+		bool far_field_stale = true;
+		size_t steps_since_far_field = 0;
+
+		void induced_velocity(const std::vector<Vec3>& X, std::vector<Vec3>& v);
 	};
 
 } // namespace sst
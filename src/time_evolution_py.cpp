@@ -2,18 +2,83 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include "time_evolution.h"
+#include "trajectory_writer.h"
+#include "vec3_numpy.h"
 
 namespace py = pybind11;
 
 void bind_time_evolution(py::module_& m) {
+	py::class_<sst::IntegratorStats>(m, "IntegratorStats",
+			R"pbdoc(Counters of a curve integrator: RHS evaluations, accepted/rejected steps and step sizes.)pbdoc")
+			.def_readonly("rhs_evaluations", &sst::IntegratorStats::rhs_evaluations)
+			.def_readonly("accepted_steps", &sst::IntegratorStats::accepted_steps)
+			.def_readonly("rejected_steps", &sst::IntegratorStats::rejected_steps)
+			.def_readonly("last_dt", &sst::IntegratorStats::last_dt)
+			.def_readonly("next_dt", &sst::IntegratorStats::next_dt)
+			.def_readonly("last_error", &sst::IntegratorStats::last_error)
+			.def("__repr__", [](const sst::IntegratorStats& s) {
+				return "IntegratorStats(rhs_evaluations=" + std::to_string(s.rhs_evaluations) +
+					   ", accepted_steps=" + std::to_string(s.accepted_steps) +
+					   ", rejected_steps=" + std::to_string(s.rejected_steps) +
+					   ", last_dt=" + std::to_string(s.last_dt) + ")";
+			});
+
 	py::class_<sst::TimeEvolution>(m, "TimeEvolution")
-			.def(py::init<std::vector<sst::Vec3>, std::vector<sst::Vec3>, double>(),
+			.def(py::init([](std::span<const sst::Vec3> positions, std::span<const sst::Vec3> tangents, double gamma) {
+					 return sst::TimeEvolution({positions.begin(), positions.end()},
+											   {tangents.begin(), tangents.end()}, gamma);
+				 }),
 				 py::arg("initial_positions"), py::arg("initial_tangents"), py::arg("gamma") = 1.0)
 			.def("evolve", &sst::TimeEvolution::evolve,
-				 py::arg("dt"), py::arg("steps"))
-			.def("get_positions", &sst::TimeEvolution::get_positions,
-				 py::return_value_policy::reference)
-			.def("get_tangents", &sst::TimeEvolution::get_tangents,
-				 py::return_value_policy::reference);
+				 py::arg("dt"), py::arg("steps"), py::call_guard<py::gil_scoped_release>())
+			.def("set_integrator",
+				 [](sst::TimeEvolution& self, const std::string& scheme, double rtol, double atol,
+					double dt_min, double dt_max, double safety, std::size_t max_steps) {
+					 sst::IntegratorOptions o;
+					 o.scheme = sst::parse_integrator_scheme(scheme);
+					 o.rtol = rtol;
+					 o.atol = atol;
+					 o.dt_min = dt_min;
+					 o.dt_max = dt_max;
+					 o.safety = safety;
+					 o.max_steps = max_steps;
+					 self.set_integrator(o);
+				 },
+				 py::arg("scheme") = "euler", py::arg("rtol") = 1e-6, py::arg("atol") = 1e-9,
+				 py::arg("dt_min") = 0.0, py::arg("dt_max") = 0.0, py::arg("safety") = 0.9,
+				 py::arg("max_steps") = 1000000,
+				 R"pbdoc(Select the time integrator: "euler", "rk4", "rk45" (Dormand–Prince, adaptive) or "lsrk4" (low-storage).
+With "rk45", evolve(dt, steps) covers dt*steps using adaptive sub-steps controlled by rtol/atol.)pbdoc")
+			.def_property_readonly("integrator_scheme", [](const sst::TimeEvolution& self) {
+				return std::string(sst::integrator_scheme_name(self.get_integrator_options().scheme));
+			})
+			.def("get_integrator_stats", &sst::TimeEvolution::get_integrator_stats)
+			.def("set_induction",
+				 [](sst::TimeEvolution& self, const std::string& mode, double core_radius, double core_delta,
+					std::size_t local_window, std::size_t far_field_interval) {
+					 sst::InductionOptions o;
+					 o.mode = sst::parse_induction_mode(mode);
+					 o.core_radius = core_radius;
+					 o.core_delta = core_delta;
+					 o.local_window = local_window;
+					 o.far_field_interval = far_field_interval;
+					 self.set_induction(o);
+				 },
+				 py::arg("mode") = "biot_savart", py::arg("core_radius") = 1e-2, py::arg("core_delta") = 0.25,
+				 py::arg("local_window") = 8, py::arg("far_field_interval") = 1,
+				 R"pbdoc(Select the velocity model: "biot_savart" (default), "lia" or "hybrid" (LIA near field plus
+a far-field Biot–Savart term refreshed every far_field_interval steps).)pbdoc")
+			.def_property_readonly("induction_mode", [](const sst::TimeEvolution& self) {
+				return std::string(sst::induction_mode_name(self.get_induction_options().mode));
+			})
+			.def("attach_trajectory", &sst::TimeEvolution::attach_trajectory, py::arg("writer"),
+				 R"pbdoc(Record frames to a TrajectoryWriter during evolve() (None detaches). Writes the current state first.)pbdoc")
+			.def("get_time", &sst::TimeEvolution::get_time)
+			.def("get_positions",
+				 [](const sst::TimeEvolution& self) { return sst::vec3_array(self.get_positions()); },
+				 R"pbdoc(Current positions as an (N,3) array (a snapshot of the state).)pbdoc")
+			.def("get_tangents",
+				 [](const sst::TimeEvolution& self) { return sst::vec3_array(self.get_tangents()); },
+				 R"pbdoc(Current tangents as an (N,3) array.)pbdoc");
 
 }
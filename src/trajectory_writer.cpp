@@ -0,0 +1,280 @@
+#include "trajectory_writer.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace sst {
+
+namespace {
+
+constexpr std::size_t kDiagnostics = 5;
+constexpr char kMagic[] = "\x93NUMPY";
+
+std::string shape_dict(const std::string& descr, const std::string& frames) {
+    return "{'descr': " + descr + ", 'fortran_order': False, 'shape': (" + frames + ",), }";
+}
+
+} // namespace
+
+std::vector<std::string> TrajectoryWriter::diagnostic_names() {
+    return {"length", "centroid_x", "centroid_y", "centroid_z", "radius_of_gyration"};
+}
+
+TrajectoryWriter::TrajectoryWriter(const std::string& path, std::size_t num_points, const TrajectoryOptions& options)
+        : path_(path), num_points_(num_points), options_(options) {
+    if (num_points_ == 0) {
+        throw std::invalid_argument("TrajectoryWriter: num_points must be positive");
+    }
+    if (options_.every == 0) {
+        throw std::invalid_argument("TrajectoryWriter: every must be >= 1");
+    }
+    options_.chunk_frames = std::max<std::size_t>(options_.chunk_frames, 1);
+    options_.max_pending_chunks = std::max<std::size_t>(options_.max_pending_chunks, 1);
+
+    const std::string f8 = std::endian::native == std::endian::little ? "'<f8'" : "'>f8'";
+    const std::string n = std::to_string(num_points_);
+    descr_ = "[('time', " + f8 + "), ('dt', " + f8 + "), ('positions', " + f8 + ", (" + n + ", 3))";
+    record_doubles_ = 2 + 3 * num_points_;
+    if (options_.tangents) {
+        descr_ += ", ('tangents', " + f8 + ", (" + n + ", 3))";
+        record_doubles_ += 3 * num_points_;
+    }
+    if (options_.diagnostics) {
+        descr_ += ", ('diagnostics', " + f8 + ", (" + std::to_string(kDiagnostics) + ",))";
+        record_doubles_ += kDiagnostics;
+    }
+    descr_ += "]";
+
+    // Size the header for the widest possible frame count so it can be
+    // rewritten in place; magic(6) + version(2) + length(2) + dict + '\n'.
+    const std::size_t widest = shape_dict(descr_, std::to_string(SIZE_MAX)).size();
+    header_bytes_ = (10 + widest + 1 + 63) / 64 * 64;
+    if (header_bytes_ - 10 > 0xFFFF) {
+        throw std::invalid_argument("TrajectoryWriter: record description too long for a .npy header");
+    }
+
+    file_.open(path_, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!file_) {
+        throw std::runtime_error("TrajectoryWriter: cannot open '" + path_ + "' for writing");
+    }
+    write_header(0);
+    file_.flush();
+    if (!file_) {
+        throw std::runtime_error("TrajectoryWriter: failed writing header to '" + path_ + "'");
+    }
+    chunk_.reserve(options_.chunk_frames * record_doubles_);
+    open_ = true;
+    io_ = std::thread([this] { io_loop(); });
+}
+
+TrajectoryWriter::~TrajectoryWriter() {
+    try {
+        close();
+    } catch (...) {
+        // Destructors must not throw; call close() explicitly to see I/O errors.
+    }
+}
+
+void TrajectoryWriter::write_header(std::size_t frames) {
+    std::string dict = shape_dict(descr_, std::to_string(frames));
+    dict.append(header_bytes_ - 10 - dict.size() - 1, ' ');
+    dict.push_back('\n');
+    const auto len = static_cast<std::uint16_t>(header_bytes_ - 10);
+    const char prefix[10] = {kMagic[0], kMagic[1], kMagic[2], kMagic[3], kMagic[4], kMagic[5],
+                             1, 0, static_cast<char>(len & 0xFF), static_cast<char>(len >> 8)};
+    file_.seekp(0);
+    file_.write(prefix, sizeof(prefix));
+    file_.write(dict.data(), static_cast<std::streamsize>(dict.size()));
+}
+
+void TrajectoryWriter::compute_diagnostics(const double* p, double* out) const {
+    const std::size_t n = num_points_;
+    double length = 0.0, cx = 0.0, cy = 0.0, cz = 0.0;
+    const std::size_t segments = options_.closed ? n : n - 1;
+    for (std::size_t i = 0; i < segments; ++i) {
+        const double* a = p + 3 * i;
+        const double* b = p + 3 * ((i + 1) % n);
+        const double dx = b[0] - a[0], dy = b[1] - a[1], dz = b[2] - a[2];
+        length += std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        cx += p[3 * i];
+        cy += p[3 * i + 1];
+        cz += p[3 * i + 2];
+    }
+    cx /= static_cast<double>(n);
+    cy /= static_cast<double>(n);
+    cz /= static_cast<double>(n);
+    double rg2 = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double dx = p[3 * i] - cx, dy = p[3 * i + 1] - cy, dz = p[3 * i + 2] - cz;
+        rg2 += dx * dx + dy * dy + dz * dz;
+    }
+    out[0] = length;
+    out[1] = cx;
+    out[2] = cy;
+    out[3] = cz;
+    out[4] = std::sqrt(rg2 / static_cast<double>(n));
+}
+
+void TrajectoryWriter::io_loop() {
+    for (;;) {
+        std::pair<std::vector<double>, std::size_t> item;
+        std::size_t written = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_);
+            cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;  // stop requested and drained
+            }
+            item = std::move(queue_.front());
+            queue_.pop_front();
+            busy_ = true;
+            written = frames_written_;
+        }
+        std::exception_ptr err;
+        try {
+            auto& data = item.first;
+            if (options_.diagnostics) {
+                const std::size_t diag_at = record_doubles_ - kDiagnostics;
+                for (std::size_t f = 0; f < item.second; ++f) {
+                    double* rec = data.data() + f * record_doubles_;
+                    compute_diagnostics(rec + 2, rec + diag_at);
+                }
+            }
+            file_.seekp(static_cast<std::streamoff>(header_bytes_ + written * record_doubles_ * sizeof(double)));
+            file_.write(reinterpret_cast<const char*>(data.data()),
+                        static_cast<std::streamsize>(item.second * record_doubles_ * sizeof(double)));
+            write_header(written + item.second);
+            file_.flush();
+            if (!file_) {
+                throw std::runtime_error("TrajectoryWriter: write to '" + path_ + "' failed");
+            }
+        } catch (...) {
+            err = std::current_exception();
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_);
+            busy_ = false;
+            if (err) {
+                if (!error_) error_ = err;
+                queue_.clear();  // nothing after a failed chunk can land at the right offset
+            } else {
+                frames_written_ += item.second;
+            }
+        }
+        done_cv_.notify_all();
+    }
+}
+
+void TrajectoryWriter::rethrow_if_failed() {
+    std::lock_guard<std::mutex> lock(m_);
+    if (error_) {
+        std::rethrow_exception(error_);
+    }
+}
+
+void TrajectoryWriter::submit_chunk() {
+    if (chunk_count_ == 0) {
+        return;
+    }
+    std::vector<double> data;
+    data.reserve(options_.chunk_frames * record_doubles_);
+    data.swap(chunk_);
+    {
+        std::unique_lock<std::mutex> lock(m_);
+        done_cv_.wait(lock, [this] { return error_ || queue_.size() < options_.max_pending_chunks; });
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+        queue_.emplace_back(std::move(data), chunk_count_);
+    }
+    chunk_count_ = 0;
+    cv_.notify_one();
+}
+
+bool TrajectoryWriter::offer(double time, double dt, const std::vector<Vec3>& positions,
+                             const std::vector<Vec3>& tangents) {
+    if (++offered_ % options_.every != 0) {
+        return false;
+    }
+    record(time, dt, positions, tangents);
+    return true;
+}
+
+void TrajectoryWriter::record(double time, double dt, const std::vector<Vec3>& positions,
+                              const std::vector<Vec3>& tangents) {
+    if (!open_) {
+        throw std::runtime_error("TrajectoryWriter: '" + path_ + "' is closed");
+    }
+    if (positions.size() != num_points_) {
+        throw std::invalid_argument("TrajectoryWriter: frame has " + std::to_string(positions.size()) +
+                                    " points but the file was opened for " + std::to_string(num_points_));
+    }
+    if (options_.tangents && tangents.size() != num_points_) {
+        throw std::invalid_argument("TrajectoryWriter: tangents must have one entry per point");
+    }
+    rethrow_if_failed();
+
+    chunk_.push_back(time);
+    chunk_.push_back(dt);
+    for (const Vec3& p : positions) {
+        chunk_.insert(chunk_.end(), p.begin(), p.end());
+    }
+    if (options_.tangents) {
+        for (const Vec3& t : tangents) {
+            chunk_.insert(chunk_.end(), t.begin(), t.end());
+        }
+    }
+    if (options_.diagnostics) {
+        chunk_.insert(chunk_.end(), kDiagnostics, 0.0);  // filled on the I/O thread
+    }
+    ++frames_recorded_;
+    if (++chunk_count_ >= options_.chunk_frames) {
+        submit_chunk();
+    }
+}
+
+std::size_t TrajectoryWriter::frames_written() const {
+    std::lock_guard<std::mutex> lock(m_);
+    return frames_written_;
+}
+
+void TrajectoryWriter::flush() {
+    if (!open_) {
+        return;
+    }
+    submit_chunk();
+    std::unique_lock<std::mutex> lock(m_);
+    done_cv_.wait(lock, [this] { return error_ || (queue_.empty() && !busy_); });
+    if (error_) {
+        std::rethrow_exception(error_);
+    }
+}
+
+void TrajectoryWriter::close() {
+    if (!open_) {
+        return;
+    }
+    std::exception_ptr err;
+    try {
+        flush();
+    } catch (...) {
+        err = std::current_exception();
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+    io_.join();
+    file_.close();
+    open_ = false;
+    if (err) {
+        std::rethrow_exception(err);
+    }
+}
+
+} // namespace sst
@@ -0,0 +1,111 @@
+#ifndef SWIRL_STRING_CORE_TRAJECTORY_WRITER_H
+#define SWIRL_STRING_CORE_TRAJECTORY_WRITER_H
+
+#pragma once
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sst {
+
+using Vec3 = std::array<double, 3>;
+
+struct TrajectoryOptions {
+    std::size_t every = 1;               // record every k-th offered step
+    bool tangents = false;               // add a 'tangents' (N,3) field per frame
+    bool diagnostics = false;            // add a 'diagnostics' field (see diagnostic_names())
+    bool closed = true;                  // curve topology used by the diagnostics
+    std::size_t chunk_frames = 32;       // frames handed to the I/O thread per write
+    std::size_t max_pending_chunks = 4;  // back-pressure: record() blocks beyond this
+};
+
+/**
+ * @brief Append-only trajectory recorder writing a .npy file from a
+ * background I/O thread.
+ *
+ * The file holds a 1-D array of records with the structured dtype
+ *   time f8, dt f8, positions f8 (N,3) [, tangents f8 (N,3)] [, diagnostics f8 (D,)]
+ * so np.load(path, mmap_mode="r")["positions"] is a zero-copy (F,N,3) view.
+ * The header is padded to a fixed size and its frame count is rewritten
+ * after every chunk and on close(), so a file cut short by a crash stays
+ * readable up to the last completed chunk.
+ *
+ * record() only copies the frame into the current chunk; diagnostics and
+ * all file I/O happen on the writer thread. I/O errors are rethrown from
+ * the next record(), flush() or close().
+ */
+class TrajectoryWriter {
+public:
+    TrajectoryWriter(const std::string& path, std::size_t num_points, const TrajectoryOptions& options = {});
+    ~TrajectoryWriter();
+
+    TrajectoryWriter(const TrajectoryWriter&) = delete;
+    TrajectoryWriter& operator=(const TrajectoryWriter&) = delete;
+
+    // Step hook for evolvers: records the every-th, 2*every-th, ... call.
+    // Returns true when this call produced a frame.
+    bool offer(double time, double dt, const std::vector<Vec3>& positions, const std::vector<Vec3>& tangents);
+
+    // Unconditionally append one frame. tangents may be empty when
+    // options.tangents is false.
+    void record(double time, double dt, const std::vector<Vec3>& positions, const std::vector<Vec3>& tangents = {});
+
+    // Block until every recorded frame is on disk and the header is current.
+    void flush();
+    // flush(), stop the I/O thread and close the file. Idempotent.
+    void close();
+
+    [[nodiscard]] bool is_open() const { return open_; }
+    [[nodiscard]] const std::string& path() const { return path_; }
+    [[nodiscard]] std::size_t num_points() const { return num_points_; }
+    [[nodiscard]] const TrajectoryOptions& options() const { return options_; }
+    [[nodiscard]] std::size_t frames_recorded() const { return frames_recorded_; }
+    [[nodiscard]] std::size_t frames_written() const;
+    // Doubles per record (time, dt, positions, tangents, diagnostics).
+    [[nodiscard]] std::size_t record_size() const { return record_doubles_; }
+
+    // Columns of the 'diagnostics' field: length, centroid x/y/z, radius of gyration.
+    static std::vector<std::string> diagnostic_names();
+
+private:
+    void io_loop();
+    void submit_chunk();  // caller holds no lock
+    void write_header(std::size_t frames);
+    void compute_diagnostics(const double* positions, double* out) const;
+    void rethrow_if_failed();
+
+    std::string path_;
+    std::size_t num_points_;
+    TrajectoryOptions options_;
+    std::size_t record_doubles_ = 0;
+    std::size_t header_bytes_ = 0;
+    std::string descr_;
+
+    std::ofstream file_;
+    bool open_ = false;
+    std::size_t offered_ = 0;
+    std::size_t frames_recorded_ = 0;
+    std::vector<double> chunk_;  // frames being filled by the producer
+    std::size_t chunk_count_ = 0;
+
+    mutable std::mutex m_;
+    std::condition_variable cv_;       // wakes the I/O thread
+    std::condition_variable done_cv_;  // wakes producers waiting on space/flush
+    std::deque<std::pair<std::vector<double>, std::size_t>> queue_;  // (data, frames)
+    bool busy_ = false;
+    bool stop_ = false;
+    std::size_t frames_written_ = 0;
+    std::exception_ptr error_;
+    std::thread io_;
+};
+
+} // namespace sst
+
+#endif // SWIRL_STRING_CORE_TRAJECTORY_WRITER_H
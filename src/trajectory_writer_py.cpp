@@ -0,0 +1,58 @@
+// src/trajectory_writer_py.cpp
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include "trajectory_writer.h"
+
+namespace py = pybind11;
+
+void bind_trajectory_writer(py::module_& m) {
+    py::class_<sst::TrajectoryWriter, std::shared_ptr<sst::TrajectoryWriter>>(m, "TrajectoryWriter", R"pbdoc(
+Append-only .npy trajectory recorder with a background I/O thread.
+
+Attach it to VortexKnotSystem or TimeEvolution with attach_trajectory(); every
+`every`-th integrator step is then copied natively into a chunk and written
+without touching Python. Read the file back without copies:
+
+    traj = np.load(path, mmap_mode="r")
+    traj["positions"]    # (frames, N, 3)
+    traj["time"], traj["dt"], traj["tangents"], traj["diagnostics"]
+
+The header's frame count is updated after every chunk, so the file is
+readable while the run is in progress (up to the last completed chunk).
+)pbdoc")
+        .def(py::init([](const std::string& path, std::size_t num_points, std::size_t every, bool tangents,
+                         bool diagnostics, bool closed, std::size_t chunk_frames, std::size_t max_pending_chunks) {
+                 sst::TrajectoryOptions o;
+                 o.every = every;
+                 o.tangents = tangents;
+                 o.diagnostics = diagnostics;
+                 o.closed = closed;
+                 o.chunk_frames = chunk_frames;
+                 o.max_pending_chunks = max_pending_chunks;
+                 return std::make_shared<sst::TrajectoryWriter>(path, num_points, o);
+             }),
+             py::arg("path"), py::arg("num_points"), py::arg("every") = 1, py::arg("tangents") = false,
+             py::arg("diagnostics") = false, py::arg("closed") = true, py::arg("chunk_frames") = 32,
+             py::arg("max_pending_chunks") = 4)
+        .def("record", &sst::TrajectoryWriter::record,
+             py::arg("time"), py::arg("dt"), py::arg("positions"),
+             py::arg("tangents") = std::vector<sst::Vec3>{}, py::call_guard<py::gil_scoped_release>(),
+             R"pbdoc(Append one frame (positions (N,3); tangents required when the writer records them).)pbdoc")
+        .def("flush", &sst::TrajectoryWriter::flush, py::call_guard<py::gil_scoped_release>(),
+             R"pbdoc(Block until every recorded frame is on disk.)pbdoc")
+        .def("close", &sst::TrajectoryWriter::close, py::call_guard<py::gil_scoped_release>(),
+             R"pbdoc(Flush, stop the I/O thread and close the file.)pbdoc")
+        .def("__enter__", [](std::shared_ptr<sst::TrajectoryWriter> self) { return self; })
+        .def("__exit__", [](sst::TrajectoryWriter& self, py::object, py::object, py::object) {
+            py::gil_scoped_release release;
+            self.close();
+            return false;
+        })
+        .def_property_readonly("is_open", &sst::TrajectoryWriter::is_open)
+        .def_property_readonly("path", &sst::TrajectoryWriter::path)
+        .def_property_readonly("num_points", &sst::TrajectoryWriter::num_points)
+        .def_property_readonly("frames_recorded", &sst::TrajectoryWriter::frames_recorded)
+        .def_property_readonly("frames_written", &sst::TrajectoryWriter::frames_written)
+        .def_static("diagnostic_names", &sst::TrajectoryWriter::diagnostic_names,
+                    R"pbdoc(Column names of the 'diagnostics' field.)pbdoc");
+}
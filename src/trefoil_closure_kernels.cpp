@@ -1,7 +1,13 @@
 // Port of trefoil_closure/sst_core.cpp geometry kernels (keep numerics in sync).
+// Built without fast-math (see CMakeLists.txt) so the pair sums keep IEEE order:
+// the fused and individual entry points must agree bit for bit.
 #include "trefoil_closure_kernels.h"
+#include "cell_list.h"
+#include "profiler.h"
+#include "thread_pool.h"
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -9,58 +15,404 @@
 
 namespace sst {
 
-double trefoil_neumann_self_energy(const double* r, std::size_t n, double rc) {
-    if (n < 2) {
-        return 0.0;
-    }
-    double integral_val = 0.0;
+namespace {
+
+enum PairTerm : unsigned {
+    kNeumann = 1u,
+    kRepulsion = 2u,
+    kWrithe = 4u,
+};
+
+constexpr std::size_t kSerialRows = 256;  // below this the pool costs more than it saves
+constexpr std::size_t kRowGrain = 8;      // rows per scheduled chunk
+constexpr std::size_t kColumnTile = 512;  // j-tile: vertices + edges stay resident in L2
+
+// x^12 by repeated squaring (x^2, x^4, x^8, x^8 * x^4): four multiplies instead of pow().
+inline double pow12(double x) {
+    const double x2 = x * x;
+    const double x4 = x2 * x2;
+    const double x8 = x4 * x4;
+    return x8 * x4;
+}
+
+// Core repulsion only keeps ratio = 2 rc / d > 0.1, i.e. d < 20 rc. Cells are
+// padded slightly so rounding in the binning can never drop a kept pair.
+constexpr double kRepulsionCutoffFactor = 20.0;
+constexpr double kCellPadding = 1.001;
+constexpr std::size_t kCellListMinPoints = 64;
+
+struct PairRowSums {
+    std::vector<double> neumann;
+    std::vector<double> repulsion;
+    std::vector<double> writhe;
+};
+
+// Edge vectors e_i = r_{i+1} - r_i of the closed polyline, row-major.
+std::vector<double> closed_edges(const double* r, std::size_t n) {
+    std::vector<double> edges(n * 3);
     for (std::size_t i = 0; i < n; ++i) {
         const std::size_t next_i = (i + 1) % n;
-        const double dx1 = r[next_i * 3 + 0] - r[i * 3 + 0];
-        const double dy1 = r[next_i * 3 + 1] - r[i * 3 + 1];
-        const double dz1 = r[next_i * 3 + 2] - r[i * 3 + 2];
-        for (std::size_t j = i + 1; j < n; ++j) {
-            const std::size_t next_j = (j + 1) % n;
-            const double dx2 = r[next_j * 3 + 0] - r[j * 3 + 0];
-            const double dy2 = r[next_j * 3 + 1] - r[j * 3 + 1];
-            const double dz2 = r[next_j * 3 + 2] - r[j * 3 + 2];
-            const double rx = r[j * 3 + 0] - r[i * 3 + 0];
-            const double ry = r[j * 3 + 1] - r[i * 3 + 1];
-            const double rz = r[j * 3 + 2] - r[i * 3 + 2];
-            const double dist2 = rx * rx + ry * ry + rz * rz;
-            const double reg_dist = std::sqrt(dist2 + rc * rc);
-            const double dot_product = dx1 * dx2 + dy1 * dy2 + dz1 * dz2;
-            integral_val += 2.0 * (dot_product / reg_dist);
+        edges[i * 3 + 0] = r[next_i * 3 + 0] - r[i * 3 + 0];
+        edges[i * 3 + 1] = r[next_i * 3 + 1] - r[i * 3 + 1];
+        edges[i * 3 + 2] = r[next_i * 3 + 2] - r[i * 3 + 2];
+    }
+    return edges;
+}
+
+// Rows [i0, i1) of the i<j pair sums. The j range is walked in tiles shared by
+// the whole row block, but every row still accumulates its pairs in ascending
+// j, so a row's partial never depends on tiling or on the thread that ran it.
+void pair_rows(const double* r, const double* e, std::size_t n, double rc, unsigned terms,
+               std::size_t i0, std::size_t i1, PairRowSums& out) {
+    const bool want_neumann = (terms & kNeumann) != 0;
+    const bool want_repulsion = (terms & kRepulsion) != 0;
+    const bool want_writhe = (terms & kWrithe) != 0;
+    const double core_diameter = 2.0 * rc;
+    for (std::size_t jt = i0 + 1; jt < n; jt += kColumnTile) {
+        const std::size_t jt_end = std::min(n, jt + kColumnTile);
+        for (std::size_t i = i0; i < i1 && i + 1 < jt_end; ++i) {
+            const double xi = r[i * 3 + 0];
+            const double yi = r[i * 3 + 1];
+            const double zi = r[i * 3 + 2];
+            double dx1 = 0.0, dy1 = 0.0, dz1 = 0.0;
+            if (e) {
+                dx1 = e[i * 3 + 0];
+                dy1 = e[i * 3 + 1];
+                dz1 = e[i * 3 + 2];
+            }
+            double neumann = want_neumann ? out.neumann[i] : 0.0;
+            double repulsion = want_repulsion ? out.repulsion[i] : 0.0;
+            double writhe = want_writhe ? out.writhe[i] : 0.0;
+            for (std::size_t j = std::max(jt, i + 1); j < jt_end; ++j) {
+                const double rx = r[j * 3 + 0] - xi;
+                const double ry = r[j * 3 + 1] - yi;
+                const double rz = r[j * 3 + 2] - zi;
+                const double dist2 = rx * rx + ry * ry + rz * rz;
+                if (want_neumann || want_writhe) {
+                    const double dx2 = e[j * 3 + 0];
+                    const double dy2 = e[j * 3 + 1];
+                    const double dz2 = e[j * 3 + 2];
+                    const double reg_dist = std::sqrt(dist2 + rc * rc);
+                    if (want_neumann) {
+                        const double dot_product = dx1 * dx2 + dy1 * dy2 + dz1 * dz2;
+                        neumann += 2.0 * (dot_product / reg_dist);
+                    }
+                    if (want_writhe) {
+                        const double cx = dy1 * dz2 - dz1 * dy2;
+                        const double cy = dz1 * dx2 - dx1 * dz2;
+                        const double cz = dx1 * dy2 - dy1 * dx2;
+                        const double triple_scalar = rx * cx + ry * cy + rz * cz;
+                        writhe += 2.0 * triple_scalar / (reg_dist * reg_dist * reg_dist);
+                    }
+                }
+                if (want_repulsion && j >= i + 2 && !(i == 0 && j == n - 1)) {
+                    double dist = std::sqrt(dist2);
+                    if (dist < 1e-30) {
+                        dist = 1e-30;
+                    }
+                    const double ratio = core_diameter / dist;
+                    if (ratio > 0.1) {
+                        repulsion += pow12(ratio);
+                    }
+                }
+            }
+            if (want_neumann) out.neumann[i] = neumann;
+            if (want_repulsion) out.repulsion[i] = repulsion;
+            if (want_writhe) out.writhe[i] = writhe;
         }
     }
-    return integral_val;
 }
 
-double trefoil_core_repulsion(const double* r, std::size_t n, double rc) {
-    if (n < 3) {
-        return 0.0;
+// Per-row partial sums for the requested terms (rows reduced by the caller).
+PairRowSums pair_traversal(const double* r, std::size_t n, double rc, unsigned terms) {
+    PairRowSums rows;
+    if (terms & kNeumann) rows.neumann.assign(n, 0.0);
+    if (terms & kRepulsion) rows.repulsion.assign(n, 0.0);
+    if (terms & kWrithe) rows.writhe.assign(n, 0.0);
+
+    std::vector<double> edges;
+    if (terms & (kNeumann | kWrithe)) {
+        edges = closed_edges(r, n);
+    }
+    const double* e = edges.empty() ? nullptr : edges.data();
+
+    if (n < kSerialRows) {
+        pair_rows(r, e, n, rc, terms, 0, n, rows);
+    } else {
+        parallel_for(0, n, kRowGrain, [&](std::size_t lo, std::size_t hi) {
+            pair_rows(r, e, n, rc, terms, lo, hi, rows);
+        });
     }
-    double U_rep = 0.0;
+    return rows;
+}
+
+// Builds a cell list for the repulsion cutoff when it prunes anything: the
+// curve must span more than one 3x3x3 block of cutoff-sized cells.
+bool build_repulsion_cells(const double* r, std::size_t n, double rc, CellList& cells) {
+    if (n < kCellListMinPoints || !(rc > 0.0)) {
+        return false;
+    }
+    if (!cells.build(r, n, kRepulsionCutoffFactor * rc * kCellPadding)) {
+        return false;
+    }
+    return cells.num_cells() > 27;
+}
+
+// Core-repulsion row partials from the cell list. Each row visits its
+// candidates in ascending j and pairs beyond the cutoff add nothing in the
+// all-pairs loop either, so the rows (and their sum) are bit-identical.
+std::vector<double> repulsion_rows_cells(const double* r, std::size_t n, double rc, const CellList& cells) {
+    std::vector<double> rows(n, 0.0);
     const double core_diameter = 2.0 * rc;
-    for (std::size_t i = 0; i < n; ++i) {
-        for (std::size_t j = i + 2; j < n; ++j) {
-            if (i == 0 && j == n - 1) {
-                continue;
+    auto body = [&](std::size_t lo, std::size_t hi) {
+        std::vector<std::size_t> cand;
+        for (std::size_t i = lo; i < hi; ++i) {
+            const double xi = r[i * 3 + 0];
+            const double yi = r[i * 3 + 1];
+            const double zi = r[i * 3 + 2];
+            cells.gather_sorted(r + i * 3, i + 2, cand);
+            double repulsion = 0.0;
+            for (std::size_t j : cand) {
+                if (i == 0 && j == n - 1) {
+                    continue;
+                }
+                const double rx = r[j * 3 + 0] - xi;
+                const double ry = r[j * 3 + 1] - yi;
+                const double rz = r[j * 3 + 2] - zi;
+                const double dist2 = rx * rx + ry * ry + rz * rz;
+                double dist = std::sqrt(dist2);
+                if (dist < 1e-30) {
+                    dist = 1e-30;
+                }
+                const double ratio = core_diameter / dist;
+                if (ratio > 0.1) {
+                    repulsion += pow12(ratio);
+                }
             }
-            const double rx = r[j * 3 + 0] - r[i * 3 + 0];
-            const double ry = r[j * 3 + 1] - r[i * 3 + 1];
-            const double rz = r[j * 3 + 2] - r[i * 3 + 2];
-            double dist = std::sqrt(rx * rx + ry * ry + rz * rz);
-            if (dist < 1e-30) {
-                dist = 1e-30;
+            rows[i] = repulsion;
+        }
+    };
+    if (n < kSerialRows) {
+        body(0, n);
+    } else {
+        parallel_for(0, n, kRowGrain * 8, body);
+    }
+    return rows;
+}
+
+// Serial reduction in row order: the same sum for any thread count.
+double sum_rows(const std::vector<double>& rows) {
+    double total = 0.0;
+    for (double v : rows) {
+        total += v;
+    }
+    return total;
+}
+
+// ---- Analytic gradients ----------------------------------------------------
+//
+// Every pair term f(r_i, r_j, e_i, e_j) is symmetric under i <-> j, so
+// E = sum_{i<j} f = 1/2 sum_{i!=j} f and
+//   dE/dr_k = P_k + G_{k-1} - G_k,
+//   P_k = sum_{j!=k} df_kj/dr_k   (point part),   G_k = sum_{j!=k} df_kj/de_k   (edge part).
+// Walking full rows lets each row own its P_i/G_i slots: no scatter, no
+// atomics, same result for any thread count. The energy is accumulated from
+// the j>i half of the same row in ascending j, i.e. exactly as pair_rows does.
+
+struct PairGradRows {
+    std::vector<double> neumann_point, neumann_edge;
+    std::vector<double> writhe_point, writhe_edge;
+    std::vector<double> repulsion_point;
+};
+
+inline bool repulsion_pair(std::size_t i, std::size_t j, std::size_t n) {
+    const std::size_t lo = std::min(i, j);
+    const std::size_t hi = std::max(i, j);
+    return hi >= lo + 2 && !(lo == 0 && hi == n - 1);
+}
+
+void pair_grad_rows(const double* r, const double* e, std::size_t n, double rc, unsigned terms,
+                    std::size_t i0, std::size_t i1, PairRowSums& sums, PairGradRows& g) {
+    const bool want_neumann = (terms & kNeumann) != 0;
+    const bool want_repulsion = (terms & kRepulsion) != 0;
+    const bool want_writhe = (terms & kWrithe) != 0;
+    const double core_diameter = 2.0 * rc;
+    for (std::size_t jt = 0; jt < n; jt += kColumnTile) {
+        const std::size_t jt_end = std::min(n, jt + kColumnTile);
+        for (std::size_t i = i0; i < i1; ++i) {
+            const double xi = r[i * 3 + 0];
+            const double yi = r[i * 3 + 1];
+            const double zi = r[i * 3 + 2];
+            const double dx1 = e[i * 3 + 0];
+            const double dy1 = e[i * 3 + 1];
+            const double dz1 = e[i * 3 + 2];
+            double neumann = want_neumann ? sums.neumann[i] : 0.0;
+            double repulsion = want_repulsion ? sums.repulsion[i] : 0.0;
+            double writhe = want_writhe ? sums.writhe[i] : 0.0;
+            double np[3] = {0.0, 0.0, 0.0}, ne[3] = {0.0, 0.0, 0.0};
+            double wp[3] = {0.0, 0.0, 0.0}, we[3] = {0.0, 0.0, 0.0};
+            double rp[3] = {0.0, 0.0, 0.0};
+            for (std::size_t j = jt; j < jt_end; ++j) {
+                if (j == i) {
+                    continue;
+                }
+                const bool upper = j > i;
+                const double rx = r[j * 3 + 0] - xi;
+                const double ry = r[j * 3 + 1] - yi;
+                const double rz = r[j * 3 + 2] - zi;
+                const double dist2 = rx * rx + ry * ry + rz * rz;
+                if (want_neumann || want_writhe) {
+                    const double dx2 = e[j * 3 + 0];
+                    const double dy2 = e[j * 3 + 1];
+                    const double dz2 = e[j * 3 + 2];
+                    const double reg_dist = std::sqrt(dist2 + rc * rc);
+                    const double inv_d = 1.0 / reg_dist;
+                    const double inv_d3 = inv_d * inv_d * inv_d;
+                    if (want_neumann) {
+                        const double dot_product = dx1 * dx2 + dy1 * dy2 + dz1 * dz2;
+                        if (upper) {
+                            neumann += 2.0 * (dot_product / reg_dist);
+                        }
+                        // f = 2 e_i.e_j / D: df/de_i = 2 e_j / D, -df/dd = 2 (e_i.e_j) d / D^3
+                        const double kp = 2.0 * dot_product * inv_d3;
+                        np[0] += kp * rx; np[1] += kp * ry; np[2] += kp * rz;
+                        ne[0] += 2.0 * dx2 * inv_d; ne[1] += 2.0 * dy2 * inv_d; ne[2] += 2.0 * dz2 * inv_d;
+                    }
+                    if (want_writhe) {
+                        const double cx = dy1 * dz2 - dz1 * dy2;
+                        const double cy = dz1 * dx2 - dx1 * dz2;
+                        const double cz = dx1 * dy2 - dy1 * dx2;
+                        const double triple_scalar = rx * cx + ry * cy + rz * cz;
+                        if (upper) {
+                            writhe += 2.0 * triple_scalar / (reg_dist * reg_dist * reg_dist);
+                        }
+                        // f = 2 d.(e_i x e_j) / D^3:
+                        //   -df/dd  = -2 (e_i x e_j) / D^3 + 6 T d / D^5
+                        //   df/de_i =  2 (e_j x d) / D^3
+                        const double k5 = 6.0 * triple_scalar * inv_d3 * inv_d * inv_d;
+                        wp[0] += k5 * rx - 2.0 * cx * inv_d3;
+                        wp[1] += k5 * ry - 2.0 * cy * inv_d3;
+                        wp[2] += k5 * rz - 2.0 * cz * inv_d3;
+                        we[0] += 2.0 * (dy2 * rz - dz2 * ry) * inv_d3;
+                        we[1] += 2.0 * (dz2 * rx - dx2 * rz) * inv_d3;
+                        we[2] += 2.0 * (dx2 * ry - dy2 * rx) * inv_d3;
+                    }
+                }
+                if (want_repulsion && repulsion_pair(i, j, n)) {
+                    double dist = std::sqrt(dist2);
+                    const bool clamped = dist < 1e-30;
+                    if (clamped) {
+                        dist = 1e-30;
+                    }
+                    const double ratio = core_diameter / dist;
+                    if (ratio > 0.1) {
+                        const double f = pow12(ratio);
+                        if (upper) {
+                            repulsion += f;
+                        }
+                        if (!clamped) {
+                            // f = (2rc/|d|)^12: -df/dd = 12 f d / |d|^2
+                            const double kp = 12.0 * f / dist2;
+                            rp[0] += kp * rx; rp[1] += kp * ry; rp[2] += kp * rz;
+                        }
+                    }
+                }
             }
-            const double ratio = core_diameter / dist;
-            if (ratio > 0.1) {
-                U_rep += std::pow(ratio, 12.0);
+            if (want_neumann) {
+                sums.neumann[i] = neumann;
+                for (int c = 0; c < 3; ++c) {
+                    g.neumann_point[i * 3 + c] += np[c];
+                    g.neumann_edge[i * 3 + c] += ne[c];
+                }
+            }
+            if (want_writhe) {
+                sums.writhe[i] = writhe;
+                for (int c = 0; c < 3; ++c) {
+                    g.writhe_point[i * 3 + c] += wp[c];
+                    g.writhe_edge[i * 3 + c] += we[c];
+                }
+            }
+            if (want_repulsion) {
+                sums.repulsion[i] = repulsion;
+                for (int c = 0; c < 3; ++c) {
+                    g.repulsion_point[i * 3 + c] += rp[c];
+                }
             }
         }
     }
-    return U_rep;
+}
+
+// Energies (row partials) and gradient parts for the requested terms.
+void pair_grad_traversal(const double* r, std::size_t n, double rc, unsigned terms,
+                         PairRowSums& sums, PairGradRows& g) {
+    if (terms & kNeumann) {
+        sums.neumann.assign(n, 0.0);
+        g.neumann_point.assign(n * 3, 0.0);
+        g.neumann_edge.assign(n * 3, 0.0);
+    }
+    if (terms & kWrithe) {
+        sums.writhe.assign(n, 0.0);
+        g.writhe_point.assign(n * 3, 0.0);
+        g.writhe_edge.assign(n * 3, 0.0);
+    }
+    if (terms & kRepulsion) {
+        sums.repulsion.assign(n, 0.0);
+        g.repulsion_point.assign(n * 3, 0.0);
+    }
+    const std::vector<double> edges = closed_edges(r, n);
+    if (n < kSerialRows) {
+        pair_grad_rows(r, edges.data(), n, rc, terms, 0, n, sums, g);
+    } else {
+        parallel_for(0, n, kRowGrain, [&](std::size_t lo, std::size_t hi) {
+            pair_grad_rows(r, edges.data(), n, rc, terms, lo, hi, sums, g);
+        });
+    }
+}
+
+// grad_k = scale * (P_k + G_{k-1} - G_k); edge_part may be empty (point-only term).
+void assemble_grad(const std::vector<double>& point_part, const std::vector<double>& edge_part,
+                   std::size_t n, double scale, double* grad) {
+    for (std::size_t k = 0; k < n; ++k) {
+        const std::size_t prev = (k + n - 1) % n;
+        for (int c = 0; c < 3; ++c) {
+            double v = point_part[k * 3 + c];
+            if (!edge_part.empty()) {
+                v += edge_part[prev * 3 + c] - edge_part[k * 3 + c];
+            }
+            grad[k * 3 + c] = scale * v;
+        }
+    }
+}
+
+void zero_grad(double* grad, std::size_t n) {
+    std::fill(grad, grad + n * 3, 0.0);
+}
+
+}  // namespace
+
+double trefoil_neumann_self_energy(const double* r, std::size_t n, double rc) {
+    if (n < 2) {
+        return 0.0;
+    }
+    return sum_rows(pair_traversal(r, n, rc, kNeumann).neumann);
+}
+
+double trefoil_core_repulsion(const double* r, std::size_t n, double rc) {
+    if (n < 3) {
+        return 0.0;
+    }
+    CellList cells;
+    if (build_repulsion_cells(r, n, rc, cells)) {
+        return sum_rows(repulsion_rows_cells(r, n, rc, cells));
+    }
+    return sum_rows(pair_traversal(r, n, rc, kRepulsion).repulsion);
+}
+
+double trefoil_core_repulsion_reference(const double* r, std::size_t n, double rc) {
+    if (n < 3) {
+        return 0.0;
+    }
+    return sum_rows(pair_traversal(r, n, rc, kRepulsion).repulsion);
 }
 
 double trefoil_polyline_length(const double* r, std::size_t n) {
@@ -82,30 +434,7 @@ double trefoil_writhe_reg(const double* r, std::size_t n, double rc) {
     if (n < 2) {
         return 0.0;
     }
-    double writhe_val = 0.0;
-    for (std::size_t i = 0; i < n; ++i) {
-        const std::size_t next_i = (i + 1) % n;
-        const double dx1 = r[next_i * 3 + 0] - r[i * 3 + 0];
-        const double dy1 = r[next_i * 3 + 1] - r[i * 3 + 1];
-        const double dz1 = r[next_i * 3 + 2] - r[i * 3 + 2];
-        for (std::size_t j = i + 1; j < n; ++j) {
-            const std::size_t next_j = (j + 1) % n;
-            const double dx2 = r[next_j * 3 + 0] - r[j * 3 + 0];
-            const double dy2 = r[next_j * 3 + 1] - r[j * 3 + 1];
-            const double dz2 = r[next_j * 3 + 2] - r[j * 3 + 2];
-            const double rx = r[j * 3 + 0] - r[i * 3 + 0];
-            const double ry = r[j * 3 + 1] - r[i * 3 + 1];
-            const double rz = r[j * 3 + 2] - r[i * 3 + 2];
-            const double cx = dy1 * dz2 - dz1 * dy2;
-            const double cy = dz1 * dx2 - dx1 * dz2;
-            const double cz = dx1 * dy2 - dy1 * dx2;
-            const double triple_scalar = rx * cx + ry * cy + rz * cz;
-            const double dist2 = rx * rx + ry * ry + rz * rz;
-            const double dist_reg = std::sqrt(dist2 + rc * rc);
-            writhe_val += 2.0 * triple_scalar / (dist_reg * dist_reg * dist_reg);
-        }
-    }
-    return writhe_val / (4.0 * M_PI);
+    return sum_rows(pair_traversal(r, n, rc, kWrithe).writhe) / (4.0 * M_PI);
 }
 
 double trefoil_curvature_penalty_menger(const double* r, std::size_t n) {
@@ -142,4 +471,123 @@ double trefoil_curvature_penalty_menger(const double* r, std::size_t n) {
     return total_curvature_sq;
 }
 
+TrefoilClosureEnergies trefoil_closure_energies(const double* r, std::size_t n, double rc) {
+    SST_PROFILE_SCOPE_PAIRS("trefoil.closure_energies", n * (n - 1) / 2);
+    TrefoilClosureEnergies out;
+    if (n < 2) {
+        return out;
+    }
+    // Repulsion rides along in the pair pass unless the cell list can skip
+    // the far pairs; both paths produce identical row partials.
+    CellList cells;
+    const bool use_cells = n >= 3 && build_repulsion_cells(r, n, rc, cells);
+    const unsigned terms = kNeumann | kWrithe | (n >= 3 && !use_cells ? kRepulsion : 0u);
+    const PairRowSums rows = pair_traversal(r, n, rc, terms);
+    out.neumann_self_energy = sum_rows(rows.neumann);
+    if (use_cells) {
+        out.core_repulsion = sum_rows(repulsion_rows_cells(r, n, rc, cells));
+    } else {
+        out.core_repulsion = (n >= 3) ? sum_rows(rows.repulsion) : 0.0;
+    }
+    out.writhe_reg = sum_rows(rows.writhe) / (4.0 * M_PI);
+    out.polyline_length = trefoil_polyline_length(r, n);
+    out.curvature_penalty_menger = trefoil_curvature_penalty_menger(r, n);
+    return out;
+}
+
+double trefoil_neumann_self_energy_grad(const double* r, std::size_t n, double rc, double* grad) {
+    if (n < 2) {
+        zero_grad(grad, n);
+        return 0.0;
+    }
+    PairRowSums sums;
+    PairGradRows g;
+    pair_grad_traversal(r, n, rc, kNeumann, sums, g);
+    assemble_grad(g.neumann_point, g.neumann_edge, n, 1.0, grad);
+    return sum_rows(sums.neumann);
+}
+
+double trefoil_core_repulsion_grad(const double* r, std::size_t n, double rc, double* grad) {
+    if (n < 3) {
+        zero_grad(grad, n);
+        return 0.0;
+    }
+    PairRowSums sums;
+    PairGradRows g;
+    pair_grad_traversal(r, n, rc, kRepulsion, sums, g);
+    assemble_grad(g.repulsion_point, {}, n, 1.0, grad);
+    return sum_rows(sums.repulsion);
+}
+
+double trefoil_writhe_reg_grad(const double* r, std::size_t n, double rc, double* grad) {
+    if (n < 2) {
+        zero_grad(grad, n);
+        return 0.0;
+    }
+    PairRowSums sums;
+    PairGradRows g;
+    pair_grad_traversal(r, n, rc, kWrithe, sums, g);
+    assemble_grad(g.writhe_point, g.writhe_edge, n, 1.0 / (4.0 * M_PI), grad);
+    return sum_rows(sums.writhe) / (4.0 * M_PI);
+}
+
+double trefoil_polyline_length_grad(const double* r, std::size_t n, double* grad) {
+    if (n < 2) {
+        zero_grad(grad, n);
+        return 0.0;
+    }
+    // dL/dr_k = t_{k-1} - t_k with unit edge tangents t_i = e_i / |e_i|.
+    const std::vector<double> edges = closed_edges(r, n);
+    std::vector<double> unit(n * 3, 0.0);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double len = std::sqrt(edges[i * 3 + 0] * edges[i * 3 + 0] +
+                                     edges[i * 3 + 1] * edges[i * 3 + 1] +
+                                     edges[i * 3 + 2] * edges[i * 3 + 2]);
+        if (len > 0.0) {
+            for (int c = 0; c < 3; ++c) {
+                unit[i * 3 + c] = edges[i * 3 + c] / len;
+            }
+        }
+    }
+    std::vector<double> no_point(n * 3, 0.0);
+    assemble_grad(no_point, unit, n, 1.0, grad);
+    return trefoil_polyline_length(r, n);
+}
+
+TrefoilClosureEnergies trefoil_closure_energies_grad(const double* r, std::size_t n, double rc,
+                                                     const TrefoilClosureGradients& grads) {
+    SST_PROFILE_SCOPE_PAIRS("trefoil.closure_energies_grad", n * (n - 1) / 2);
+    TrefoilClosureEnergies out;
+    if (n < 2) {
+        for (double* g : {grads.neumann, grads.core_repulsion, grads.writhe, grads.length}) {
+            if (g) zero_grad(g, n);
+        }
+        return out;
+    }
+    const unsigned terms = kNeumann | kWrithe | (n >= 3 ? kRepulsion : 0u);
+    PairRowSums sums;
+    PairGradRows g;
+    pair_grad_traversal(r, n, rc, terms, sums, g);
+
+    out.neumann_self_energy = sum_rows(sums.neumann);
+    out.writhe_reg = sum_rows(sums.writhe) / (4.0 * M_PI);
+    out.core_repulsion = (n >= 3) ? sum_rows(sums.repulsion) : 0.0;
+    out.curvature_penalty_menger = trefoil_curvature_penalty_menger(r, n);
+    if (grads.neumann) assemble_grad(g.neumann_point, g.neumann_edge, n, 1.0, grads.neumann);
+    if (grads.writhe) assemble_grad(g.writhe_point, g.writhe_edge, n, 1.0 / (4.0 * M_PI), grads.writhe);
+    if (grads.core_repulsion) {
+        if (n >= 3) {
+            assemble_grad(g.repulsion_point, {}, n, 1.0, grads.core_repulsion);
+        } else {
+            zero_grad(grads.core_repulsion, n);
+        }
+    }
+    if (grads.length) {
+        out.polyline_length = trefoil_polyline_length_grad(r, n, grads.length);
+    } else {
+        out.polyline_length = trefoil_polyline_length(r, n);
+    }
+    return out;
+}
+
 }  // namespace sst
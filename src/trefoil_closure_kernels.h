@@ -7,9 +7,49 @@ namespace sst {
 
 // r points to n*3 doubles, row-major (vertex i at r[i*3 + c]).
 double trefoil_neumann_self_energy(const double* r, std::size_t n, double rc);
+// Only pairs closer than 20 rc contribute; large curves are binned into a
+// cell list so far pairs are never visited. The result is bit-identical to
+// trefoil_core_repulsion_reference (all pairs), which is kept for validation.
 double trefoil_core_repulsion(const double* r, std::size_t n, double rc);
+double trefoil_core_repulsion_reference(const double* r, std::size_t n, double rc);
 double trefoil_polyline_length(const double* r, std::size_t n);
 double trefoil_writhe_reg(const double* r, std::size_t n, double rc);
 double trefoil_curvature_penalty_menger(const double* r, std::size_t n);
 
+// All closure terms from one pass over the vertex pairs.
+struct TrefoilClosureEnergies {
+    double neumann_self_energy = 0.0;
+    double core_repulsion = 0.0;
+    double writhe_reg = 0.0;
+    double polyline_length = 0.0;
+    double curvature_penalty_menger = 0.0;
+};
+
+// Fused evaluation: one parallel, cache-blocked traversal of the i<j pairs
+// feeds Neumann, core repulsion and writhe together. Each field is
+// bit-identical to the matching trefoil_* function (same per-pair arithmetic,
+// per-row partials reduced in row order), independent of the thread count.
+TrefoilClosureEnergies trefoil_closure_energies(const double* r, std::size_t n, double rc);
+
+// Analytic gradients dE/dr_i, written to grad (n*3 doubles, row-major). The
+// returned energy is bit-identical to the value-only function; the gradient
+// comes from the same pair traversal at O(n^2) total cost. The repulsion cutoff
+// (ratio > 0.1) is treated as a hard switch (its jump is not differentiated).
+double trefoil_neumann_self_energy_grad(const double* r, std::size_t n, double rc, double* grad);
+double trefoil_core_repulsion_grad(const double* r, std::size_t n, double rc, double* grad);
+double trefoil_writhe_reg_grad(const double* r, std::size_t n, double rc, double* grad);
+double trefoil_polyline_length_grad(const double* r, std::size_t n, double* grad);
+
+// Output buffers (n*3 doubles each) for the fused gradient; null skips a term.
+struct TrefoilClosureGradients {
+    double* neumann = nullptr;
+    double* core_repulsion = nullptr;
+    double* writhe = nullptr;
+    double* length = nullptr;
+};
+
+// All energies plus the requested gradients from one traversal.
+TrefoilClosureEnergies trefoil_closure_energies_grad(const double* r, std::size_t n, double rc,
+                                                     const TrefoilClosureGradients& grads);
+
 }  // namespace sst
@@ -0,0 +1,316 @@
+// Incremental closure energies (see trefoil_closure_state.h).
+#include "trefoil_closure_state.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace sst {
+
+namespace {
+
+// Pair terms, same arithmetic as trefoil_closure_kernels.cpp. Each is
+// symmetric under (i, e_i) <-> (j, e_j).
+inline double neumann_pair(const double* ri, const double* ei, const double* rj, const double* ej, double rc) {
+    const double rx = rj[0] - ri[0];
+    const double ry = rj[1] - ri[1];
+    const double rz = rj[2] - ri[2];
+    const double dist2 = rx * rx + ry * ry + rz * rz;
+    const double reg_dist = std::sqrt(dist2 + rc * rc);
+    const double dot_product = ei[0] * ej[0] + ei[1] * ej[1] + ei[2] * ej[2];
+    return 2.0 * (dot_product / reg_dist);
+}
+
+// Without the 1/(4 pi) normalization.
+inline double writhe_pair(const double* ri, const double* ei, const double* rj, const double* ej, double rc) {
+    const double rx = rj[0] - ri[0];
+    const double ry = rj[1] - ri[1];
+    const double rz = rj[2] - ri[2];
+    const double cx = ei[1] * ej[2] - ei[2] * ej[1];
+    const double cy = ei[2] * ej[0] - ei[0] * ej[2];
+    const double cz = ei[0] * ej[1] - ei[1] * ej[0];
+    const double triple_scalar = rx * cx + ry * cy + rz * cz;
+    const double dist2 = rx * rx + ry * ry + rz * rz;
+    const double dist_reg = std::sqrt(dist2 + rc * rc);
+    return 2.0 * triple_scalar / (dist_reg * dist_reg * dist_reg);
+}
+
+inline double repulsion_pair(const double* ri, const double* rj, double rc) {
+    const double rx = rj[0] - ri[0];
+    const double ry = rj[1] - ri[1];
+    const double rz = rj[2] - ri[2];
+    double dist = std::sqrt(rx * rx + ry * ry + rz * rz);
+    if (dist < 1e-30) {
+        dist = 1e-30;
+    }
+    const double ratio = (2.0 * rc) / dist;
+    if (!(ratio > 0.1)) {
+        return 0.0;
+    }
+    const double r2 = ratio * ratio;
+    const double r4 = r2 * r2;
+    return (r4 * r4) * r4;
+}
+
+// Pairs the core repulsion kernel counts: not neighbours along the closed curve.
+inline bool repulsion_counts(std::size_t i, std::size_t j, std::size_t n) {
+    const std::size_t lo = std::min(i, j);
+    const std::size_t hi = std::max(i, j);
+    return hi >= lo + 2 && !(lo == 0 && hi == n - 1);
+}
+
+inline double edge_length(const double* e) {
+    return std::sqrt(e[0] * e[0] + e[1] * e[1] + e[2] * e[2]);
+}
+
+// Menger curvature contribution kappa_i^2 ds_i of vertex i.
+double menger_term(const double* r, std::size_t n, std::size_t i) {
+    const std::size_t prev = (i + n - 1) % n;
+    const std::size_t next = (i + 1) % n;
+    const double v1x = r[i * 3 + 0] - r[prev * 3 + 0];
+    const double v1y = r[i * 3 + 1] - r[prev * 3 + 1];
+    const double v1z = r[i * 3 + 2] - r[prev * 3 + 2];
+    const double v2x = r[next * 3 + 0] - r[i * 3 + 0];
+    const double v2y = r[next * 3 + 1] - r[i * 3 + 1];
+    const double v2z = r[next * 3 + 2] - r[i * 3 + 2];
+    const double v3x = r[next * 3 + 0] - r[prev * 3 + 0];
+    const double v3y = r[next * 3 + 1] - r[prev * 3 + 1];
+    const double v3z = r[next * 3 + 2] - r[prev * 3 + 2];
+    const double cx = v1y * v2z - v1z * v2y;
+    const double cy = v1z * v2x - v1x * v2z;
+    const double cz = v1x * v2y - v1y * v2x;
+    const double cross_norm = std::sqrt(cx * cx + cy * cy + cz * cz);
+    const double v1_norm = std::sqrt(v1x * v1x + v1y * v1y + v1z * v1z);
+    const double v2_norm = std::sqrt(v2x * v2x + v2y * v2y + v2z * v2z);
+    const double v3_norm = std::sqrt(v3x * v3x + v3y * v3y + v3z * v3z);
+    double kappa = 0.0;
+    if (v1_norm > 1e-20 && v2_norm > 1e-20 && v3_norm > 1e-20) {
+        kappa = (2.0 * cross_norm) / (v1_norm * v2_norm * v3_norm);
+    }
+    const double ds = (v1_norm + v2_norm) / 2.0;
+    return kappa * kappa * ds;
+}
+
+void set_edge(const std::vector<double>& r, std::size_t n, std::size_t i, std::vector<double>& e) {
+    const std::size_t next = (i + 1) % n;
+    e[i * 3 + 0] = r[next * 3 + 0] - r[i * 3 + 0];
+    e[i * 3 + 1] = r[next * 3 + 1] - r[i * 3 + 1];
+    e[i * 3 + 2] = r[next * 3 + 2] - r[i * 3 + 2];
+}
+
+constexpr double kInvFourPi = 1.0 / (4.0 * M_PI);
+
+}  // namespace
+
+ClosureEnergyState::ClosureEnergyState(const double* r, std::size_t n, double rc)
+    : n_(n), rc_(rc), r_(r, r + n * 3) {
+    if (n < 3) {
+        throw std::invalid_argument("ClosureEnergyState: need at least 3 vertices");
+    }
+    e_.resize(n * 3);
+    for (std::size_t i = 0; i < n; ++i) {
+        set_edge(r_, n_, i, e_);
+    }
+    trial_r_ = r_;
+    trial_e_ = e_;
+    partials_.assign(n * 3, 0.0);
+    partials_delta_.assign(n * 3, 0.0);
+    in_edge_set_.assign(n, 0);
+    in_point_set_.assign(n, 0);
+    resync();
+}
+
+void ClosureEnergyState::resync() {
+    if (pending_) {
+        reject();
+    }
+    energies_ = trefoil_closure_energies(r_.data(), n_, rc_);
+    const double* r = r_.data();
+    const double* e = e_.data();
+    parallel_for(0, n_, 16, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i) {
+            double neumann = 0.0, repulsion = 0.0, writhe = 0.0;
+            for (std::size_t j = 0; j < n_; ++j) {
+                if (j == i) {
+                    continue;
+                }
+                neumann += neumann_pair(r + i * 3, e + i * 3, r + j * 3, e + j * 3, rc_);
+                writhe += writhe_pair(r + i * 3, e + i * 3, r + j * 3, e + j * 3, rc_);
+                if (repulsion_counts(i, j, n_)) {
+                    repulsion += repulsion_pair(r + i * 3, r + j * 3, rc_);
+                }
+            }
+            partials_[i * 3 + 0] = neumann;
+            partials_[i * 3 + 1] = repulsion;
+            partials_[i * 3 + 2] = writhe * kInvFourPi;
+        }
+    });
+}
+
+std::size_t ClosureEnergyState::edge_set_size() const {
+    return std::min(count_ + 1, n_);
+}
+
+std::size_t ClosureEnergyState::edge_index(std::size_t k) const {
+    // Edges start_-1 .. start_+count_-1: e_{v-1} and e_v both move with r_v.
+    return (start_ + n_ - 1 + k) % n_;
+}
+
+TrefoilClosureEnergies ClosureEnergyState::propose_vertex(std::size_t index, double x, double y, double z) {
+    const double p[3] = {x, y, z};
+    return propose(index, p, 1);
+}
+
+TrefoilClosureEnergies ClosureEnergyState::propose(std::size_t start, const double* new_positions, std::size_t count) {
+    if (pending_) {
+        reject();
+    }
+    if (start >= n_) {
+        throw std::invalid_argument("ClosureEnergyState::propose: start index out of range");
+    }
+    if (count > n_) {
+        throw std::invalid_argument("ClosureEnergyState::propose: window longer than the curve");
+    }
+    start_ = start;
+    count_ = count;
+    delta_ = TrefoilClosureEnergies{};
+    pending_ = true;
+    if (count == 0) {
+        return delta_;
+    }
+    std::fill(partials_delta_.begin(), partials_delta_.end(), 0.0);
+
+    for (std::size_t k = 0; k < count_; ++k) {
+        const std::size_t v = (start_ + k) % n_;
+        trial_r_[v * 3 + 0] = new_positions[k * 3 + 0];
+        trial_r_[v * 3 + 1] = new_positions[k * 3 + 1];
+        trial_r_[v * 3 + 2] = new_positions[k * 3 + 2];
+        in_point_set_[v] = 1;
+    }
+    const std::size_t n_edges = edge_set_size();
+    for (std::size_t k = 0; k < n_edges; ++k) {
+        const std::size_t a = edge_index(k);
+        set_edge(trial_r_, n_, a, trial_e_);
+        in_edge_set_[a] = 1;
+    }
+
+    // Edge-indexed pair terms: every pair with at least one changed edge,
+    // pairs inside the set counted once (a < j).
+    double d_neumann = 0.0, d_writhe = 0.0, d_length = 0.0;
+    const double* r0 = r_.data();
+    const double* e0 = e_.data();
+    const double* r1 = trial_r_.data();
+    const double* e1 = trial_e_.data();
+    for (std::size_t k = 0; k < n_edges; ++k) {
+        const std::size_t a = edge_index(k);
+        for (std::size_t j = 0; j < n_; ++j) {
+            if (j == a || (in_edge_set_[j] && j < a)) {
+                continue;
+            }
+            const double dn = neumann_pair(r1 + a * 3, e1 + a * 3, r1 + j * 3, e1 + j * 3, rc_)
+                            - neumann_pair(r0 + a * 3, e0 + a * 3, r0 + j * 3, e0 + j * 3, rc_);
+            const double dw = (writhe_pair(r1 + a * 3, e1 + a * 3, r1 + j * 3, e1 + j * 3, rc_)
+                             - writhe_pair(r0 + a * 3, e0 + a * 3, r0 + j * 3, e0 + j * 3, rc_)) * kInvFourPi;
+            d_neumann += dn;
+            d_writhe += dw;
+            partials_delta_[a * 3 + 0] += dn;
+            partials_delta_[j * 3 + 0] += dn;
+            partials_delta_[a * 3 + 2] += dw;
+            partials_delta_[j * 3 + 2] += dw;
+        }
+        d_length += edge_length(e1 + a * 3) - edge_length(e0 + a * 3);
+    }
+
+    // Core repulsion depends on vertex positions only.
+    double d_repulsion = 0.0;
+    for (std::size_t k = 0; k < count_; ++k) {
+        const std::size_t p = (start_ + k) % n_;
+        for (std::size_t j = 0; j < n_; ++j) {
+            if (j == p || (in_point_set_[j] && j < p) || !repulsion_counts(p, j, n_)) {
+                continue;
+            }
+            const double dr = repulsion_pair(r1 + p * 3, r1 + j * 3, rc_)
+                            - repulsion_pair(r0 + p * 3, r0 + j * 3, rc_);
+            d_repulsion += dr;
+            partials_delta_[p * 3 + 1] += dr;
+            partials_delta_[j * 3 + 1] += dr;
+        }
+    }
+
+    // Menger curvature: moved vertices and their two outer neighbours.
+    double d_curvature = 0.0;
+    const std::size_t n_curv = std::min(count_ + 2, n_);
+    for (std::size_t k = 0; k < n_curv; ++k) {
+        const std::size_t v = (start_ + n_ - 1 + k) % n_;
+        d_curvature += menger_term(r1, n_, v) - menger_term(r0, n_, v);
+    }
+
+    delta_.neumann_self_energy = d_neumann;
+    delta_.core_repulsion = d_repulsion;
+    delta_.writhe_reg = d_writhe;
+    delta_.polyline_length = d_length;
+    delta_.curvature_penalty_menger = d_curvature;
+    return delta_;
+}
+
+void ClosureEnergyState::commit() {
+    if (!pending_) {
+        return;
+    }
+    for (std::size_t k = 0; k < count_; ++k) {
+        const std::size_t v = (start_ + k) % n_;
+        for (int c = 0; c < 3; ++c) r_[v * 3 + c] = trial_r_[v * 3 + c];
+    }
+    if (count_ > 0) {
+        for (std::size_t k = 0; k < edge_set_size(); ++k) {
+            const std::size_t a = edge_index(k);
+            for (int c = 0; c < 3; ++c) e_[a * 3 + c] = trial_e_[a * 3 + c];
+        }
+        for (std::size_t i = 0; i < partials_.size(); ++i) {
+            partials_[i] += partials_delta_[i];
+        }
+    }
+    energies_.neumann_self_energy += delta_.neumann_self_energy;
+    energies_.core_repulsion += delta_.core_repulsion;
+    energies_.writhe_reg += delta_.writhe_reg;
+    energies_.polyline_length += delta_.polyline_length;
+    energies_.curvature_penalty_menger += delta_.curvature_penalty_menger;
+    clear_pending();
+}
+
+void ClosureEnergyState::reject() {
+    if (!pending_) {
+        return;
+    }
+    for (std::size_t k = 0; k < count_; ++k) {
+        const std::size_t v = (start_ + k) % n_;
+        for (int c = 0; c < 3; ++c) trial_r_[v * 3 + c] = r_[v * 3 + c];
+    }
+    if (count_ > 0) {
+        for (std::size_t k = 0; k < edge_set_size(); ++k) {
+            const std::size_t a = edge_index(k);
+            for (int c = 0; c < 3; ++c) trial_e_[a * 3 + c] = e_[a * 3 + c];
+        }
+    }
+    clear_pending();
+}
+
+void ClosureEnergyState::clear_pending() {
+    for (std::size_t k = 0; k < count_; ++k) {
+        in_point_set_[(start_ + k) % n_] = 0;
+    }
+    if (count_ > 0) {
+        for (std::size_t k = 0; k < edge_set_size(); ++k) {
+            in_edge_set_[edge_index(k)] = 0;
+        }
+    }
+    pending_ = false;
+    count_ = 0;
+    delta_ = TrefoilClosureEnergies{};
+}
+
+}  // namespace sst
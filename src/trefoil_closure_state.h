@@ -0,0 +1,80 @@
+// Incremental closure energies for local Monte Carlo moves on a closed curve.
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "trefoil_closure_kernels.h"
+
+namespace sst {
+
+/**
+ * Holds a closed curve plus its closure energies and per-vertex pair sums, and
+ * prices a local move (one vertex or a short cyclic window) in O(window * n)
+ * instead of re-running the O(n^2) kernels.
+ *
+ * propose() replaces vertices [start, start + count) (cyclic) tentatively and
+ * returns the per-term energy change; commit() accepts it, reject() drops it.
+ * A new propose() implicitly rejects a pending one. Totals are updated by
+ * adding deltas, so call resync() now and then in long chains to re-anchor
+ * them on a full evaluation.
+ *
+ * Terms and conventions match trefoil_closure_energies(): Neumann, core
+ * repulsion, regularized writhe (already / 4 pi), polyline length, Menger
+ * curvature.
+ */
+class ClosureEnergyState {
+public:
+    // r: n*3 doubles, row-major.
+    ClosureEnergyState(const double* r, std::size_t n, double rc);
+
+    std::size_t size() const { return n_; }
+    double rc() const { return rc_; }
+
+    // Committed curve (n*3, row-major) and its energies.
+    const std::vector<double>& positions() const { return r_; }
+    const TrefoilClosureEnergies& energies() const { return energies_; }
+
+    // Per-vertex pair sums P_i = sum_{j != i} f_ij for Neumann, core repulsion
+    // and writhe, interleaved as n*3 [neumann, core_repulsion, writhe]. Each
+    // column sums to twice the matching energy. Useful to bias move selection.
+    const std::vector<double>& vertex_partials() const { return partials_; }
+
+    // Energy deltas (new - current) for moving `count` consecutive vertices
+    // starting at `start` to new_positions (count*3 doubles).
+    TrefoilClosureEnergies propose(std::size_t start, const double* new_positions, std::size_t count);
+    TrefoilClosureEnergies propose_vertex(std::size_t index, double x, double y, double z);
+
+    bool has_pending() const { return pending_; }
+    void commit();
+    void reject();
+
+    // Full O(n^2) recomputation of energies and partial sums (drops a pending move).
+    void resync();
+
+private:
+    // Indices whose edge e_i changes when [start_, start_ + count_) moves.
+    std::size_t edge_set_size() const;
+    std::size_t edge_index(std::size_t k) const;
+    void clear_pending();
+
+    std::size_t n_;
+    double rc_;
+    std::vector<double> r_;        // committed vertices
+    std::vector<double> e_;        // committed edges e_i = r_{i+1} - r_i
+    std::vector<double> trial_r_;  // == r_ except at moved vertices while pending
+    std::vector<double> trial_e_;
+    std::vector<double> partials_;
+    TrefoilClosureEnergies energies_;
+
+    // Pending move bookkeeping.
+    bool pending_ = false;
+    std::size_t start_ = 0;
+    std::size_t count_ = 0;
+    TrefoilClosureEnergies delta_;
+    std::vector<double> partials_delta_;  // n*3
+    std::vector<unsigned char> in_edge_set_;
+    std::vector<unsigned char> in_point_set_;
+};
+
+}  // namespace sst
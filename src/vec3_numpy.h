@@ -0,0 +1,116 @@
+// src/vec3_numpy.h
+//
+// Zero-copy bridge between (N,3) float64 NumPy arrays and Vec3 buffers for
+// the pybind11 layer. Include it in every *_py.cpp that binds a function
+// taking std::span<const Vec3>, before any m.def(), so the caster below is
+// the one pybind picks.
+
+#ifndef SWIRL_STRING_CORE_VEC3_NUMPY_H
+#define SWIRL_STRING_CORE_VEC3_NUMPY_H
+
+#pragma once
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace sst {
+using Vec3 = std::array<double, 3>;
+
+static_assert(sizeof(Vec3) == 3 * sizeof(double) && alignof(Vec3) == alignof(double),
+              "Vec3 must be three packed doubles to alias (N,3) float64 rows");
+
+using Vec3ArrayArg = pybind11::array_t<double, pybind11::array::c_style | pybind11::array::forcecast>;
+
+// View an (N,3) C-contiguous float64 array as Vec3 rows without copying.
+// The array must outlive the span. An empty 1-D array is accepted as N = 0.
+inline std::span<const Vec3> as_vec3_span(const Vec3ArrayArg& arr, const char* ctx) {
+    if (arr.ndim() == 1 && arr.shape(0) == 0) {
+        return {};
+    }
+    if (arr.ndim() != 2 || arr.shape(1) != 3) {
+        throw std::invalid_argument(std::string(ctx) + ": expected array with shape (N,3)");
+    }
+    return {reinterpret_cast<const Vec3*>(arr.data()), static_cast<std::size_t>(arr.shape(0))};
+}
+
+// (N,3) array that takes ownership of v: the buffer is moved to the heap and
+// freed by a capsule when the array is collected, so nothing is copied.
+inline pybind11::array_t<double> vec3_array(std::vector<Vec3> v) {
+    auto owned = std::make_unique<std::vector<Vec3>>(std::move(v));
+    const auto n = static_cast<pybind11::ssize_t>(owned->size());
+    const double* data = owned->empty() ? nullptr : owned->front().data();
+    pybind11::capsule base(owned.get(), [](void* p) { delete static_cast<std::vector<Vec3>*>(p); });
+    owned.release();
+    return pybind11::array_t<double>({n, static_cast<pybind11::ssize_t>(3)}, data, base);
+}
+
+// (N,) array owning v, as vec3_array().
+inline pybind11::array_t<double> scalar_array(std::vector<double> v) {
+    auto owned = std::make_unique<std::vector<double>>(std::move(v));
+    const auto n = static_cast<pybind11::ssize_t>(owned->size());
+    const double* data = owned->empty() ? nullptr : owned->data();
+    pybind11::capsule base(owned.get(), [](void* p) { delete static_cast<std::vector<double>*>(p); });
+    owned.release();
+    return pybind11::array_t<double>({n}, data, base);
+}
+
+} // namespace sst
+
+namespace pybind11::detail {
+
+// std::span<const Vec3> <- (N,3) float64 array.
+// A C-contiguous, aligned float64 (N,3) array is viewed in place. With
+// implicit conversion allowed, anything NumPy can turn into such an array
+// (lists of triples, float32, strided views) is converted once, in C, and the
+// temporary is kept alive for the duration of the call.
+template <>
+struct type_caster<std::span<const sst::Vec3>> {
+    PYBIND11_TYPE_CASTER(std::span<const sst::Vec3>, const_name("numpy.ndarray[numpy.float64[m, 3]]"));
+
+    bool load(handle src, bool convert) {
+        if (!convert && !sst::Vec3ArrayArg::check_(src)) {
+            return false;
+        }
+        auto arr = sst::Vec3ArrayArg::ensure(src);
+        if (!arr) {
+            return false;
+        }
+        if (arr.ndim() == 1 && arr.shape(0) == 0) {
+            keep_ = std::move(arr);
+            value = {};
+            return true;
+        }
+        if (arr.ndim() != 2 || arr.shape(1) != 3) {
+            return false;
+        }
+        if (reinterpret_cast<std::uintptr_t>(arr.data()) % alignof(sst::Vec3) != 0) {
+            if (!convert) {
+                return false;
+            }
+            sst::Vec3ArrayArg aligned({arr.shape(0), static_cast<ssize_t>(3)});
+            std::memcpy(aligned.mutable_data(), arr.data(), static_cast<std::size_t>(arr.size()) * sizeof(double));
+            arr = std::move(aligned);
+        }
+        value = sst::as_vec3_span(arr, "Vec3 array");
+        keep_ = std::move(arr);
+        return true;
+    }
+
+    static handle cast(std::span<const sst::Vec3> src, return_value_policy /*policy*/, handle /*parent*/) {
+        return sst::vec3_array(std::vector<sst::Vec3>(src.begin(), src.end())).release();
+    }
+
+private:
+    object keep_;
+};
+
+} // namespace pybind11::detail
+
+#endif // SWIRL_STRING_CORE_VEC3_NUMPY_H
@@ -26,6 +26,7 @@ void bind_vorticity_dynamics(py::module_& m) {
 
 	m.def("compute_vorticity", &sst::VorticityDynamics::compute_vorticity2D,
 		  "Compute 2D vorticity field", py::arg("u"), py::arg("v"), py::arg("nx"), py::arg("ny"), py::arg("dx"), py::arg("dy"),
+		  py::call_guard<py::gil_scoped_release>(),
 			"Vorticity tools for 2D flows");
 
 	m.def("rotating_frame_rhs", &sst::VorticityDynamics::rotating_frame_rhs,
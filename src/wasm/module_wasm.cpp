@@ -1,25 +1,318 @@
-// module_wasm.cpp - WebAssembly module entry point (stub)
-// This is a placeholder for Emscripten bindings
-// Full implementation requires Emscripten SDK and emscripten/bind.h
+// module_wasm.cpp - WebAssembly (Emscripten/embind) bindings
+//
+// Mirrors the Node.js export names where both exist. Vec3 arguments accept a
+// Vec3Buffer (rows already in wasm memory: read in place), a flat
+// Float64Array [x1, y1, z1, ...] or an array of [x, y, z] (copied into wasm
+// memory once). Results come back as Float64Arrays owned by JS; the
+// `*Into` variants write into a Vec3Buffer instead.
+//
+// Built with -msimd128 and, unless SST_WASM_THREADS=OFF, -pthread: then
+// computeVelocity (grid points), helicityFromFseries (through computeVelocity),
+// computeWrithe and writheGaussCurve (pair rows) fan out over shared_pool()
+// on the Emscripten pthread worker pool (the page must be cross-origin
+// isolated). The remaining exports are O(N) and run on the calling thread.
 
 #include <emscripten/bind.h>
+#include <emscripten/val.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "biot_savart.h"
+#include "frenet_helicity.h"
+#include "knot_dynamics.h"
+#include "thread_pool.h"
 
 using namespace emscripten;
+using sst::Vec3;
+
+namespace {
+
+    // (N,3) float64 rows living in wasm linear memory.
+    class Vec3Buffer {
+    public:
+        explicit Vec3Buffer(std::size_t n) : rows_(n, Vec3{0.0, 0.0, 0.0}) {}
+
+        std::size_t size() const { return rows_.size(); }
+        void resize(std::size_t n) { rows_.resize(n, Vec3{0.0, 0.0, 0.0}); }
+
+        // Float64Array aliasing the rows. It is detached when wasm memory grows
+        // or the buffer is resized, so fetch a fresh view after either.
+        val view() {
+            return val(typed_memory_view(rows_.size() * 3, reinterpret_cast<double*>(rows_.data())));
+        }
+
+        std::span<const Vec3> span() const { return rows_; }
+        std::vector<Vec3>& rows() { return rows_; }
+
+    private:
+        std::vector<Vec3> rows_;
+    };
 
-// Placeholder module - to be implemented with full Emscripten bindings
-EMSCRIPTEN_KEEPALIVE
-extern "C" {
-    // Placeholder exports
-    int swirl_string_core_wasm_version() {
-        return 1; // version 0.1.3
+    // Vec3 argument: a span over a Vec3Buffer, or over rows copied in once.
+    struct Vec3Arg {
+        std::vector<Vec3> storage;
+        std::span<const Vec3> view;
+    };
+
+    bool is_array(const val& v) {
+        return val::global("Array").call<bool>("isArray", v);
+    }
+
+    Vec3Arg vec3_arg(const val& v, const char* name) {
+        Vec3Arg arg;
+        if (v.instanceof(val::module_property("Vec3Buffer"))) {
+            arg.view = v.as<Vec3Buffer*>(allow_raw_pointers())->span();
+            return arg;
+        }
+        val flat = v;
+        if (is_array(v)) {
+            flat = v.call<val>("flat");
+        } else if (!val::global("ArrayBuffer").call<bool>("isView", v)) {
+            throw std::invalid_argument(std::string(name) + " must be a Vec3Buffer, Float64Array or array of [x, y, z]");
+        }
+        const std::size_t length = flat["length"].as<std::size_t>();
+        if (length % 3 != 0) {
+            throw std::invalid_argument(std::string(name) + ": array length must be multiple of 3");
+        }
+        arg.storage.resize(length / 3);
+        // TypedArray.prototype.set copies straight into wasm memory.
+        val(typed_memory_view(length, reinterpret_cast<double*>(arg.storage.data()))).call<void>("set", flat);
+        arg.view = arg.storage;
+        return arg;
+    }
+
+    std::vector<double> double_arg(const val& v) {
+        return convertJSArrayToNumberVector<double>(v);
+    }
+
+    std::array<int, 3> shape_arg(const val& v) {
+        if (!is_array(v) || v["length"].as<unsigned>() != 3) {
+            throw std::invalid_argument("shape must be [x, y, z]");
+        }
+        return {v[0].as<int>(), v[1].as<int>(), v[2].as<int>()};
+    }
+
+    val to_float64_array(std::span<const Vec3> rows) {
+        // new Float64Array(view) copies out of wasm memory.
+        return val::global("Float64Array").new_(
+            typed_memory_view(rows.size() * 3, reinterpret_cast<const double*>(rows.data())));
+    }
+
+    val to_float64_array(const std::vector<double>& values) {
+        return val::global("Float64Array").new_(typed_memory_view(values.size(), values.data()));
+    }
+
+    val invariants_to_js(const std::tuple<double, double, double>& invariants) {
+        val result = val::object();
+        result.set("hCharge", std::get<0>(invariants));
+        result.set("hMass", std::get<1>(invariants));
+        result.set("aMu", std::get<2>(invariants));
+        return result;
+    }
+
+    // Turn C++ exceptions into JS errors with their message (a bare wasm
+    // exception would only show a pointer).
+    template <class F>
+    auto js_guard(F&& f) -> decltype(f()) {
+        std::string message;
+        const char* type = "Error";
+        try {
+            return f();
+        } catch (const std::invalid_argument& e) {
+            message = e.what();
+            type = "TypeError";
+        } catch (const std::exception& e) {
+            message = e.what();
+        }
+        val::global(type).new_(message).throw_();
+    }
+
+    sst::FourierBlock largest_fseries_block(const std::string& text) {
+        auto blocks = sst::FourierKnot::parse_fseries_from_string(text);
+        const int idx = sst::FourierKnot::index_of_largest_block(blocks);
+        if (idx < 0) {
+            throw std::invalid_argument("no Fourier block found in .fseries text");
+        }
+        return blocks[idx];
+    }
+
+    // --- Biot-Savart ---
+
+    val compute_velocity(const val& curve, const val& grid) {
+        return js_guard([&]() {
+            Vec3Arg c = vec3_arg(curve, "curve");
+            Vec3Arg g = vec3_arg(grid, "grid_points");
+            return to_float64_array(sst::BiotSavart::computeVelocity(c.view, g.view));
+        });
+    }
+
+    void compute_velocity_into(const val& curve, const val& grid, Vec3Buffer& out) {
+        js_guard([&]() {
+            Vec3Arg c = vec3_arg(curve, "curve");
+            Vec3Arg g = vec3_arg(grid, "grid_points");
+            out.rows() = sst::BiotSavart::computeVelocity(c.view, g.view);
+        });
     }
-}
 
-// Note: Full WASM bindings should mirror the Node.js bindings structure
-// but use emscripten::val and emscripten::function instead of N-API
-// Example structure:
-// EMSCRIPTEN_BINDINGS(swirl_string_core) {
-//     function("computeVelocity", &BiotSavart::computeVelocity);
-//     // ... other bindings
-// }
+    val compute_vorticity(const val& velocity, const val& shape, double spacing) {
+        return js_guard([&]() {
+            Vec3Arg v = vec3_arg(velocity, "velocity");
+            return to_float64_array(sst::BiotSavart::computeVorticity(v.view, shape_arg(shape), spacing));
+        });
+    }
+
+    val extract_interior(const val& field, const val& shape, int margin) {
+        return js_guard([&]() {
+            Vec3Arg f = vec3_arg(field, "field");
+            return to_float64_array(sst::BiotSavart::extractInterior(f.view, shape_arg(shape), margin));
+        });
+    }
+
+    val compute_invariants(const val& v_sub, const val& w_sub, const val& r_sq) {
+        return js_guard([&]() {
+            Vec3Arg v = vec3_arg(v_sub, "v_sub");
+            Vec3Arg w = vec3_arg(w_sub, "w_sub");
+            return invariants_to_js(sst::BiotSavart::computeInvariants(v.view, w.view, double_arg(r_sq)));
+        });
+    }
+
+    // --- Fourier evaluation, writhe, helicity pipeline ---
+
+    // coeffs: flat rows [a_x, b_x, a_y, b_y, a_z, b_z] per harmonic n = 0, 1, ...
+    val evaluate_fourier_series(const val& coeffs, const val& t_vals) {
+        return js_guard([&]() {
+            std::vector<double> flat = double_arg(coeffs);
+            if (flat.size() % 6 != 0) {
+                throw std::invalid_argument("coeffs length must be a multiple of 6");
+            }
+            std::vector<std::array<double, 6>> rows(flat.size() / 6);
+            for (std::size_t n = 0; n < rows.size(); ++n) {
+                for (std::size_t k = 0; k < 6; ++k) rows[n][k] = flat[6 * n + k];
+            }
+            auto result = sst::KnotDynamics::evaluate_fourier_series(rows, double_arg(t_vals));
+            val out = val::object();
+            out.set("positions", to_float64_array(result.positions));
+            out.set("tangents", to_float64_array(result.tangents));
+            return out;
+        });
+    }
+
+    // Largest block of a .fseries text sampled at nsamples points (centred).
+    val evaluate_fseries(const std::string& text, int nsamples) {
+        return js_guard([&]() {
+            if (nsamples < 2) {
+                throw std::invalid_argument("nsamples must be >= 2");
+            }
+            sst::FourierBlock block = largest_fseries_block(text);
+            std::vector<double> s(nsamples);
+            for (int i = 0; i < nsamples; ++i) {
+                s[i] = 2.0 * M_PI * double(i) / double(nsamples - 1);
+            }
+            return to_float64_array(sst::FourierKnot::center_points(sst::FourierKnot::evaluate(block, s)));
+        });
+    }
+
+    double compute_writhe(const val& centerline) {
+        return js_guard([&]() {
+            Vec3Arg c = vec3_arg(centerline, "centerline");
+            return sst::KnotDynamics::compute_writhe(c.view);
+        });
+    }
+
+    double writhe_gauss_curve(const val& r, const val& r_t) {
+        return js_guard([&]() {
+            Vec3Arg p = vec3_arg(r, "r");
+            Vec3Arg t = vec3_arg(r_t, "r_t");
+            return sst::KnotDynamics::writhe_gauss_curve(
+                std::vector<Vec3>(p.view.begin(), p.view.end()), std::vector<Vec3>(t.view.begin(), t.view.end()));
+        });
+    }
+
+    val helicity_from_fseries(const std::string& text, int grid_size, double spacing, int interior_margin,
+                              int nsamples) {
+        return js_guard([&]() {
+            return invariants_to_js(sst::KnotDynamics::compute_helicity_from_fourier_block(
+                largest_fseries_block(text), grid_size, spacing, interior_margin, nsamples));
+        });
+    }
 
+    val helicity_from_fseries_default(const std::string& text) {
+        return helicity_from_fseries(text, 32, 0.1, 8, 1000);
+    }
+
+    // --- Frames and helicity ---
+
+    val compute_bishop_frames(const val& X) {
+        return js_guard([&]() {
+            Vec3Arg x = vec3_arg(X, "X");
+            if (x.view.size() < 3) {
+                throw std::invalid_argument("X must have at least 3 points (closed curve)");
+            }
+            sst::BishopFrames f;
+            sst::FrenetHelicity::compute_bishop_frames(std::vector<Vec3>(x.view.begin(), x.view.end()), f);
+            val result = val::object();
+            result.set("T", to_float64_array(f.T));
+            result.set("U", to_float64_array(f.U));
+            result.set("V", to_float64_array(f.V));
+            result.set("curvature", to_float64_array(f.curvature));
+            result.set("torsion", to_float64_array(f.torsion));
+            result.set("arclength", to_float64_array(f.arclength));
+            result.set("length", f.length);
+            result.set("holonomy", f.holonomy);
+            return result;
+        });
+    }
+
+    double compute_helicity(const val& velocity, const val& vorticity) {
+        return js_guard([&]() {
+            Vec3Arg v = vec3_arg(velocity, "velocity");
+            Vec3Arg w = vec3_arg(vorticity, "vorticity");
+            return static_cast<double>(sst::FrenetHelicity::compute_helicity(
+                std::vector<Vec3>(v.view.begin(), v.view.end()), std::vector<Vec3>(w.view.begin(), w.view.end())));
+        });
+    }
+
+    // Threads the parallel kernels use (1 without SST_WASM_THREADS).
+    unsigned num_threads() {
+        return static_cast<unsigned>(sst::get_num_threads());
+    }
+
+} // namespace
+
+EMSCRIPTEN_BINDINGS(swirl_string_core) {
+    class_<Vec3Buffer>("Vec3Buffer")
+        .constructor<std::size_t>()
+        .function("size", &Vec3Buffer::size)
+        .function("resize", &Vec3Buffer::resize)
+        .function("view", &Vec3Buffer::view);
+
+    function("computeVelocity", &compute_velocity);
+    function("biotSavartVelocityGrid", &compute_velocity);
+    function("computeVelocityInto", &compute_velocity_into);
+    function("computeVorticity", &compute_vorticity);
+    function("extractInterior", &extract_interior);
+    function("computeInvariants", &compute_invariants);
+
+    function("evaluateFourierSeries", &evaluate_fourier_series);
+    function("evaluateFseries", &evaluate_fseries);
+    function("computeWrithe", &compute_writhe);
+    function("writheGaussCurve", &writhe_gauss_curve);
+    function("helicityFromFseries", &helicity_from_fseries_default);
+    function("helicityFromFseries", &helicity_from_fseries);
+
+    function("computeBishopFrames", &compute_bishop_frames);
+    function("computeHelicity", &compute_helicity);
+
+    function("numThreads", &num_threads);
+#ifdef __EMSCRIPTEN_PTHREADS__
+    constant("hasThreads", true);
+#else
+    constant("hasThreads", false);
+#endif
+}
@@ -0,0 +1,622 @@
+// tests/sst_bench.cpp - Kernel benchmark suite (sst_bench)
+//
+// Sweeps problem sizes for the hot kernels and reports median/min wall time,
+// throughput (pairs/s, points/s, bytes/s) and the peak resident set of each
+// case. Optional thread scaling re-runs the suite in child processes with
+// SST_NUM_THREADS set, and a previous --json report can be used as baseline.
+//
+// Usage:
+//   sst_bench [--quick] [--filter SUBSTR] [--repeats N] [--threads 1,2,4]
+//             [--json OUT.json] [--baseline BASE.json] [--tolerance 0.10]
+//
+// Exit status: 0 ok, 1 a case is slower than baseline by more than the
+// tolerance, 2 usage or I/O error.
+
+#include "../src/biot_savart.h"
+#include "../src/knot_dynamics.h"
+#include "../src/ab_initio_mass.h"
+#include "../src/sst_integrator.h"
+#include "../src/trefoil_closure_kernels.h"
+#include "../src/thread_pool.h"
+#include "knot_files_embedded.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace sst;
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+volatile double g_sink = 0.0;  // keeps results observable
+
+// ---------------------------------------------------------------- memory
+
+// Linux can reset VmHWM (clear_refs "5"), giving a per-case peak; elsewhere
+// the value is the process-wide high-water mark so far.
+bool reset_peak_rss() {
+#if defined(__linux__)
+    std::ofstream f("/proc/self/clear_refs");
+    if (!f) return false;
+    f << "5";
+    return static_cast<bool>(f.flush());
+#else
+    return false;
+#endif
+}
+
+double peak_rss_mb() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) {
+        return static_cast<double>(pmc.PeakWorkingSetSize) / (1024.0 * 1024.0);
+    }
+    return 0.0;
+#else
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            return std::strtod(line.c_str() + 6, nullptr) / 1024.0;  // kB
+        }
+    }
+#endif
+    struct rusage ru {};
+    getrusage(RUSAGE_SELF, &ru);
+#if defined(__APPLE__)
+    return static_cast<double>(ru.ru_maxrss) / (1024.0 * 1024.0);  // bytes
+#else
+    return static_cast<double>(ru.ru_maxrss) / 1024.0;  // kB
+#endif
+#endif
+}
+
+// ---------------------------------------------------------------- inputs
+
+std::vector<Vec3> ring(std::size_t n, double radius = 1.0, Vec3 center = {0.0, 0.0, 0.0}, bool xz = false) {
+    std::vector<Vec3> p(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double t = 2.0 * PI * double(i) / double(n);
+        const double c = radius * std::cos(t), s = radius * std::sin(t);
+        p[i] = xz ? Vec3{center[0] + c, center[1], center[2] + s} : Vec3{center[0] + c, center[1] + s, center[2]};
+    }
+    return p;
+}
+
+// x = sin t + 2 sin 2t, y = cos t - 2 cos 2t, z = -sin 3t
+FourierBlock trefoil_block() {
+    FourierBlock b;
+    b.a_x = {0.0, 0.0, 0.0, 0.0}; b.b_x = {0.0, 1.0, 2.0, 0.0};
+    b.a_y = {0.0, 1.0, -2.0, 0.0}; b.b_y = {0.0, 0.0, 0.0, 0.0};
+    b.a_z = {0.0, 0.0, 0.0, 0.0}; b.b_z = {0.0, 0.0, 0.0, -1.0};
+    return b;
+}
+
+std::vector<double> samples(std::size_t n) {
+    std::vector<double> s(n);
+    for (std::size_t i = 0; i < n; ++i) s[i] = 2.0 * PI * double(i) / double(n);
+    return s;
+}
+
+std::vector<Vec3> trefoil(std::size_t n) {
+    return FourierKnot::evaluate(trefoil_block(), samples(n));
+}
+
+std::vector<double> flatten(const std::vector<Vec3>& p) {
+    std::vector<double> out(3 * p.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+        out[3 * i] = p[i][0]; out[3 * i + 1] = p[i][1]; out[3 * i + 2] = p[i][2];
+    }
+    return out;
+}
+
+// Smooth random-ish coefficients with 1/n^2 decay, rows [a_x b_x a_y b_y a_z b_z].
+std::vector<std::array<double, 6>> fourier_coeffs(std::size_t harmonics) {
+    std::vector<std::array<double, 6>> c(harmonics);
+    for (std::size_t n = 1; n < harmonics; ++n) {
+        for (std::size_t k = 0; k < 6; ++k) {
+            c[n][k] = std::sin(0.7 * double(n) + 1.3 * double(k)) / double(n * n);
+        }
+    }
+    return c;
+}
+
+std::string fseries_text(std::size_t lines) {
+    std::ostringstream os;
+    os << std::setprecision(17);
+    const auto c = fourier_coeffs(64);
+    for (std::size_t i = 0; i < lines; ++i) {
+        if (i % 64 == 0) os << "% block " << i / 64 << "\n";
+        const auto& row = c[i % 64];
+        os << row[0] << ' ' << row[1] << ' ' << row[2] << ' ' << row[3] << ' ' << row[4] << ' ' << row[5] << '\n';
+    }
+    return os.str();
+}
+
+// ---------------------------------------------------------------- cases
+
+struct Prepared {
+    std::function<void()> run;
+    double work = 0.0;  // units processed per run
+};
+
+struct Case {
+    std::string name;
+    std::string unit;  // "pairs", "points" or "bytes"
+    std::vector<std::size_t> sizes, quick_sizes;
+    std::function<Prepared(std::size_t)> prepare;
+};
+
+std::vector<Case> make_cases() {
+    std::vector<Case> cases;
+
+    cases.push_back({"biot_savart.computeVelocity", "pairs", {512, 4096, 13824, 32768}, {512, 4096},
+        [](std::size_t m) {
+            const std::size_t side = static_cast<std::size_t>(std::llround(std::cbrt(double(m))));
+            auto curve = std::make_shared<std::vector<Vec3>>(ring(256));
+            auto grid = std::make_shared<std::vector<Vec3>>();
+            for (std::size_t i = 0; i < side; ++i)
+                for (std::size_t j = 0; j < side; ++j)
+                    for (std::size_t k = 0; k < side; ++k)
+                        grid->push_back({3.0 * (double(i) / side - 0.5), 3.0 * (double(j) / side - 0.5),
+                                         3.0 * (double(k) / side - 0.5) + 0.013});
+            const double work = double(curve->size()) * double(grid->size());
+            return Prepared{[=]() { g_sink = BiotSavart::computeVelocity(*curve, *grid)[0][2]; }, work};
+        }});
+
+    cases.push_back({"biot_savart.bs_cutoff_energy_scan", "pairs", {500, 1000, 2000, 4000}, {500, 1000},
+        [](std::size_t n) {
+            auto pts = std::make_shared<std::vector<double>>(flatten(ring(n)));
+            auto tan = std::make_shared<std::vector<double>>(3 * n);
+            auto ds = std::make_shared<std::vector<double>>(n, 2.0 * PI / double(n));
+            for (std::size_t i = 0; i < n; ++i) {
+                const double t = 2.0 * PI * double(i) / double(n);
+                (*tan)[3 * i] = -std::sin(t); (*tan)[3 * i + 1] = std::cos(t);
+            }
+            auto a = std::make_shared<std::vector<double>>(16);
+            for (std::size_t k = 0; k < a->size(); ++k) (*a)[k] = 1e-3 * std::pow(1.5, double(k));
+            return Prepared{[=]() {
+                g_sink = bs_cutoff_energy_scan(pts->data(), tan->data(), ds->data(), n, a->data(), a->size())[0];
+            }, double(n) * double(n)};
+        }});
+
+    cases.push_back({"sst_integrator.compute_sst_mass", "pairs", {500, 1000, 2000, 4000}, {500, 1000},
+        [](std::size_t n) {
+            auto pts = std::make_shared<std::vector<Vec3>>(ring(n, 1e-14));
+            return Prepared{[=]() {
+                double m_core = 0.0, m_fluid = 0.0;
+                compute_sst_mass(*pts, 2.0, m_core, m_fluid);
+                g_sink = m_core + m_fluid;
+            }, double(n) * double(n)};
+        }});
+
+    cases.push_back({"trefoil.closure_energies", "pairs", {500, 1000, 2000, 4000}, {500, 1000},
+        [](std::size_t n) {
+            auto r = std::make_shared<std::vector<double>>(flatten(trefoil(n)));
+            return Prepared{[=]() { g_sink = trefoil_closure_energies(r->data(), n, 0.05).neumann_self_energy; },
+                            0.5 * double(n) * double(n - 1)};
+        }});
+
+    cases.push_back({"trefoil.closure_energies_grad", "pairs", {500, 1000, 2000, 4000}, {500, 1000},
+        [](std::size_t n) {
+            auto r = std::make_shared<std::vector<double>>(flatten(trefoil(n)));
+            auto g = std::make_shared<std::vector<double>>(4 * 3 * n);
+            return Prepared{[=]() {
+                TrefoilClosureGradients grads{g->data(), g->data() + 3 * n, g->data() + 6 * n, g->data() + 9 * n};
+                g_sink = trefoil_closure_energies_grad(r->data(), n, 0.05, grads).writhe_reg;
+            }, 0.5 * double(n) * double(n - 1)};
+        }});
+
+    cases.push_back({"knot.compute_writhe", "pairs", {250, 500, 1000, 2000}, {250, 500},
+        [](std::size_t n) {
+            auto p = std::make_shared<std::vector<Vec3>>(trefoil(n));
+            return Prepared{[=]() { g_sink = KnotDynamics::compute_writhe(*p); }, double(n) * double(n)};
+        }});
+
+    cases.push_back({"knot.writhe_gauss_curve", "pairs", {250, 500, 1000, 2000}, {250, 500},
+        [](std::size_t n) {
+            auto f = std::make_shared<KnotDynamics::FourierResult>(
+                KnotDynamics::evaluate_fourier_series(fourier_coeffs(8), samples(n)));
+            return Prepared{[=]() { g_sink = KnotDynamics::writhe_gauss_curve(f->positions, f->tangents); },
+                            double(n) * double(n)};
+        }});
+
+    cases.push_back({"knot.compute_linking_number", "pairs", {250, 500, 1000, 2000}, {250, 500},
+        [](std::size_t n) {
+            auto a = std::make_shared<std::vector<Vec3>>(ring(n));
+            auto b = std::make_shared<std::vector<Vec3>>(ring(n, 1.0, {1.0, 0.0, 0.0}, true));
+            return Prepared{[=]() { g_sink = KnotDynamics::compute_linking_number(*a, *b); },
+                            double(n) * double(n)};
+        }});
+
+    cases.push_back({"ab_initio.relax_hamiltonian", "points", {100, 200, 400}, {100},
+        [](std::size_t n) {
+            constexpr int iterations = 10;
+            auto p = std::make_shared<std::vector<Vec3>>(trefoil(n));
+            return Prepared{[=]() {
+                ParticleEvaluator ev(std::vector<std::vector<Vec3>>{*p});
+                ev.relax_hamiltonian(iterations, 1e-3);
+                g_sink = ev.filaments[0][0][0];
+            }, double(n) * iterations};
+        }});
+
+    cases.push_back({"knot.evaluate_fourier_series", "points", {1000, 10000, 100000}, {1000, 10000},
+        [](std::size_t n) {
+            auto c = std::make_shared<std::vector<std::array<double, 6>>>(fourier_coeffs(32));
+            auto t = std::make_shared<std::vector<double>>(samples(n));
+            return Prepared{[=]() { g_sink = KnotDynamics::evaluate_fourier_series(*c, *t).tangents[0][1]; },
+                            double(n)};
+        }});
+
+    cases.push_back({"fourier.evaluate", "points", {1000, 10000, 100000}, {1000, 10000},
+        [](std::size_t n) {
+            auto blocks = std::make_shared<std::vector<FourierBlock>>(
+                FourierKnot::parse_fseries_from_string(fseries_text(32)));
+            auto s = std::make_shared<std::vector<double>>(samples(n));
+            return Prepared{[=]() { g_sink = FourierKnot::evaluate(blocks->front(), *s)[0][0]; }, double(n)};
+        }});
+
+    cases.push_back({"parse.fseries_from_string", "bytes", {1000, 10000, 100000}, {1000, 10000},
+        [](std::size_t lines) {
+            auto text = std::make_shared<std::string>(fseries_text(lines));
+            return Prepared{[=]() { g_sink = double(FourierKnot::parse_fseries_from_string(*text).size()); },
+                            double(text->size())};
+        }});
+
+    cases.push_back({"parse.ideal_txt_from_string", "bytes", {1}, {1},
+        [](std::size_t) {
+            // Largest embedded <AB> database (ideal.txt in full resource sets).
+            auto text = std::make_shared<std::string>();
+            for (auto& [name, content] : get_embedded_ideal_files()) {
+                if (content.size() > text->size() && content.find("<AB ") != std::string::npos) {
+                    *text = std::move(content);
+                }
+            }
+            if (text->empty()) return Prepared{};
+            return Prepared{[=]() { g_sink = double(FourierKnot::parse_ideal_txt_from_string(*text).size()); },
+                            double(text->size())};
+        }});
+
+    cases.push_back({"helicity.from_fourier_block", "points", {16, 24, 32}, {16},
+        [](std::size_t grid) {
+            auto block = std::make_shared<FourierBlock>(trefoil_block());
+            const int margin = static_cast<int>(grid / 4);
+            return Prepared{[=]() {
+                g_sink = std::get<0>(KnotDynamics::compute_helicity_from_fourier_block(
+                    *block, static_cast<int>(grid), 0.25, margin, 500));
+            }, double(grid) * double(grid) * double(grid)};
+        }});
+
+    return cases;
+}
+
+// ---------------------------------------------------------------- results
+
+struct Result {
+    std::string kernel, unit;
+    std::size_t size = 0, threads = 0;
+    int repeats = 0;
+    double median_s = 0.0, min_s = 0.0, work = 0.0, peak_rss_mb = 0.0;
+
+    double throughput() const { return median_s > 0.0 ? work / median_s : 0.0; }
+    std::string key() const { return kernel + "@" + std::to_string(size) + "@" + std::to_string(threads); }
+};
+
+Result run_case(const Case& c, std::size_t size, int repeats) {
+    reset_peak_rss();
+    Prepared p = c.prepare(size);
+    Result r;
+    r.kernel = c.name;
+    r.unit = c.unit;
+    r.size = size;
+    r.threads = get_num_threads();
+    r.repeats = repeats;
+    if (!p.run) return r;  // input unavailable (e.g. no embedded ideal.txt)
+
+    p.run();  // warm-up: first-touch allocations, pool start-up
+    std::vector<double> times;
+    for (int i = 0; i < repeats; ++i) {
+        const auto t0 = std::chrono::steady_clock::now();
+        p.run();
+        times.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count());
+    }
+    std::sort(times.begin(), times.end());
+    r.median_s = times[times.size() / 2];
+    r.min_s = times.front();
+    r.work = p.work;
+    r.peak_rss_mb = peak_rss_mb();
+    return r;
+}
+
+std::string json_escape(const std::string& s) {
+    std::string out;
+    for (char ch : s) {
+        if (ch == '"' || ch == '\\') out += '\\';
+        out += ch;
+    }
+    return out;
+}
+
+void write_json(const std::string& path, const std::vector<Result>& results) {
+    std::ofstream out(path);
+    if (!out) throw std::runtime_error("cannot write " + path);
+    out << std::setprecision(9);
+    out << "{\n  \"schema\": \"sst_bench/1\",\n";
+    out << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+    out << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << "    {\"kernel\": \"" << json_escape(r.kernel) << "\", \"size\": " << r.size
+            << ", \"threads\": " << r.threads << ", \"repeats\": " << r.repeats
+            << ", \"median_s\": " << r.median_s << ", \"min_s\": " << r.min_s
+            << ", \"work\": " << r.work << ", \"unit\": \"" << r.unit << "\""
+            << ", \"throughput\": " << r.throughput() << ", \"peak_rss_mb\": " << r.peak_rss_mb << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+// Reads the flat result objects written by write_json (string and number
+// fields only); enough for baselines and child reports, not a general parser.
+std::vector<Result> read_json(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("cannot read " + path);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    const std::string text = ss.str();
+
+    std::vector<Result> results;
+    std::size_t pos = text.find("\"results\"");
+    if (pos == std::string::npos) throw std::runtime_error(path + ": no \"results\" array");
+    while ((pos = text.find('{', pos)) != std::string::npos) {
+        const std::size_t end = text.find('}', pos);
+        if (end == std::string::npos) break;
+        std::map<std::string, std::string> fields;
+        std::size_t p = pos + 1;
+        while (true) {
+            const std::size_t k0 = text.find('"', p);
+            if (k0 == std::string::npos || k0 > end) break;
+            const std::size_t k1 = text.find('"', k0 + 1);
+            const std::size_t colon = text.find(':', k1);
+            std::size_t v0 = text.find_first_not_of(" \t\r\n", colon + 1);
+            std::size_t v1;
+            std::string value;
+            if (text[v0] == '"') {
+                v1 = text.find('"', v0 + 1);
+                value = text.substr(v0 + 1, v1 - v0 - 1);
+                ++v1;
+            } else {
+                v1 = text.find_first_of(",}", v0);
+                value = text.substr(v0, v1 - v0);
+            }
+            fields[text.substr(k0 + 1, k1 - k0 - 1)] = value;
+            p = v1;
+        }
+        Result r;
+        r.kernel = fields["kernel"];
+        r.unit = fields["unit"];
+        r.size = std::strtoull(fields["size"].c_str(), nullptr, 10);
+        r.threads = std::strtoull(fields["threads"].c_str(), nullptr, 10);
+        r.repeats = std::atoi(fields["repeats"].c_str());
+        r.median_s = std::strtod(fields["median_s"].c_str(), nullptr);
+        r.min_s = std::strtod(fields["min_s"].c_str(), nullptr);
+        r.work = std::strtod(fields["work"].c_str(), nullptr);
+        r.peak_rss_mb = std::strtod(fields["peak_rss_mb"].c_str(), nullptr);
+        if (!r.kernel.empty()) results.push_back(r);
+        pos = end + 1;
+    }
+    return results;
+}
+
+std::string si(double v) {
+    const char* prefix[] = {"", "k", "M", "G", "T"};
+    int i = 0;
+    while (v >= 1000.0 && i < 4) { v /= 1000.0; ++i; }
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(v < 10.0 ? 2 : 1) << v << ' ' << prefix[i];
+    return os.str();
+}
+
+void print_results(const std::vector<Result>& results) {
+    std::cout << std::left << std::setw(36) << "kernel" << std::right << std::setw(8) << "size"
+              << std::setw(5) << "thr" << std::setw(12) << "median ms" << std::setw(12) << "min ms"
+              << std::setw(18) << "throughput" << std::setw(10) << "peak MB" << "\n";
+    for (const Result& r : results) {
+        if (r.work == 0.0) {
+            std::cout << std::left << std::setw(36) << r.kernel << "  (skipped: input unavailable)\n";
+            continue;
+        }
+        std::cout << std::left << std::setw(36) << r.kernel << std::right << std::setw(8) << r.size
+                  << std::setw(5) << r.threads << std::fixed << std::setprecision(3)
+                  << std::setw(12) << r.median_s * 1e3 << std::setw(12) << r.min_s * 1e3
+                  << std::setw(18) << (si(r.throughput()) + r.unit + "/s")
+                  << std::setprecision(1) << std::setw(10) << r.peak_rss_mb << "\n";
+        std::cout.unsetf(std::ios::fixed);
+    }
+}
+
+// Speed-up of every (kernel, size) relative to its fewest-threads run.
+void print_scaling(const std::vector<Result>& results) {
+    std::map<std::string, std::vector<const Result*>> by_case;
+    for (const Result& r : results) {
+        if (r.work > 0.0) by_case[r.kernel + "@" + std::to_string(r.size)].push_back(&r);
+    }
+    std::cout << "\nThread scaling (speed-up vs. fewest threads, parallel efficiency)\n";
+    for (auto& [key, runs] : by_case) {
+        std::sort(runs.begin(), runs.end(), [](const Result* a, const Result* b) { return a->threads < b->threads; });
+        const Result* base = runs.front();
+        std::cout << "  " << std::left << std::setw(44) << key;
+        for (const Result* r : runs) {
+            const double speedup = base->median_s / r->median_s;
+            const double eff = speedup * double(std::max<std::size_t>(base->threads, 1)) /
+                               double(std::max<std::size_t>(r->threads, 1));
+            std::cout << "  " << r->threads << "t: " << std::fixed << std::setprecision(2) << speedup
+                      << "x (" << std::setprecision(0) << eff * 100.0 << "%)";
+            std::cout.unsetf(std::ios::fixed);
+        }
+        std::cout << "\n";
+    }
+}
+
+int compare_to_baseline(const std::vector<Result>& results, const std::vector<Result>& baseline, double tolerance) {
+    std::map<std::string, const Result*> base;
+    for (const Result& b : baseline) base[b.key()] = &b;
+    int regressions = 0, compared = 0;
+    std::cout << "\nBaseline comparison (tolerance " << tolerance * 100.0 << "%)\n";
+    for (const Result& r : results) {
+        auto it = base.find(r.key());
+        if (it == base.end() || r.work == 0.0 || it->second->median_s <= 0.0) continue;
+        ++compared;
+        const double ratio = r.median_s / it->second->median_s;
+        const char* status = ratio > 1.0 + tolerance ? "REGRESSION" : (ratio < 1.0 - tolerance ? "faster" : "ok");
+        if (ratio > 1.0 + tolerance) ++regressions;
+        std::cout << "  " << std::left << std::setw(48) << r.key() << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(10) << it->second->median_s * 1e3 << " ms -> "
+                  << std::setw(10) << r.median_s * 1e3 << " ms  x" << std::setprecision(2) << ratio
+                  << "  " << status << "\n";
+        std::cout.unsetf(std::ios::fixed);
+    }
+    std::cout << "  " << compared << " case(s) compared, " << regressions << " regression(s)\n";
+    return regressions;
+}
+
+void set_env(const char* name, const std::string& value) {
+#if defined(_WIN32)
+    _putenv_s(name, value.c_str());
+#else
+    setenv(name, value.c_str(), 1);
+#endif
+}
+
+struct Options {
+    bool quick = false;
+    std::string filter, json, baseline, child_json;
+    int repeats = 5;
+    double tolerance = 0.10;
+    std::vector<std::size_t> threads;
+};
+
+void usage() {
+    std::cout << "usage: sst_bench [--quick] [--filter SUBSTR] [--repeats N] [--threads 1,2,4]\n"
+                 "                 [--json OUT.json] [--baseline BASE.json] [--tolerance 0.10]\n";
+}
+
+Options parse_args(int argc, char** argv) {
+    Options o;
+    auto need = [&](int& i) -> std::string {
+        if (i + 1 >= argc) throw std::invalid_argument(std::string(argv[i]) + " needs a value");
+        return argv[++i];
+    };
+    for (int i = 1; i < argc; ++i) {
+        const std::string a = argv[i];
+        if (a == "--quick") o.quick = true;
+        else if (a == "--filter") o.filter = need(i);
+        else if (a == "--repeats") o.repeats = std::max(1, std::atoi(need(i).c_str()));
+        else if (a == "--json") o.json = need(i);
+        else if (a == "--baseline") o.baseline = need(i);
+        else if (a == "--tolerance") o.tolerance = std::strtod(need(i).c_str(), nullptr);
+        else if (a == "--child-json") o.child_json = need(i);
+        else if (a == "--threads") {
+            std::stringstream ss(need(i));
+            std::string item;
+            while (std::getline(ss, item, ',')) {
+                const long t = std::atol(item.c_str());
+                if (t < 1) throw std::invalid_argument("--threads takes positive counts, e.g. 1,2,4");
+                o.threads.push_back(static_cast<std::size_t>(t));
+            }
+        } else if (a == "--help" || a == "-h") {
+            usage();
+            std::exit(0);
+        } else {
+            throw std::invalid_argument("unknown argument " + a);
+        }
+    }
+    return o;
+}
+
+std::vector<Result> run_suite(const Options& o) {
+    std::vector<Result> results;
+    for (const Case& c : make_cases()) {
+        if (!o.filter.empty() && c.name.find(o.filter) == std::string::npos) continue;
+        for (std::size_t size : (o.quick ? c.quick_sizes : c.sizes)) {
+            results.push_back(run_case(c, size, o.repeats));
+            if (o.child_json.empty()) {
+                std::cerr << "  " << c.name << " [" << size << "] done\n";
+            }
+        }
+    }
+    return results;
+}
+
+// One child process per thread count, so each gets a fresh pool and its own peak RSS.
+std::vector<Result> run_scaling(const Options& o, const char* argv0) {
+    std::vector<Result> results;
+    for (std::size_t t : o.threads) {
+        const std::filesystem::path out =
+            std::filesystem::temp_directory_path() / ("sst_bench_threads_" + std::to_string(t) + ".json");
+        std::string cmd = "\"" + std::string(argv0) + "\" --child-json \"" + out.string() + "\" --repeats " +
+                          std::to_string(o.repeats);
+        if (o.quick) cmd += " --quick";
+        if (!o.filter.empty()) cmd += " --filter \"" + o.filter + "\"";
+        set_env("SST_NUM_THREADS", std::to_string(t));
+        std::cerr << "[*] " << t << " thread(s)\n";
+        if (std::system(cmd.c_str()) != 0) throw std::runtime_error("child run failed: " + cmd);
+        for (Result& r : read_json(out.string())) results.push_back(r);
+        std::filesystem::remove(out);
+    }
+    return results;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        const Options o = parse_args(argc, argv);
+        if (!o.child_json.empty()) {
+            write_json(o.child_json, run_suite(o));
+            return 0;
+        }
+
+        std::cout << "[*] sst_bench: " << std::thread::hardware_concurrency() << " hardware threads, "
+                  << o.repeats << " repeats" << (o.quick ? ", quick sizes" : "") << "\n";
+        const std::vector<Result> results = o.threads.empty() ? run_suite(o) : run_scaling(o, argv[0]);
+        print_results(results);
+        if (o.threads.size() > 1) print_scaling(results);
+        if (!o.json.empty()) {
+            write_json(o.json, results);
+            std::cout << "[+] JSON report: " << o.json << "\n";
+        }
+        if (!o.baseline.empty()) {
+            return compare_to_baseline(results, read_json(o.baseline), o.tolerance) > 0 ? 1 : 0;
+        }
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "sst_bench: " << e.what() << "\n";
+        usage();
+        return 2;
+    }
+}
@@ -0,0 +1,556 @@
+// tests/sst_validate.cpp - Accuracy-versus-speed validation (sst_validate)
+//
+// Runs every approximate path (fewer curve samples, tree code, cutoff and
+// fast Gauss sums) against its exact reference on the embedded
+// knot set and reports max/RMS relative error next to the time saved.
+// A variant fails when either error exceeds its budget; the defaults below
+// can be overridden per deployment with --budget. Variants without a default
+// budget (too lossy to be a default anywhere) are reported as "info".
+//
+// Usage:
+//   sst_validate [--quick] [--filter SUBSTR] [--knots N] [--repeats N]
+//                [--budget PATTERN=MAX[:RMS]]... [--json OUT.json] [--list]
+//
+// Exit status: 0 all variants within budget, 1 a budget is exceeded,
+// 2 usage or I/O error.
+
+#include "../src/biot_savart.h"
+#include "../src/knot_dynamics.h"
+#include "../src/potential_timefield.h"
+#include "../src/sst_integrator.h"
+#include "../include/SST_Constants.h"
+#include "knot_files_embedded.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace sst;
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+// Budget of a report-only variant. Not infinity: the tree builds with
+// -ffast-math, which assumes finite values.
+constexpr double NO_BUDGET = -1.0;
+
+// ---------------------------------------------------------------- inputs
+
+struct Knot {
+    std::string name;
+    FourierBlock block;
+    double extent = 1.0;  // max |x - centroid| of the centred curve
+};
+
+std::vector<double> samples(std::size_t n) {
+    std::vector<double> s(n);
+    for (std::size_t i = 0; i < n; ++i) s[i] = 2.0 * PI * double(i) / double(n);
+    return s;
+}
+
+std::vector<Vec3> curve(const Knot& k, std::size_t n) {
+    return FourierKnot::center_points(FourierKnot::evaluate(k.block, samples(n)));
+}
+
+// Source strengths along a closed polyline: unit tangents (central
+// differences) scaled by 1 + cos(s)/2. The uneven weighting keeps symmetric
+// knots (the unknot) from cancelling the sums to round-off.
+std::vector<Vec3> line_sources(const std::vector<Vec3>& p) {
+    const std::size_t n = p.size();
+    std::vector<Vec3> t(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const Vec3& a = p[(i + n - 1) % n];
+        const Vec3& b = p[(i + 1) % n];
+        Vec3 d{b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+        const double len = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+        const double w = len > 0.0 ? (1.0 + 0.5 * std::cos(2.0 * PI * double(i) / double(n))) / len : 0.0;
+        t[i] = {d[0] * w, d[1] * w, d[2] * w};
+    }
+    return t;
+}
+
+std::vector<Knot> embedded_knots() {
+    std::vector<Knot> knots;
+    for (const auto& [name, content] : get_embedded_knot_files()) {
+        std::vector<FourierBlock> blocks = FourierKnot::parse_fseries_from_string(content);
+        const int idx = FourierKnot::index_of_largest_block(blocks);
+        if (idx < 0) continue;
+        Knot k{name, std::move(blocks[idx])};
+        double r2 = 0.0;
+        for (const Vec3& p : curve(k, 512)) r2 = std::max(r2, p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+        if (!(r2 > 0.0)) continue;
+        k.extent = std::sqrt(r2);
+        knots.push_back(std::move(k));
+    }
+    return knots;
+}
+
+// ---------------------------------------------------------------- checks
+
+// A kernel output as flat values; `stride` values form one error group
+// (3 for a vector field, 1 for scalars).
+struct Output {
+    std::vector<double> values;
+    std::size_t stride = 1;
+};
+
+// How an error group is made relative:
+//   Field:   |a - r| / max over the knot's groups |r|  (one scale per field)
+//   Scalar:  |a - r| / max(|r|, floor)                 (each value on its own)
+enum class Norm { Field, Scalar };
+
+using Kernel = std::function<Output(const Knot&)>;
+
+struct Variant {
+    std::string name;
+    Kernel run;
+    double max_budget, rms_budget;
+};
+
+struct Check {
+    std::string name;
+    Norm norm;
+    double floor;  // Scalar only: values below it are compared absolutely
+    Kernel reference;
+    std::vector<Variant> variants;
+};
+
+Output from_field(const std::vector<Vec3>& v) {
+    Output o;
+    o.stride = 3;
+    o.values.reserve(3 * v.size());
+    for (const Vec3& x : v) o.values.insert(o.values.end(), x.begin(), x.end());
+    return o;
+}
+
+Output from_values(std::vector<double> v) {
+    return Output{std::move(v), 1};
+}
+
+// Regular targets filling the box around the knot. Nodes within 10% of the
+// extent of the filament are dropped: there the field of any polyline is
+// set by its nearest segment, not by the sampling being validated.
+std::vector<Vec3> box_grid(const Knot& k, int side) {
+    const std::vector<Vec3> line = curve(k, 2048);
+    const double min_d2 = 0.01 * k.extent * k.extent;
+    std::vector<Vec3> g;
+    const double h = 3.0 * k.extent / double(side);
+    for (int i = 0; i < side; ++i)
+        for (int j = 0; j < side; ++j)
+            for (int l = 0; l < side; ++l) {
+                const Vec3 x{h * (i - 0.5 * (side - 1)), h * (j - 0.5 * (side - 1)), h * (l - 0.5 * (side - 1))};
+                const bool near = std::any_of(line.begin(), line.end(), [&](const Vec3& p) {
+                    const double dx = x[0] - p[0], dy = x[1] - p[1], dz = x[2] - p[2];
+                    return dx * dx + dy * dy + dz * dz < min_d2;
+                });
+                if (!near) g.push_back(x);
+            }
+    return g;
+}
+
+std::vector<Check> make_checks(bool quick) {
+    std::vector<Check> checks;
+    const std::size_t q = quick ? 2 : 1;  // quick mode halves the reference sizes
+
+    {
+        const std::size_t ref_n = 2048 / q;
+        const int side = quick ? 10 : 14;
+        auto velocity = [side](std::size_t n) {
+            return [n, side](const Knot& k) {
+                return from_field(BiotSavart::computeVelocity(curve(k, n), box_grid(k, side)));
+            };
+        };
+        Check c{"biot_savart.computeVelocity", Norm::Field, 0.0, velocity(ref_n), {}};
+        c.variants.push_back({"samples/2", velocity(ref_n / 2), 5e-3, 2e-4});
+        c.variants.push_back({"samples/4", velocity(ref_n / 4), 2e-2, 1e-3});
+        c.variants.push_back({"samples/8", velocity(ref_n / 8), NO_BUDGET, NO_BUDGET});
+        checks.push_back(std::move(c));
+    }
+
+    {
+        // Knots scaled to ~10 core radii so the r_c regularisation matters.
+        const std::size_t ref_n = 2000 / q;
+        auto mass = [](std::size_t n) {
+            return [n](const Knot& k) {
+                const double s = 10.0 * double(SST::Constants::RC_CORE) / k.extent;
+                std::vector<Vec3> p = curve(k, n);
+                for (Vec3& x : p) x = {x[0] * s, x[1] * s, x[2] * s};
+                double m_core = 0.0, m_fluid = 0.0;
+                compute_sst_mass(p, 2.0, m_core, m_fluid);
+                return from_values({m_core, m_fluid});
+            };
+        };
+        Check c{"sst_integrator.compute_sst_mass", Norm::Scalar, 0.0, mass(ref_n), {}};
+        c.variants.push_back({"samples/2", mass(ref_n / 2), 1e-2, 2e-3});
+        c.variants.push_back({"samples/4", mass(ref_n / 4), 3e-2, 6e-3});
+        c.variants.push_back({"samples/8", mass(ref_n / 8), NO_BUDGET, NO_BUDGET});
+        checks.push_back(std::move(c));
+    }
+
+    {
+        // Writhe is O(1) and vanishes for amphichiral knots: errors below one
+        // unit of writhe are reported absolutely (floor 1). compute_writhe does
+        // not converge on tight knots at these sizes (the closing segment is
+        // skipped and close passes are undersampled), so it is report only.
+        const std::size_t ref_n = 1000 / q;
+        auto writhe = [](std::size_t n) {
+            return [n](const Knot& k) { return from_values({KnotDynamics::compute_writhe(curve(k, n))}); };
+        };
+        Check c{"knot.compute_writhe", Norm::Scalar, 1.0, writhe(ref_n), {}};
+        c.variants.push_back({"samples/2", writhe(ref_n / 2), NO_BUDGET, NO_BUDGET});
+        c.variants.push_back({"samples/4", writhe(ref_n / 4), NO_BUDGET, NO_BUDGET});
+        c.variants.push_back({"samples/8", writhe(ref_n / 8), NO_BUDGET, NO_BUDGET});
+        checks.push_back(std::move(c));
+    }
+
+    {
+        // Compares a_mu on a fixed grid (box of 3 extents). H_charge and H_mass
+        // are raw grid sums dominated by the nodes next to the filament; they
+        // change with the grid by construction and are not validated here.
+        const int grid = quick ? 24 : 32;
+        const int ref_samples = 1000 / int(q);
+        auto helicity = [grid](int nsamples) {
+            return [grid, nsamples](const Knot& k) {
+                const double h = 3.0 * k.extent / double(grid);
+                const auto [hc, hm, amu] =
+                    KnotDynamics::compute_helicity_from_fourier_block(k.block, grid, h, grid / 4, nsamples);
+                return from_values({amu});
+            };
+        };
+        Check c{"knot.compute_helicity_from_fourier_block", Norm::Scalar, 1e-3, helicity(ref_samples), {}};
+        c.variants.push_back({"nsamples/2", helicity(ref_samples / 2), 1e-1, 5e-2});
+        c.variants.push_back({"nsamples/4", helicity(ref_samples / 4), NO_BUDGET, NO_BUDGET});
+        checks.push_back(std::move(c));
+    }
+
+    {
+        // Tree-code dipole sum vs. all pairs, sources = vortex line elements.
+        const std::size_t n = quick ? 2000 : 6000;
+        auto dipole = [n](DipoleSumMethod method, double theta, int order) {
+            return [=](const Knot& k) {
+                const std::vector<Vec3> p = curve(k, n);
+                DipoleSumOptions opt;
+                opt.method = method;
+                opt.theta = theta;
+                opt.order = order;
+                return from_values(
+                    TimeField::compute_gravitational_potential_direct(p, line_sources(p), 0.01 * k.extent, opt));
+            };
+        };
+        Check c{"timefield.dipole_sum", Norm::Field, 0.0, dipole(DipoleSumMethod::Direct, 0.4, 10), {}};
+        c.variants.push_back({"tree(theta=0.4,order=10)", dipole(DipoleSumMethod::Tree, 0.4, 10), 2e-5, 1e-6});
+        c.variants.push_back({"tree(theta=0.5,order=8)", dipole(DipoleSumMethod::Tree, 0.5, 8), 2e-3, 1e-4});
+        c.variants.push_back({"tree(theta=0.7,order=4)", dipole(DipoleSumMethod::Tree, 0.7, 4), NO_BUDGET, NO_BUDGET});
+        checks.push_back(std::move(c));
+    }
+
+    {
+        // Gaussian vorticity-gradient sum with a kernel width of 5% of the knot.
+        const std::size_t n = quick ? 2000 : 6000;
+        auto gauss = [n](GaussSumMethod method, double tol) {
+            return [=](const Knot& k) {
+                const std::vector<Vec3> p = curve(k, n);
+                GaussSumOptions opt;
+                opt.method = method;
+                opt.tolerance = tol;
+                return from_values(
+                    TimeField::compute_gravitational_potential_gradient(p, line_sources(p), 0.05 * k.extent, opt));
+            };
+        };
+        Check c{"timefield.gauss_sum", Norm::Field, 0.0, gauss(GaussSumMethod::Direct, 1e-10), {}};
+        c.variants.push_back({"cutoff(tol=1e-10)", gauss(GaussSumMethod::Cutoff, 1e-10), 1e-8, 1e-9});
+        c.variants.push_back({"cutoff(tol=1e-6)", gauss(GaussSumMethod::Cutoff, 1e-6), 1e-4, 1e-5});
+        c.variants.push_back({"fast_gauss(tol=1e-10)", gauss(GaussSumMethod::FastGauss, 1e-10), 1e-8, 1e-9});
+        c.variants.push_back({"fast_gauss(tol=1e-6)", gauss(GaussSumMethod::FastGauss, 1e-6), 1e-4, 1e-5});
+        checks.push_back(std::move(c));
+    }
+
+    return checks;
+}
+
+// ---------------------------------------------------------------- measurement
+
+struct Timed {
+    Output out;
+    double seconds = 0.0;  // best of the repeats
+};
+
+Timed timed_run(const Kernel& k, const Knot& knot, int repeats) {
+    Timed t;
+    for (int i = 0; i < repeats; ++i) {
+        const auto t0 = std::chrono::steady_clock::now();
+        Output o = k(knot);
+        const double dt = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        if (i == 0) {
+            t.out = std::move(o);
+            t.seconds = dt;
+        } else {
+            t.seconds = std::min(t.seconds, dt);
+        }
+    }
+    return t;
+}
+
+struct Result {
+    std::string check, variant;
+    std::size_t knots = 0, groups = 0;
+    double max_rel = 0.0, sum_sq = 0.0;
+    double ref_s = 0.0, approx_s = 0.0;
+    double max_budget = 0.0, rms_budget = 0.0;
+    std::string worst_knot;
+
+    double rms_rel() const { return groups ? std::sqrt(sum_sq / double(groups)) : 0.0; }
+    double speedup() const { return approx_s > 0.0 ? ref_s / approx_s : 0.0; }
+    double time_saved() const { return ref_s > 0.0 ? 1.0 - approx_s / ref_s : 0.0; }
+    bool gated() const { return max_budget >= 0.0 || rms_budget >= 0.0; }
+    bool failed() const {
+        return (max_budget >= 0.0 && !(max_rel <= max_budget)) || (rms_budget >= 0.0 && !(rms_rel() <= rms_budget));
+    }
+    std::string key() const { return check + "/" + variant; }
+};
+
+double group_norm(const double* v, std::size_t stride) {
+    double s = 0.0;
+    for (std::size_t i = 0; i < stride; ++i) s += v[i] * v[i];
+    return std::sqrt(s);
+}
+
+void accumulate(Result& r, const Check& c, const std::string& knot, const Output& ref, const Output& approx) {
+    if (ref.values.size() != approx.values.size() || ref.stride != approx.stride) {
+        throw std::runtime_error(r.key() + ": output shape differs from the reference on " + knot);
+    }
+    const std::size_t stride = ref.stride;
+    const std::size_t groups = ref.values.size() / stride;
+    double field_scale = 0.0;
+    if (c.norm == Norm::Field) {
+        for (std::size_t g = 0; g < groups; ++g) {
+            field_scale = std::max(field_scale, group_norm(&ref.values[g * stride], stride));
+        }
+    }
+    for (std::size_t g = 0; g < groups; ++g) {
+        double diff[3] = {0.0, 0.0, 0.0};
+        for (std::size_t i = 0; i < stride; ++i) {
+            diff[i] = approx.values[g * stride + i] - ref.values[g * stride + i];
+        }
+        const double scale = c.norm == Norm::Field ? field_scale
+                                                   : std::max(group_norm(&ref.values[g * stride], stride), c.floor);
+        double rel = group_norm(diff, stride);
+        if (scale > 0.0) rel /= scale;
+        if (!(rel <= r.max_rel)) {
+            r.max_rel = rel;
+            r.worst_knot = knot;
+        }
+        r.sum_sq += rel * rel;
+        ++r.groups;
+    }
+}
+
+// ---------------------------------------------------------------- options
+
+struct Budget {
+    std::string pattern;
+    double max_rel, rms_rel;
+};
+
+struct Options {
+    bool quick = false, list = false;
+    std::string filter, json;
+    std::size_t knots = 0;  // 0 = all (quick: 6)
+    int repeats = 1;
+    std::vector<Budget> budgets;
+};
+
+void usage() {
+    std::cout << "usage: sst_validate [--quick] [--filter SUBSTR] [--knots N] [--repeats N]\n"
+                 "                    [--budget PATTERN=MAX[:RMS]]... [--json OUT.json] [--list]\n";
+}
+
+// PATTERN matches a substring of "check/variant"; later --budget flags win.
+Budget parse_budget(const std::string& spec) {
+    const std::size_t eq = spec.rfind('=');
+    if (eq == std::string::npos || eq == 0) throw std::invalid_argument("--budget takes PATTERN=MAX[:RMS], got " + spec);
+    Budget b;
+    b.pattern = spec.substr(0, eq);
+    const std::string v = spec.substr(eq + 1);
+    const std::size_t colon = v.find(':');
+    char* end = nullptr;
+    b.max_rel = std::strtod(v.c_str(), &end);
+    if (end == v.c_str() || !(b.max_rel >= 0.0)) throw std::invalid_argument("bad --budget value in " + spec);
+    b.rms_rel = b.max_rel;
+    if (colon != std::string::npos) {
+        const std::string rms = v.substr(colon + 1);
+        b.rms_rel = std::strtod(rms.c_str(), &end);
+        if (end == rms.c_str() || !(b.rms_rel >= 0.0)) throw std::invalid_argument("bad --budget value in " + spec);
+    }
+    return b;
+}
+
+Options parse_args(int argc, char** argv) {
+    Options o;
+    auto need = [&](int& i) -> std::string {
+        if (i + 1 >= argc) throw std::invalid_argument(std::string(argv[i]) + " needs a value");
+        return argv[++i];
+    };
+    for (int i = 1; i < argc; ++i) {
+        const std::string a = argv[i];
+        if (a == "--quick") o.quick = true;
+        else if (a == "--list") o.list = true;
+        else if (a == "--filter") o.filter = need(i);
+        else if (a == "--knots") o.knots = static_cast<std::size_t>(std::max(1L, std::atol(need(i).c_str())));
+        else if (a == "--repeats") o.repeats = std::max(1, std::atoi(need(i).c_str()));
+        else if (a == "--budget") o.budgets.push_back(parse_budget(need(i)));
+        else if (a == "--json") o.json = need(i);
+        else if (a == "--help" || a == "-h") {
+            usage();
+            std::exit(0);
+        } else {
+            throw std::invalid_argument("unknown argument " + a);
+        }
+    }
+    return o;
+}
+
+// Every k-th knot so a subset still spans simple and complex knots.
+std::vector<Knot> select_knots(std::vector<Knot> all, std::size_t count) {
+    if (count == 0 || count >= all.size()) return all;
+    std::vector<Knot> out;
+    const double step = double(all.size()) / double(count);
+    for (std::size_t i = 0; i < count; ++i) out.push_back(std::move(all[std::size_t(i * step)]));
+    return out;
+}
+
+// ---------------------------------------------------------------- report
+
+std::string json_escape(const std::string& s) {
+    std::string out;
+    for (char ch : s) {
+        if (ch == '"' || ch == '\\') out += '\\';
+        out += ch;
+    }
+    return out;
+}
+
+// Report-only budgets are written as null.
+std::string json_number(double v) {
+    if (v < 0.0) return "null";
+    std::ostringstream os;
+    os << std::setprecision(9) << v;
+    return os.str();
+}
+
+void write_json(const std::string& path, const std::vector<Result>& results, bool quick) {
+    std::ofstream out(path);
+    if (!out) throw std::runtime_error("cannot write " + path);
+    out << std::setprecision(9);
+    out << "{\n  \"schema\": \"sst_validate/1\",\n  \"quick\": " << (quick ? "true" : "false") << ",\n";
+    out << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << "    {\"check\": \"" << json_escape(r.check) << "\", \"variant\": \"" << json_escape(r.variant)
+            << "\", \"knots\": " << r.knots << ", \"max_rel\": " << r.max_rel << ", \"rms_rel\": " << r.rms_rel()
+            << ", \"max_budget\": " << json_number(r.max_budget) << ", \"rms_budget\": " << json_number(r.rms_budget)
+            << ", \"ref_s\": " << r.ref_s << ", \"approx_s\": " << r.approx_s << ", \"speedup\": " << r.speedup()
+            << ", \"worst_knot\": \"" << json_escape(r.worst_knot) << "\", \"passed\": "
+            << (r.failed() ? "false" : "true") << "}" << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+void print_results(const std::vector<Result>& results) {
+    std::cout << std::left << std::setw(44) << "check" << std::setw(26) << "variant" << std::right
+              << std::setw(11) << "max rel" << std::setw(11) << "rms rel" << std::setw(11) << "budget"
+              << std::setw(10) << "speedup" << std::setw(8) << "saved" << "  status\n";
+    for (const Result& r : results) {
+        std::cout << std::left << std::setw(44) << r.check << std::setw(26) << r.variant << std::right
+                  << std::scientific << std::setprecision(2) << std::setw(11) << r.max_rel << std::setw(11)
+                  << r.rms_rel();
+        if (r.gated()) std::cout << std::setw(11) << r.max_budget;
+        else std::cout << std::setw(11) << "-";
+        std::cout << std::fixed << std::setw(9) << r.speedup()
+                  << "x" << std::setprecision(0) << std::setw(7) << r.time_saved() * 100.0 << "%"
+                  << "  " << (r.failed() ? "OVER BUDGET (worst: " + r.worst_knot + ")" : (r.gated() ? "ok" : "info"))
+                  << "\n";
+        std::cout.unsetf(std::ios::floatfield);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        const Options o = parse_args(argc, argv);
+        std::vector<Check> checks = make_checks(o.quick);
+        if (o.list) {
+            for (const Check& c : checks)
+                for (const Variant& v : c.variants)
+                    if (v.max_budget < 0.0 && v.rms_budget < 0.0) {
+                        std::cout << c.name << "/" << v.name << "  report only\n";
+                    } else {
+                        std::cout << c.name << "/" << v.name << "  max " << v.max_budget << "  rms " << v.rms_budget << "\n";
+                    }
+            return 0;
+        }
+
+        const std::vector<Knot> knots = select_knots(embedded_knots(), o.knots ? o.knots : (o.quick ? 6 : 0));
+        if (knots.empty()) throw std::runtime_error("no embedded knots with a Fourier series");
+        std::cout << "[*] sst_validate: " << knots.size() << " embedded knot(s), best of " << o.repeats
+                  << (o.quick ? ", quick sizes" : "") << "\n";
+
+        std::vector<Result> results;
+        for (const Check& c : checks) {
+            std::vector<Result> rows;
+            for (const Variant& v : c.variants) {
+                Result r;
+                r.check = c.name;
+                r.variant = v.name;
+                r.max_budget = v.max_budget;
+                r.rms_budget = v.rms_budget;
+                for (const Budget& b : o.budgets) {
+                    if (r.key().find(b.pattern) != std::string::npos) {
+                        r.max_budget = b.max_rel;
+                        r.rms_budget = b.rms_rel;
+                    }
+                }
+                if (o.filter.empty() || r.key().find(o.filter) != std::string::npos) rows.push_back(r);
+            }
+            if (rows.empty()) continue;
+
+            for (const Knot& k : knots) {
+                const Timed ref = timed_run(c.reference, k, o.repeats);
+                for (Result& r : rows) {
+                    const Variant& v = *std::find_if(c.variants.begin(), c.variants.end(),
+                                                     [&](const Variant& x) { return x.name == r.variant; });
+                    const Timed approx = timed_run(v.run, k, o.repeats);
+                    accumulate(r, c, k.name, ref.out, approx.out);
+                    r.ref_s += ref.seconds;
+                    r.approx_s += approx.seconds;
+                    ++r.knots;
+                }
+            }
+            std::cerr << "  " << c.name << " done\n";
+            results.insert(results.end(), rows.begin(), rows.end());
+        }
+
+        print_results(results);
+        if (!o.json.empty()) {
+            write_json(o.json, results, o.quick);
+            std::cout << "[+] JSON report: " << o.json << "\n";
+        }
+        const auto failed = std::count_if(results.begin(), results.end(), [](const Result& r) { return r.failed(); });
+        std::cout << "  " << results.size() << " variant(s) checked, " << failed << " over budget\n";
+        return failed > 0 ? 1 : 0;
+    } catch (const std::exception& e) {
+        std::cerr << "sst_validate: " << e.what() << "\n";
+        usage();
+        return 2;
+    }
+}
@@ -41,3 +41,70 @@ try {
     process.exit(1);
 }
 
+// Promise-returning variants run on the libuv thread pool; Float64Array inputs
+// are read in place, so a view with a byteOffset must give the same answer.
+async function testAsyncVariants() {
+    if (typeof sst.computeVelocityAsync !== 'function') {
+        console.log('computeVelocityAsync not available (module may be stub)');
+        return;
+    }
+    const ring = (n) => {
+        const out = new Float64Array(3 * n);
+        for (let i = 0; i < n; i++) {
+            const t = 2 * Math.PI * i / n;
+            out.set([Math.cos(t), Math.sin(t), 0], 3 * i);
+        }
+        return out;
+    };
+    const maxDiff = (a, b) => a.reduce((m, x, i) => Math.max(m, Math.abs(x - b[i])), 0);
+
+    const curve = ring(64);
+    const backing = new Float64Array(3 + 3 * 500);
+    for (let i = 3; i < backing.length; i++) backing[i] = 0.3 * Math.sin(i);
+    const grid = backing.subarray(3);
+    const nested = [];
+    for (let i = 0; i < grid.length; i += 3) nested.push([grid[i], grid[i + 1], grid[i + 2]]);
+
+    const expected = sst.computeVelocity(curve, nested);
+    if (maxDiff(sst.computeVelocity(curve, grid), expected) !== 0) {
+        throw new Error('Float64Array view with byteOffset disagrees with nested array input');
+    }
+
+    let ticked = false;
+    setImmediate(() => { ticked = true; });
+    const big = new Float64Array(3 * 200000).map((_, i) => Math.cos(0.001 * i));
+    const pending = sst.computeVelocityAsync(curve, big);
+    if (!(pending instanceof Promise)) throw new Error('computeVelocityAsync must return a Promise');
+    const [bigResult, gridResult] = await Promise.all([pending, sst.computeVelocityAsync(curve, grid)]);
+    if (!ticked) throw new Error('event loop did not run while computeVelocityAsync was pending');
+    if (bigResult.length !== big.length) throw new Error('computeVelocityAsync returned wrong length');
+    if (maxDiff(gridResult, expected) !== 0) throw new Error('computeVelocityAsync disagrees with computeVelocity');
+    console.log('✓ computeVelocityAsync matches computeVelocity without blocking the event loop');
+
+    const frames = await sst.computeBishopFramesAsync(curve);
+    if (maxDiff(frames.T, sst.computeBishopFrames(curve).T) !== 0) {
+        throw new Error('computeBishopFramesAsync disagrees with computeBishopFrames');
+    }
+    const energy = await sst.computeKineticEnergyAsync(grid, 2.0);
+    if (energy !== sst.computeKineticEnergy(nested, 2.0)) {
+        throw new Error('computeKineticEnergyAsync disagrees with computeKineticEnergy');
+    }
+    console.log('✓ computeBishopFramesAsync / computeKineticEnergyAsync match the sync exports');
+
+    let rejected = null;
+    try {
+        await sst.computeVelocityAsync('not an array', grid);
+    } catch (err) {
+        rejected = err;
+    }
+    if (!(rejected instanceof TypeError)) throw new Error('bad input must reject with a TypeError');
+    console.log('✓ async argument errors reject the Promise');
+}
+
+testAsyncVariants().then(() => {
+    console.log('Async test completed!');
+}).catch((err) => {
+    console.error('✗ async test failed:', err.message);
+    process.exit(1);
+});
+
@@ -6,6 +6,9 @@ Tests all functions with LaTeX formulas, inputs, and results logged.
 
 import sys
 import os
+import threading
+import time
+from concurrent.futures import ThreadPoolExecutor
 import numpy as np
 
 # Add build directory to path
@@ -63,6 +66,14 @@ def log_test(func_name, latex_formula, inputs_dict, results, description=""):
     print("="*80)
 
 
+def _trefoil(n):
+    """(n, 3) trefoil r(t) = (sin t + 2 sin 2t, cos t - 2 cos 2t, -sin 3t), t uniform on [0, 2pi)."""
+    t = np.linspace(0.0, 2.0 * np.pi, n, endpoint=False)
+    return np.stack([np.sin(t) + 2.0 * np.sin(2.0 * t),
+                     np.cos(t) - 2.0 * np.cos(2.0 * t),
+                     -np.sin(3.0 * t)], axis=1)
+
+
 def test_biot_savart_velocity():
     """Test single point velocity calculation."""
     r = [0.0, 0.0, 1.0]  # Observation point
@@ -249,6 +260,260 @@ def test_biot_savart_compute_invariants():
     )
 
 
+def test_calculate_closure_energies():
+    """Fused closure energies must equal the individual kernels bit for bit."""
+    n = 600
+    rc = 0.05
+    points = _trefoil(n)
+
+    formula = r"$\{C_N, U_{rep}, Wr, L, K\} = \text{one pass over } i<j$"
+
+    fused = swirl_string_core.calculate_closure_energies(points, rc)
+    reference = {
+        "neumann_self_energy": swirl_string_core.calculate_neumann_self_energy(points, rc),
+        "core_repulsion": swirl_string_core.calculate_core_repulsion(points, rc),
+        "writhe_reg": swirl_string_core.calculate_writhe(points, rc),
+        "polyline_length": swirl_string_core.calculate_length(points),
+        "curvature_penalty_menger": swirl_string_core.calculate_curvature_penalty(points),
+    }
+    for name, value in reference.items():
+        assert getattr(fused, name) == value, f"{name}: fused {getattr(fused, name)!r} != {value!r}"
+
+    log_test(
+        "calculate_closure_energies",
+        formula,
+        {"points": f"Trefoil with {n} vertices", "rc": rc},
+        {name: getattr(fused, name) for name in reference},
+        "Fused trefoil closure energies (bit-identical to the individual calculate_* calls)"
+    )
+
+
+def test_calculate_closure_energy_gradients():
+    """Analytic (value, grad) kernels against central finite differences."""
+    n = 80
+    rc = 0.08
+    points = _trefoil(n)
+
+    formula = r"$\partial E / \partial \mathbf{r}_i \approx [E(\mathbf{r}+h) - E(\mathbf{r}-h)] / 2h$"
+
+    pairs = [
+        ("neumann", lambda p: swirl_string_core.calculate_neumann_self_energy(p, rc),
+         lambda p: swirl_string_core.calculate_neumann_self_energy_grad(p, rc)),
+        ("core_repulsion", lambda p: swirl_string_core.calculate_core_repulsion(p, rc),
+         lambda p: swirl_string_core.calculate_core_repulsion_grad(p, rc)),
+        ("writhe", lambda p: swirl_string_core.calculate_writhe(p, rc),
+         lambda p: swirl_string_core.calculate_writhe_grad(p, rc)),
+        ("length", lambda p: swirl_string_core.calculate_length(p),
+         lambda p: swirl_string_core.calculate_length_grad(p)),
+    ]
+    results = {}
+    h = 1e-6
+    for name, energy, energy_grad in pairs:
+        value, grad = energy_grad(points)
+        assert value == energy(points)
+        assert grad.shape == (n, 3)
+        max_err = 0.0
+        for i in range(0, n, 7):
+            for c in range(3):
+                plus = points.copy()
+                minus = points.copy()
+                plus[i, c] += h
+                minus[i, c] -= h
+                fd = (energy(plus) - energy(minus)) / (2.0 * h)
+                max_err = max(max_err, abs(fd - grad[i, c]))
+        scale = max(1.0, float(np.max(np.abs(grad))))
+        assert max_err <= 1e-5 * scale, f"{name}: max |fd - grad| = {max_err}"
+        results[name] = f"value={value:.6e}, max|fd-grad|={max_err:.2e}"
+
+    log_test(
+        "calculate_*_grad",
+        formula,
+        {"points": f"Trefoil with {n} vertices", "rc": rc, "h": h},
+        results,
+        "Analytic closure-energy gradients agree with finite differences"
+    )
+
+
+def test_closure_energy_state():
+    """Incremental single-vertex/window deltas against full recomputation."""
+    n = 200
+    rc = 0.02
+    points = _trefoil(n)
+
+    formula = r"$\Delta E = \sum_{(i,j) \ni k} [f_{ij}(\mathbf{r}') - f_{ij}(\mathbf{r})]$"
+
+    state = swirl_string_core.ClosureEnergyState(points, rc)
+    rng = np.random.default_rng(7)
+    terms = ["neumann_self_energy", "core_repulsion", "writhe_reg",
+             "polyline_length", "curvature_penalty_menger"]
+    max_err = 0.0
+    for step in range(40):
+        count = 1 + step % 3
+        start = int(rng.integers(0, n))
+        idx = [(start + k) % n for k in range(count)]
+        current = state.positions()
+        moved = current[idx] + rng.normal(scale=0.01, size=(count, 3))
+        delta = state.propose(start, moved)
+        trial = current.copy()
+        trial[idx] = moved
+        full = swirl_string_core.calculate_closure_energies(trial, rc)
+        for name in terms:
+            expected = getattr(full, name) - getattr(state.energies, name)
+            max_err = max(max_err, abs(getattr(delta, name) - expected) / max(1.0, abs(getattr(full, name))))
+        if step % 2 == 0:
+            state.commit()
+        else:
+            state.reject()
+    assert max_err < 1e-10, f"max relative delta error {max_err}"
+
+    log_test(
+        "ClosureEnergyState.propose/commit/reject",
+        formula,
+        {"points": f"Trefoil with {n} vertices", "rc": rc, "moves": 40},
+        {"max_relative_error": max_err},
+        "O(n) energy deltas for local moves match full O(n^2) evaluation"
+    )
+
+
+def test_core_repulsion_cell_list():
+    """Cell-list core repulsion must equal the all-pairs sum exactly."""
+    n = 3000
+    points = _trefoil(n)
+
+    formula = r"$U_{rep} = \sum_{|i-j|\geq 2,\ d_{ij} < 20 r_c} (2 r_c / d_{ij})^{12}$"
+
+    results = {}
+    for rc in (1e-3, 5e-3, 0.05):
+        fast = swirl_string_core.calculate_core_repulsion(points, rc)
+        reference = swirl_string_core.calculate_core_repulsion_reference(points, rc)
+        fused = swirl_string_core.calculate_closure_energies(points, rc).core_repulsion
+        assert fast == reference, f"rc={rc}: {fast!r} != {reference!r}"
+        assert fused == reference, f"rc={rc}: fused {fused!r} != {reference!r}"
+        results[f"rc={rc}"] = fast
+
+    log_test(
+        "calculate_core_repulsion (cell list)",
+        formula,
+        {"points": f"Trefoil with {n} vertices", "rc": [1e-3, 5e-3, 0.05]},
+        results,
+        "Cutoff cell list reproduces the all-pairs repulsion bit for bit"
+    )
+
+
+def test_concurrent_kernels_release_gil():
+    """Kernels called from Python threads must run without the GIL and agree with serial calls."""
+    n = 2000
+    points = _trefoil(n)
+    g = np.linspace(-3.0, 3.0, 12)
+    X, Y, Z = np.meshgrid(g, g, g, indexing='ij')
+    grid = np.stack([X.ravel(), Y.ravel(), Z.ravel() + 0.05], axis=1)
+    rc = 5e-3
+
+    def evolve_trefoil():
+        system = swirl_string_core.VortexKnotSystem(1.0)
+        system.initialize_trefoil_knot(200)
+        system.evolve(1e-3, 5)
+        return np.asarray(system.get_positions())
+
+    kernels = {
+        "calculate_neumann_self_energy": lambda: swirl_string_core.calculate_neumann_self_energy(points, rc),
+        "calculate_writhe_grad": lambda: swirl_string_core.calculate_writhe_grad(points, rc)[1],
+        "biot_savart_velocity_grid": lambda: swirl_string_core.biot_savart_velocity_grid(points, grid),
+        "VortexKnotSystem.evolve": evolve_trefoil,
+    }
+    serial = {name: fn() for name, fn in kernels.items()}
+
+    # Four copies of every kernel at once; each must match its serial result.
+    jobs = [name for name in kernels for _ in range(4)]
+    with ThreadPoolExecutor(max_workers=8) as pool:
+        futures = [(name, pool.submit(kernels[name])) for name in jobs]
+        concurrent = [(name, f.result()) for name, f in futures]
+    for name, value in concurrent:
+        assert np.allclose(value, serial[name], rtol=1e-12, atol=0.0), name
+
+    # A pure-Python heartbeat keeps ticking while the main thread sits in a kernel.
+    beats = [0]
+    stop = threading.Event()
+
+    def heartbeat():
+        while not stop.is_set():
+            beats[0] += 1
+            time.sleep(1e-3)
+
+    ticker = threading.Thread(target=heartbeat)
+    ticker.start()
+    try:
+        start = beats[0]
+        for _ in range(3):
+            swirl_string_core.calculate_neumann_self_energy(points, rc)
+        during = beats[0] - start
+    finally:
+        stop.set()
+        ticker.join()
+    assert during > 0, "heartbeat thread starved: kernel held the GIL"
+
+    log_test(
+        "GIL release (concurrent kernels)",
+        r"$f_{\text{thread}}(x) = f_{\text{serial}}(x)$",
+        {"points": f"Trefoil with {n} vertices", "grid": f"{grid.shape[0]} points",
+         "jobs": len(jobs)},
+        {"kernels": list(kernels), "heartbeat_ticks_during_kernel": during},
+        "Kernels run concurrently from a ThreadPoolExecutor with the GIL released"
+    )
+
+
+def test_vec3_numpy_zero_copy():
+    """(N,3) arrays go in as views and come back as capsule-owned arrays."""
+    n = 400
+    curve = _trefoil(n)
+    g = np.linspace(-3.0, 3.0, 8)
+    X, Y, Z = np.meshgrid(g, g, g, indexing='ij')
+    grid = np.stack([X.ravel(), Y.ravel(), Z.ravel() + 0.05], axis=1)
+
+    formula = r"$\mathbf{v}(\mathbf{x}) = \frac{\Gamma}{4\pi}\oint\frac{d\mathbf{l}\times(\mathbf{x}-\mathbf{l})}{|\mathbf{x}-\mathbf{l}|^3}$"
+
+    reference = swirl_string_core.biot_savart_velocity_grid(curve, grid)
+    V = swirl_string_core.BiotSavart.compute_velocity(curve, grid)
+    assert isinstance(V, np.ndarray) and V.shape == (grid.shape[0], 3) and V.dtype == np.float64
+    assert V.base is not None, "result should own the C++ buffer through a capsule"
+    assert np.array_equal(V, reference)
+
+    # Lists, float32 and strided views are converted once and give the same answer.
+    V_list = swirl_string_core.BiotSavart.compute_velocity(curve.tolist(), grid.tolist())
+    V_f32 = swirl_string_core.BiotSavart.compute_velocity(curve.astype(np.float32), grid)
+    strided = np.asfortranarray(curve)
+    V_strided = swirl_string_core.BiotSavart.compute_velocity(strided, grid)
+    assert np.array_equal(V_list, reference)
+    assert np.array_equal(V_strided, reference)
+    assert np.array_equal(
+        V_f32, swirl_string_core.BiotSavart.compute_velocity(curve.astype(np.float32).astype(np.float64), grid))
+
+    wr_array = swirl_string_core.compute_writhe(curve)
+    wr_list = swirl_string_core.compute_writhe(curve.tolist())
+    assert wr_array == wr_list
+
+    # Results stay valid after the object that produced them is gone.
+    system = swirl_string_core.VortexKnotSystem(1.0)
+    system.initialize_trefoil_knot(100)
+    positions = system.get_positions()
+    del system
+    assert positions.shape == (100, 3) and np.all(np.isfinite(positions))
+
+    try:
+        swirl_string_core.BiotSavart.compute_velocity(np.zeros((4, 2)), grid)
+        raise AssertionError("(N,2) input must be rejected")
+    except TypeError:
+        pass
+
+    log_test(
+        "Vec3 NumPy views (BiotSavart.compute_velocity)",
+        formula,
+        {"curve": f"Trefoil with {n} vertices", "grid": f"{grid.shape[0]} points"},
+        {"shape": V.shape, "owns_capsule": V.base is not None, "writhe": wr_array},
+        "(N,3) float64 inputs are read in place; outputs own their buffers"
+    )
+
+
 if __name__ == "__main__":
     print("\n" + "="*80)
     print("BIOT-SAVART COMPREHENSIVE TEST SUITE")
@@ -260,6 +525,12 @@ if __name__ == "__main__":
     test_biot_savart_compute_vorticity()
     test_biot_savart_extract_interior()
     test_biot_savart_compute_invariants()
+    test_calculate_closure_energies()
+    test_calculate_closure_energy_gradients()
+    test_closure_energy_state()
+    test_core_repulsion_cell_list()
+    test_concurrent_kernels_release_gil()
+    test_vec3_numpy_zero_copy()
     
     print("\n" + "="*80)
     print("ALL TESTS COMPLETED")
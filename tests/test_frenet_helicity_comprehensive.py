@@ -94,6 +94,56 @@ def test_compute_frenet_frames():
     )
 
 
+def test_compute_bishop_frames():
+    """Test closed-curve parallel-transport frames against the analytic trefoil."""
+    n = 400
+    t = 2.0 * np.pi * np.arange(n) / n
+    X = np.stack([np.sin(t) + 2*np.sin(2*t), np.cos(t) - 2*np.cos(2*t), -np.sin(3*t)], axis=1)
+    d1 = np.stack([np.cos(t) + 4*np.cos(2*t), -np.sin(t) + 4*np.sin(2*t), -3*np.cos(3*t)], axis=1)
+    d2 = np.stack([-np.sin(t) - 8*np.sin(2*t), -np.cos(t) + 8*np.cos(2*t), 9*np.sin(3*t)], axis=1)
+    d3 = np.stack([-np.cos(t) - 16*np.cos(2*t), np.sin(t) - 16*np.sin(2*t), 27*np.cos(3*t)], axis=1)
+    c = np.cross(d1, d2)
+    kappa_exact = np.linalg.norm(c, axis=1) / np.linalg.norm(d1, axis=1)**3
+    tau_exact = np.einsum("ij,ij->i", c, d3) / np.einsum("ij,ij->i", c, c)
+
+    formula = r"$\mathbf{U}_{i+1} = R_2 R_1 \mathbf{U}_i, \quad \tau = \frac{d\theta}{ds} - \frac{\Phi}{L}, \quad \theta = \angle(\mathbf{N}, \mathbf{U})$"
+
+    frames = swirl_string_core.compute_bishop_frames(X.tolist())
+    T, U, V = (np.asarray(frames[k]) for k in ("T", "U", "V"))
+    results = {
+        "max_rel_curvature_error": float(np.max(np.abs(np.asarray(frames["curvature"]) - kappa_exact) / kappa_exact)),
+        "max_torsion_error": float(np.max(np.abs(np.asarray(frames["torsion"]) - tau_exact))),
+        "orthonormality_error": float(max(np.max(np.abs(np.einsum("ij,ij->i", T, U))),
+                                          np.max(np.abs(np.linalg.norm(U, axis=1) - 1.0)),
+                                          np.max(np.abs(np.cross(T, U) - V)))),
+        # The closing edge must not be a frame jump after the holonomy correction.
+        "closing_step_vs_max_step": float(np.linalg.norm(U[0] - U[-1]) /
+                                          np.max(np.linalg.norm(np.diff(U, axis=0), axis=1))),
+        "holonomy": frames["holonomy"],
+    }
+
+    log_test(
+        "compute_bishop_frames",
+        formula,
+        {"X": f"Trefoil (sin t + 2 sin 2t, cos t - 2 cos 2t, -sin 3t) with {n} points"},
+        results,
+        "Parallel-transport frames, curvature and torsion of a closed curve in one pass"
+    )
+    assert results["max_rel_curvature_error"] < 1e-3, results
+    assert results["max_torsion_error"] < 1e-3, results
+    assert results["orthonormality_error"] < 1e-12, results
+    assert results["closing_step_vs_max_step"] < 1.5, results
+
+    # Straight edges: frames stay finite and the planar square has no torsion.
+    square = [[u, 0, 0] for u in np.linspace(0, 1, 10, endpoint=False)]
+    square += [[1, u, 0] for u in np.linspace(0, 1, 10, endpoint=False)]
+    square += [[1 - u, 1, 0] for u in np.linspace(0, 1, 10, endpoint=False)]
+    square += [[0, 1 - u, 0] for u in np.linspace(0, 1, 10, endpoint=False)]
+    flat = swirl_string_core.compute_bishop_frames(square)
+    assert np.all(np.isfinite(flat["U"]))
+    assert np.max(np.abs(flat["torsion"])) == 0.0
+
+
 def test_compute_curvature_torsion():
     """Test curvature and torsion computation."""
     # Create tangent and normal vectors
@@ -173,18 +223,44 @@ def test_evolve_vortex_knot():
 
 
 def test_rk4_integrate():
-    """Test RK4 integration."""
-    formula = r"$\mathbf{r}_{n+1} = \mathbf{r}_n + \frac{\Delta t}{6}(\mathbf{k}_1 + 2\mathbf{k}_2 + 2\mathbf{k}_3 + \mathbf{k}_4)$"
-    
-    print("\n" + "="*80)
-    print("Testing: rk4_integrate")
-    print("-"*80)
-    print("LaTeX Formula:")
-    print(f"  {formula}")
-    print("-"*80)
-    print("Note: This function requires specific integration setup.")
-    print("Please refer to implementation for usage.")
-    print("="*80)
+    """A circular ring translates along its axis at its discrete Biot-Savart speed."""
+    n, radius, gamma, dt = 64, 1.0, 1.0, 0.05
+    s = 2.0 * np.pi * np.arange(n) / n
+    ring = np.column_stack([radius * np.cos(s), radius * np.sin(s), np.zeros(n)])
+    tangents = np.column_stack([-np.sin(s), np.cos(s), np.zeros(n)])
+
+    # Segment vectors (X[i+1] - X[i-1]) / 2 of a regular N-gon give, at every node,
+    #   U = Gamma / (4 pi) * sum_{j=1}^{N-1} sin(2 pi / N) / (4 R sin(pi j / N)).
+    j = np.arange(1, n)
+    expected_speed = gamma / (4.0 * np.pi) * np.sum(np.sin(2.0 * np.pi / n) / (4.0 * radius * np.sin(np.pi * j / n)))
+
+    moved = np.asarray(swirl_string_core.rk4_integrate(ring.tolist(), tangents.tolist(), dt, gamma))
+    ignored = np.asarray(swirl_string_core.rk4_integrate(ring.tolist(), np.zeros((n, 3)).tolist(), dt, gamma))
+    step = moved - ring
+    try:
+        swirl_string_core.rk4_integrate(ring.tolist(), tangents[:-1].tolist(), dt, gamma)
+        mismatch_raised = False
+    except ValueError:
+        mismatch_raised = True
+
+    formula = r"$\mathbf{r}_{n+1} = \mathbf{r}_n + \frac{\Delta t}{6}(\mathbf{k}_1 + 2\mathbf{k}_2 + 2\mathbf{k}_3 + \mathbf{k}_4), \quad U = \frac{\Gamma}{4\pi}\sum_{j=1}^{N-1} \frac{\sin(2\pi/N)}{4R\sin(\pi j/N)}$"
+    log_test(
+        "rk4_integrate",
+        formula,
+        {"n": n, "radius": radius, "gamma": gamma, "dt": dt},
+        {"expected_dz": expected_speed * dt, "mean_dz": float(step[:, 2].mean()),
+         "max_dz_err": float(np.max(np.abs(step[:, 2] - expected_speed * dt))),
+         "max_in_plane": float(np.max(np.abs(step[:, :2]))),
+         "tangents_ignored": bool(np.array_equal(moved, ignored)),
+         "mismatch_raised": mismatch_raised},
+        "Rigid translation at the discrete ring speed; every RK4 stage uses the same segment vectors"
+    )
+
+    assert np.allclose(step[:, 2], expected_speed * dt, rtol=1e-10, atol=0.0)
+    assert np.max(np.abs(step[:, :2])) < 1e-12
+    assert np.array_equal(moved, ignored)
+    assert mismatch_raised
+    assert np.allclose(swirl_string_core.evolve_vortex_knot(ring.tolist(), tangents.tolist(), dt, gamma), moved)
 
 
 if __name__ == "__main__":
@@ -193,6 +269,7 @@ if __name__ == "__main__":
     print("="*80)
     
     test_compute_frenet_frames()
+    test_compute_bishop_frames()
     test_compute_curvature_torsion()
     test_compute_helicity()
     test_evolve_vortex_knot()
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+"""
+Comprehensive test suite for the native job system (submit / Job).
+Tests all functions with LaTeX formulas, inputs, and results logged.
+"""
+
+import sys
+import os
+import asyncio
+import concurrent.futures
+import threading
+import numpy as np
+
+# Add build directory to path
+build_dir = os.path.join(os.path.dirname(__file__), "../build/Debug")
+if os.path.exists(build_dir):
+    sys.path.insert(0, build_dir)
+
+try:
+    import swirl_string_core
+    HAS_SST = True
+except ImportError:
+    try:
+        import sstbindings as swirl_string_core
+        HAS_SST = True
+    except ImportError:
+        print("ERROR: Could not import swirl_string_core or sstbindings")
+        sys.exit(1)
+
+
+def log_test(func_name, latex_formula, inputs_dict, results, description=""):
+    """Log test information in structured format."""
+    print("\n" + "="*80)
+    print(f"Testing: {func_name}")
+    if description:
+        print(f"Description: {description}")
+    print("-"*80)
+    print("LaTeX Formula:")
+    print(f"  {latex_formula}")
+    print("-"*80)
+    print("Inputs:")
+    for key, value in inputs_dict.items():
+        if isinstance(value, (list, np.ndarray)):
+            if hasattr(value, 'shape'):
+                print(f"  {key} = array of shape {value.shape}")
+            elif len(value) > 5:
+                print(f"  {key} = {type(value).__name__} of length {len(value)}")
+                print(f"    First 3: {value[:3]}")
+            else:
+                print(f"  {key} = {value}")
+        else:
+            print(f"  {key} = {value}")
+    print("-"*80)
+    print("Results:")
+    if isinstance(results, (list, tuple, np.ndarray)):
+        if isinstance(results, tuple) and len(results) > 1:
+            for i, r in enumerate(results):
+                if isinstance(r, (list, np.ndarray)):
+                    if hasattr(r, 'shape'):
+                        print(f"  Result[{i}]: shape {r.shape}")
+                    elif len(r) > 5:
+                        print(f"  Result[{i}]: length {len(r)}")
+                    else:
+                        print(f"  Result[{i}]: {r}")
+                else:
+                    print(f"  Result[{i}]: {r}")
+        elif hasattr(results, 'shape'):
+            print(f"  Shape: {results.shape}")
+        elif len(results) > 5:
+            print(f"  Type: {type(results).__name__} of length {len(results)}")
+            print(f"  First 3: {results[:3]}")
+        else:
+            print(f"  {results}")
+    else:
+        print(f"  {results}")
+    print("="*80)
+
+
+def _trefoil(resolution=120):
+    system = swirl_string_core.VortexKnotSystem(1.0)
+    system.initialize_trefoil_knot(resolution)
+    return system
+
+
+def _rings():
+    s = 2.0 * np.pi * np.arange(60) / 60
+    return [np.column_stack([np.cos(s), np.sin(s), np.zeros(60)]),
+            np.column_stack([1.2 + np.cos(s), np.zeros(60), np.sin(s)])]
+
+
+def test_submit_matches_blocking_call():
+    """A submitted evolve/relax gives exactly the blocking result."""
+    reference = _trefoil()
+    reference.evolve(1e-3, 20)
+
+    system = _trefoil()
+    called = threading.Event()
+    job = swirl_string_core.submit("VortexKnotSystem.evolve", system=system, dt=1e-3, steps=20)
+    job.add_done_callback(lambda j: called.set())
+    returned = job.result(timeout=600)
+
+    relaxed = swirl_string_core.ParticleEvaluator(_rings())
+    relaxed.relax(iterations=40, timestep=0.01)
+    relax_job = swirl_string_core.submit("ParticleEvaluator.relax",
+                                         evaluator=swirl_string_core.ParticleEvaluator(_rings()),
+                                         iterations=40, timestep=0.01)
+    relax_identical = all(np.array_equal(a, b) for a, b in
+                          zip(relaxed.get_filaments(), relax_job.result().get_filaments()))
+
+    log_test(
+        "submit / Job.result",
+        r"$\mathrm{submit}(f, x).\mathrm{result}() = f(x)$",
+        {"functions": swirl_string_core.job_functions()},
+        {"status": job.status, "progress": job.progress(), "relax_identical": relax_identical},
+        "Jobs run the same native code on a worker thread without the GIL"
+    )
+
+    assert returned is system and job.done() and job.status == "finished"
+    assert job.progress() == 1.0 and called.wait(5.0)
+    assert np.array_equal(system.get_positions(), reference.get_positions())
+    assert relax_identical
+
+    for bad in (lambda: swirl_string_core.submit("no_such_function"),
+                lambda: swirl_string_core.submit("VortexKnotSystem.evolve", system=system, dt=1e-3)):
+        try:
+            bad()
+            raise AssertionError("invalid submit() must raise")
+        except (ValueError, TypeError):
+            pass
+    try:
+        swirl_string_core.submit("VortexKnotSystem.evolve", system=system, dt=1e-3, steps=1, stpes=2)
+        raise AssertionError("misspelled argument must raise")
+    except TypeError:
+        pass
+
+
+def test_cancel_then_resume():
+    """cancel() stops an evolve between steps; resume_evolve() finishes it exactly."""
+    steps = 400
+    reference = _trefoil()
+    reference.evolve(1e-3, steps)
+
+    system = _trefoil()
+    job = swirl_string_core.submit("VortexKnotSystem.evolve", system=system, dt=1e-3, steps=steps)
+    while job.progress() == 0.0 and not job.done():
+        job.wait(timeout=0.01)
+    cancelled = job.cancel()
+    job.wait()
+    if cancelled:
+        assert job.cancelled() and system.has_pending_evolve
+        try:
+            job.result()
+            raise AssertionError("result() of a cancelled job must raise")
+        except concurrent.futures.CancelledError:
+            pass
+        stopped_at = job.progress()
+        system.resume_evolve()
+    else:
+        stopped_at = 1.0
+
+    log_test(
+        "Job.cancel",
+        r"$\mathbf{X}_{cancel+resume}(t_{end}) \equiv \mathbf{X}_{reference}(t_{end})$",
+        {"steps": steps},
+        {"cancelled": cancelled, "stopped_at": stopped_at},
+        "Cancellation is checked after every accepted step; the call stays resumable"
+    )
+
+    assert np.array_equal(system.get_positions(), reference.get_positions())
+
+
+def test_asyncio_gather():
+    """Jobs are awaitable and run concurrently under asyncio.gather."""
+    systems = [_trefoil(100) for _ in range(4)]
+
+    async def main():
+        jobs = [swirl_string_core.submit("VortexKnotSystem.evolve", system=s, dt=1e-3, steps=10)
+                for s in systems]
+        return await asyncio.gather(*jobs)
+
+    results = asyncio.run(main())
+    reference = _trefoil(100)
+    reference.evolve(1e-3, 10)
+
+    log_test(
+        "await Job",
+        r"$\mathrm{gather}(\mathrm{submit}(f, x_i)) = [f(x_i)]_i$",
+        {"jobs": len(systems)},
+        {"returned": len(results)},
+        "asyncio.wrap_future over the native job handle"
+    )
+
+    assert all(r is s for r, s in zip(results, systems))
+    assert all(np.array_equal(s.get_positions(), reference.get_positions()) for s in systems)
+
+
+if __name__ == "__main__":
+    print("\n" + "="*80)
+    print("JOB SYSTEM COMPREHENSIVE TEST SUITE")
+    print("="*80)
+
+    test_submit_matches_blocking_call()
+    test_cancel_then_resume()
+    test_asyncio_gather()
+
+    print("\n" + "="*80)
+    print("ALL TESTS COMPLETED")
+    print("="*80)
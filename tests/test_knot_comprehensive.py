@@ -392,6 +392,172 @@ def test_vortex_knot_system():
     )
 
 
+def test_remesh_closed_curve():
+    """Arclength/curvature remeshing of closed filaments."""
+    n = 64
+    u = np.arange(n) / n
+    s = 2.0 * np.pi * (u + 0.12 * np.sin(2.0 * np.pi * u))  # clustered circle
+    circle = np.column_stack([np.cos(s), np.sin(s), np.zeros(n)])
+
+    points, report = swirl_string_core.remesh_closed_curve(circle)
+    spacing = np.linalg.norm(np.roll(points, -1, axis=0) - points, axis=1)
+    radius_err = np.max(np.abs(np.linalg.norm(points[:, :2], axis=1) - 1.0))
+
+    system = swirl_string_core.VortexKnotSystem(1.0)
+    system.initialize_trefoil_knot(100)
+    system.set_remeshing(5, max_turn_angle=0.1)
+    refined = system.remesh()
+    again = system.remesh()
+    system.set_integrator("rk4")
+    system.evolve(0.01, 10)
+
+    formula = r"$\int_0^{s_k} \frac{ds}{h(s)} = k\,\frac{1}{M}\oint \frac{ds}{h(s)},\quad h = \mathrm{clamp}(\min(h_0, \theta_{max}/\kappa), h_{min}, h_{max})$"
+    log_test(
+        "remesh_closed_curve",
+        formula,
+        {"n": n, "max_turn_angle": 0.1},
+        {"circle_count": report.new_count, "spacing_spread": float(spacing.max() - spacing.min()),
+         "radius_err": float(radius_err), "trefoil": (refined.old_count, refined.new_count),
+         "after_evolve": len(system.get_positions())},
+        "Periodic cubic spline redistribution with a curvature monitor"
+    )
+
+    assert report.new_count == n
+    assert np.allclose(points[0], circle[0])
+    assert spacing.max() - spacing.min() < 1e-2 * spacing.mean()
+    assert radius_err < 1e-4
+    assert refined.new_count > refined.old_count
+    assert again.new_count == refined.new_count  # resolved spacing does not ratchet
+    assert len(system.get_tangents()) == len(system.get_positions())
+
+
+def test_trajectory_writer():
+    """Native trajectory recording to a memory-mappable .npy file."""
+    import tempfile
+
+    path = os.path.join(tempfile.mkdtemp(), "trefoil_traj.npy")
+    system = swirl_string_core.VortexKnotSystem(1.0)
+    system.initialize_trefoil_knot(120)
+    writer = swirl_string_core.TrajectoryWriter(path, 120, every=5, tangents=True, diagnostics=True,
+                                                chunk_frames=3)
+    system.attach_trajectory(writer)
+    system.evolve(0.01, 20)
+    final = np.array(system.get_positions())
+    writer.close()
+
+    traj = np.load(path, mmap_mode="r")
+    names = swirl_string_core.TrajectoryWriter.diagnostic_names()
+    length = traj["diagnostics"][:, names.index("length")]
+
+    formula = r"$\{(t_k, \mathbf{X}(t_k), \mathbf{T}(t_k))\}_{k},\quad t_k = k\,m\,\Delta t$"
+    log_test(
+        "TrajectoryWriter",
+        formula,
+        {"n_points": 120, "dt": 0.01, "steps": 20, "every": 5},
+        {"shape": traj.shape, "fields": traj.dtype.names, "time": traj["time"].tolist(),
+         "length_drift": float(length[-1] - length[0])},
+        "Frames streamed from a background I/O thread, read back with np.load(mmap_mode='r')"
+    )
+
+    assert isinstance(traj, np.memmap)
+    assert traj.shape == (5,)  # initial state + steps 5, 10, 15, 20
+    assert traj["positions"].shape == (5, 120, 3)
+    assert np.allclose(traj["time"], [0.0, 0.05, 0.10, 0.15, 0.20])
+    assert np.array_equal(traj["positions"][-1], final)
+    assert np.allclose(traj["diagnostics"][:, 1:4].mean(axis=0), traj["positions"].mean(axis=1).mean(axis=0))
+    assert abs(system.get_time() - 0.2) < 1e-12
+
+
+def test_trajectory_rejects_remeshing():
+    """A fixed-N trajectory and remeshing cannot be combined; evolve() never fails midway."""
+    import tempfile
+
+    path = os.path.join(tempfile.mkdtemp(), "remesh_traj.npy")
+    system = swirl_string_core.VortexKnotSystem(1.0)
+    system.initialize_trefoil_knot(100)
+    writer = swirl_string_core.TrajectoryWriter(path, 100, every=1)
+
+    system.set_remeshing(5, max_turn_angle=0.1)
+    errors = {}
+    try:
+        system.attach_trajectory(writer)
+    except ValueError as e:
+        errors["attach_while_remeshing"] = str(e)
+    system.set_remeshing(0)
+    system.attach_trajectory(writer)
+    try:
+        system.set_remeshing(5, max_turn_angle=0.1)
+    except ValueError as e:
+        errors["set_remeshing_while_attached"] = str(e)
+    try:
+        system.remesh()
+    except RuntimeError as e:
+        errors["remesh_while_attached"] = str(e)
+    system.evolve(0.01, 3)
+    system.attach_trajectory(None)
+    writer.close()
+    traj = np.load(path, mmap_mode="r")
+
+    log_test(
+        "VortexKnotSystem.attach_trajectory + set_remeshing",
+        r"$N(t) = N(0)\ \text{for every recorded frame}$",
+        {"n_points": 100, "remesh_every": 5},
+        {"errors": errors, "frames": traj.shape[0], "n_points": len(system.get_positions())},
+        "Both orders are refused up front instead of throwing from evolve()"
+    )
+
+    assert set(errors) == {"attach_while_remeshing", "set_remeshing_while_attached", "remesh_while_attached"}
+    assert traj.shape == (4,) and traj["positions"].shape == (4, 100, 3)
+    assert len(system.get_positions()) == 100
+
+
+def test_checkpoint_restart():
+    """Snapshots taken inside evolve()/relax() resume bit-identically."""
+    import tempfile
+
+    tmp = tempfile.mkdtemp()
+    knot_path = os.path.join(tmp, "knot.sstsnap")
+    reference = swirl_string_core.VortexKnotSystem(1.0)
+    reference.initialize_trefoil_knot(120)
+    reference.set_integrator("rk4")
+    reference.set_induction("hybrid", local_window=4, far_field_interval=3)
+    reference.set_checkpointing(knot_path, 7)
+    reference.evolve(0.01, 30)  # last snapshot after step 28
+
+    resumed = swirl_string_core.VortexKnotSystem(checkpoint=knot_path)
+    pending = resumed.has_pending_evolve
+    t_snapshot = resumed.get_time()
+    resumed.resume_evolve()
+    knot_identical = np.array_equal(np.array(resumed.get_positions()), np.array(reference.get_positions()))
+
+    relax_path = os.path.join(tmp, "relax.sstsnap")
+    s = 2.0 * np.pi * np.arange(60) / 60
+    rings = [np.column_stack([np.cos(s), np.sin(s), np.zeros(60)]).tolist(),
+             np.column_stack([1.2 + np.cos(s), np.zeros(60), np.sin(s)]).tolist()]
+    relaxed = swirl_string_core.ParticleEvaluator(rings)
+    relaxed.set_checkpointing(relax_path, 25)
+    relaxed.relax(iterations=60, timestep=0.01)
+    restarted = swirl_string_core.ParticleEvaluator(checkpoint=relax_path)
+    restart_iteration = restarted.relaxation_iteration
+    restarted.resume_relaxation()
+    relax_identical = all(np.array_equal(np.array(a), np.array(b))
+                          for a, b in zip(relaxed.get_filaments(), restarted.get_filaments()))
+
+    log_test(
+        "VortexKnotSystem.save_checkpoint / ParticleEvaluator.save_checkpoint",
+        r"$\mathbf{X}_{resumed}(t_{end}) \equiv \mathbf{X}_{reference}(t_{end})$",
+        {"knot_every": 7, "knot_steps": 30, "relax_every": 25, "relax_iterations": 60},
+        {"snapshot_time": t_snapshot, "knot_identical": knot_identical,
+         "restart_iteration": restart_iteration, "relax_identical": relax_identical},
+        "Versioned snapshots with integrator progress, FSAL data and relaxation velocities"
+    )
+
+    assert pending and abs(t_snapshot - 0.28) < 1e-12
+    assert knot_identical
+    assert restart_iteration == 50
+    assert relax_identical and not restarted.has_pending_relaxation
+
+
 if __name__ == "__main__":
     print("\n" + "="*80)
     print("KNOT DYNAMICS COMPREHENSIVE TEST SUITE")
@@ -405,6 +571,10 @@ if __name__ == "__main__":
     test_pd_from_curve()
     test_estimate_crossing_number()
     test_vortex_knot_system()
+    test_remesh_closed_curve()
+    test_trajectory_writer()
+    test_trajectory_rejects_remeshing()
+    test_checkpoint_restart()
     
     print("\n" + "="*80)
     print("ALL TESTS COMPLETED")
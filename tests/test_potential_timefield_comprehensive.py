@@ -93,6 +93,40 @@ def test_compute_gravitational_potential_gradient():
     )
 
 
+def test_gauss_sum_methods():
+    """Cutoff grid and fast Gauss transform against the all-pairs sum."""
+    rng = np.random.default_rng(3)
+    n = 1500
+    positions = rng.uniform(-1.0, 1.0, size=(n, 3)).tolist()
+    vorticity = rng.normal(size=(n, 3)).tolist()
+
+    formula = r"$\Phi_i = -\tfrac{1}{2}\Big|\sum_{j \ne i} e^{-|\mathbf{r}_i-\mathbf{r}_j|^2/2\epsilon^2}\,\boldsymbol{\omega}_j\Big|^2$"
+
+    results = {}
+    for epsilon, methods in ((0.05, ("cutoff",)), (2.0, ("cutoff", "fgt"))):
+        exact = np.asarray(swirl_string_core.compute_gravitational_potential_gradient(
+            positions, vorticity, epsilon, method="direct"))
+        scale = np.max(np.abs(exact))
+        for method in methods + ("auto",):
+            approx = np.asarray(swirl_string_core.compute_gravitational_potential_gradient(
+                positions, vorticity, epsilon, method=method))
+            results[f"eps={epsilon} {method}"] = float(np.max(np.abs(approx - exact)) / scale)
+        results[f"eps={epsilon} selected"] = swirl_string_core.select_gauss_sum_method(positions, epsilon)
+
+    log_test(
+        "compute_gravitational_potential_gradient(method=...)",
+        formula,
+        {"n": n, "epsilon": [0.05, 2.0], "tolerance": 1e-10},
+        results,
+        "Max relative error of the cutoff grid and fast Gauss transform; auto picks the cheaper"
+    )
+    for key, value in results.items():
+        if not key.endswith("selected"):
+            assert value < 1e-8, (key, value)
+    assert results["eps=0.05 selected"] == "cutoff", results
+    assert results["eps=2.0 selected"] == "fgt", results
+
+
 def test_compute_time_dilation_map_sqrt():
     """Test time dilation (sqrt method)."""
     tangents = [
@@ -150,6 +184,90 @@ def test_compute_gravitational_potential_direct():
     )
 
 
+
+def test_gravitational_potential_direct_tree():
+    """Treecode and batched targets against the all-pairs dipole sum."""
+    rng = np.random.default_rng(5)
+    n = 4000
+    positions = rng.uniform(-1.0, 1.0, size=(n, 3)).tolist()
+    vorticity = rng.normal(size=(n, 3)).tolist()
+    targets = [[x, y, z] for x in np.linspace(-1.5, 1.5, 12)
+               for y in np.linspace(-1.5, 1.5, 12) for z in np.linspace(-1.5, 1.5, 12)]
+    epsilon = 0.1
+
+    formula = r"$\Phi(\mathbf{x}) = -\frac{1}{4\pi}\sum_j \frac{(\mathbf{x}-\mathbf{r}_j)\cdot\boldsymbol{\omega}_j}{(|\mathbf{x}-\mathbf{r}_j|^2+\epsilon^2)^{3/2}}$"
+
+    exact = np.asarray(swirl_string_core.compute_gravitational_potential_direct(
+        positions, vorticity, epsilon, method="direct"))
+    tree = np.asarray(swirl_string_core.compute_gravitational_potential_direct(
+        positions, vorticity, epsilon, method="tree"))
+    coarse = np.asarray(swirl_string_core.compute_gravitational_potential_direct(
+        positions, vorticity, epsilon, method="tree", theta=0.7, order=4))
+    grid_exact = np.asarray(swirl_string_core.compute_gravitational_potential_direct_at(
+        targets, positions, vorticity, epsilon, method="direct"))
+    grid_tree = np.asarray(swirl_string_core.compute_gravitational_potential_direct_at(
+        targets, positions, vorticity, epsilon, method="tree"))
+    at_sources = np.asarray(swirl_string_core.compute_gravitational_potential_direct_at(
+        positions, positions, vorticity, epsilon, method="direct"))
+
+    scale = np.max(np.abs(exact))
+    grid_scale = np.max(np.abs(grid_exact))
+    results = {
+        "tree_rel_err": float(np.max(np.abs(tree - exact)) / scale),
+        "coarse_rel_err": float(np.max(np.abs(coarse - exact)) / scale),
+        "grid_tree_rel_err": float(np.max(np.abs(grid_tree - grid_exact)) / grid_scale),
+        "at_sources_max_diff": float(np.max(np.abs(at_sources - exact))),
+    }
+
+    log_test(
+        "compute_gravitational_potential_direct(method=\"tree\") / _direct_at",
+        formula,
+        {"n": n, "grid": "12^3", "epsilon": epsilon, "theta": [0.4, 0.7], "order": [10, 4]},
+        results,
+        "Barnes-Hut treecode error relative to max |phi|; targets at the sources reproduce the self sum"
+    )
+    assert results["tree_rel_err"] < 1e-5, results
+    assert results["grid_tree_rel_err"] < 1e-5, results
+    assert results["tree_rel_err"] < results["coarse_rel_err"] < 1e-1, results
+    assert results["at_sources_max_diff"] < 1e-9 * scale, results
+
+def test_gravitational_potential_direct_zero_epsilon():
+    """epsilon = 0 skips each point's own term instead of producing 0/0."""
+    rng = np.random.default_rng(11)
+    n = 300
+    positions = rng.uniform(-1.0, 1.0, size=(n, 3))
+    vorticity = rng.normal(size=(n, 3))
+
+    reference = np.zeros(n)
+    for i in range(n):
+        d = positions[i] - np.delete(positions, i, axis=0)
+        w = np.delete(vorticity, i, axis=0)
+        r2 = np.sum(d * d, axis=1)
+        reference[i] = -np.sum(np.sum(d * w, axis=1) / r2 ** 1.5) / (4.0 * np.pi)
+
+    direct = np.asarray(swirl_string_core.compute_gravitational_potential_direct(
+        positions.tolist(), vorticity.tolist(), 0.0, method="direct"))
+    tree = np.asarray(swirl_string_core.compute_gravitational_potential_direct(
+        positions.tolist(), vorticity.tolist(), 0.0, method="tree"))
+
+    scale = np.max(np.abs(reference))
+    results = {
+        "direct_finite": bool(np.all(np.isfinite(direct))),
+        "tree_finite": bool(np.all(np.isfinite(tree))),
+        "direct_rel_err": float(np.max(np.abs(direct - reference)) / scale),
+        "tree_rel_err": float(np.max(np.abs(tree - reference)) / scale),
+    }
+    log_test(
+        "compute_gravitational_potential_direct(epsilon=0)",
+        r"$\Phi_i = -\frac{1}{4\pi}\sum_{j \ne i} \frac{(\mathbf{r}_i-\mathbf{r}_j)\cdot\boldsymbol{\omega}_j}{|\mathbf{r}_i-\mathbf{r}_j|^3}$",
+        {"n": n, "epsilon": 0.0},
+        results,
+        "Unsoftened kernel matches the explicit j != i sum"
+    )
+    assert results["direct_finite"] and results["tree_finite"], results
+    assert results["direct_rel_err"] < 1e-12, results
+    assert results["tree_rel_err"] < 1e-5, results
+
 def test_compute_time_dilation_map_linear():
     """Test time dilation (linear method)."""
     tangents = [
@@ -234,8 +352,11 @@ if __name__ == "__main__":
     print("="*80)
     
     test_compute_gravitational_potential_gradient()
+    test_gauss_sum_methods()
     test_compute_time_dilation_map_sqrt()
     test_compute_gravitational_potential_direct()
+    test_gravitational_potential_direct_tree()
+    test_gravitational_potential_direct_zero_epsilon()
     test_compute_time_dilation_map_linear()
     test_compute_gravitational_potential()
     test_compute_time_dilation_map()
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""
+Comprehensive test suite for the built-in stage profiler (sstcore.profiler).
+Tests all functions with LaTeX formulas, inputs, and results logged.
+"""
+
+import sys
+import os
+import json
+import tempfile
+import numpy as np
+
+# Add build directory to path
+build_dir = os.path.join(os.path.dirname(__file__), "../build/Debug")
+if os.path.exists(build_dir):
+    sys.path.insert(0, build_dir)
+
+try:
+    import swirl_string_core
+    HAS_SST = True
+except ImportError:
+    try:
+        import sstbindings as swirl_string_core
+        HAS_SST = True
+    except ImportError:
+        print("ERROR: Could not import swirl_string_core or sstbindings")
+        sys.exit(1)
+
+profiler = swirl_string_core.profiler
+
+
+def log_test(func_name, latex_formula, inputs_dict, results, description=""):
+    """Log test information in structured format."""
+    print("\n" + "="*80)
+    print(f"Testing: {func_name}")
+    if description:
+        print(f"Description: {description}")
+    print("-"*80)
+    print("LaTeX Formula:")
+    print(f"  {latex_formula}")
+    print("-"*80)
+    print("Inputs:")
+    for key, value in inputs_dict.items():
+        print(f"  {key} = {value}")
+    print("-"*80)
+    print("Results:")
+    if isinstance(results, dict):
+        for key, value in results.items():
+            print(f"  {key}: {value}")
+    else:
+        print(f"  {results}")
+    print("="*80)
+
+
+def _trefoil_block():
+    block = swirl_string_core.FourierBlock()
+    block.a_x = [1.0, 0.0]
+    block.b_x = [0.0, 2.0]
+    block.a_y = [0.0, 1.0]
+    block.b_y = [1.0, 0.0]
+    block.a_z = [0.0, 0.0]
+    block.b_z = [0.0, 1.0]
+    return block
+
+
+def _rings():
+    s = 2.0 * np.pi * np.arange(60) / 60
+    return [np.column_stack([np.cos(s), np.sin(s), np.zeros(60)]),
+            np.column_stack([1.2 + np.cos(s), np.zeros(60), np.sin(s)])]
+
+
+def test_disabled_by_default():
+    """Nothing is recorded while the profiler is off."""
+    profiler.disable()
+    profiler.reset()
+    swirl_string_core.compute_helicity_from_fourier_block(
+        _trefoil_block(), grid_size=16, spacing=0.3, interior_margin=2, nsamples=200)
+    stats = profiler.stats()
+    log_test(
+        "profiler.stats (disabled)",
+        r"$\mathrm{stats}() = \emptyset$",
+        {"is_enabled": profiler.is_enabled()},
+        {"stages": len(stats)},
+        "Disabled scopes only read one atomic flag"
+    )
+    assert not profiler.is_enabled()
+    assert stats == {}
+
+
+def test_helicity_and_relax_stages():
+    """Every helicity phase and relax iteration phase is counted."""
+    iterations = 15
+    profiler.reset()
+    profiler.enable()
+    try:
+        swirl_string_core.compute_helicity_from_fourier_block(
+            _trefoil_block(), grid_size=16, spacing=0.3, interior_margin=2, nsamples=200)
+        evaluator = swirl_string_core.ParticleEvaluator(_rings())
+        evaluator.relax(iterations=iterations, timestep=0.01)
+    finally:
+        profiler.disable()
+    stats = profiler.stats()
+    log_test(
+        "profiler.stats",
+        r"$T_{stage} = \sum_{calls} \Delta t, \quad N_{pairs}(\mathrm{helicity.biot\_savart}) = M \cdot G^3$",
+        {"grid_size": 16, "nsamples": 200, "iterations": iterations},
+        {k: (round(v["total_s"], 6), v["calls"], v["pairs"]) for k, v in stats.items()},
+        "Per-stage wall time, call counts and pair counts"
+    )
+    for stage in ("helicity.from_fourier_block", "helicity.sample_curve", "helicity.grid",
+                  "helicity.biot_savart", "helicity.curl", "helicity.interior",
+                  "helicity.invariants", "relax.run", "relax.centroid", "relax.forces",
+                  "relax.integrate", "relax.horn_scaling"):
+        assert stage in stats, stage
+        assert stats[stage]["total_s"] >= 0.0
+    assert stats["helicity.from_fourier_block"]["calls"] == 1
+    assert stats["helicity.biot_savart"]["pairs"] == 200 * 16 ** 3
+    assert stats["relax.forces"]["calls"] == iterations
+    assert stats["relax.forces"]["pairs"] == iterations * 120 * 120
+    assert stats["helicity.from_fourier_block"]["total_s"] >= stats["helicity.biot_savart"]["total_s"]
+    s = stats["relax.forces"]
+    assert abs(s["mean_s"] - s["total_s"] / s["calls"]) < 1e-12
+
+    profiler.reset()
+    assert profiler.stats() == {}
+
+
+def test_chrome_trace_export():
+    """enable(trace=True) records complete events readable as trace-event JSON."""
+    profiler.reset()
+    profiler.enable(trace=True, max_trace_events=50)
+    try:
+        evaluator = swirl_string_core.ParticleEvaluator(_rings())
+        evaluator.relax(iterations=40, timestep=0.01)
+    finally:
+        profiler.disable()
+    count = profiler.trace_event_count()
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, "trace.json")
+        profiler.export_chrome_trace(path)
+        with open(path) as f:
+            trace = json.load(f)
+    events = trace["traceEvents"]
+    log_test(
+        "profiler.export_chrome_trace",
+        r"$\{\mathrm{name}, \mathrm{ph}=X, \mathrm{ts}, \mathrm{dur}\}$",
+        {"max_trace_events": 50},
+        {"events": len(events), "first": events[0] if events else None},
+        "Chrome / Perfetto complete events, capped at max_trace_events"
+    )
+    assert count == len(events) == 50
+    assert all(e["ph"] == "X" and e["dur"] >= 0.0 for e in events)
+    assert {e["name"] for e in events} >= {"relax.centroid", "relax.forces", "relax.integrate"}
+    profiler.reset()
+
+
+if __name__ == "__main__":
+    print("\n" + "="*80)
+    print("PROFILER COMPREHENSIVE TEST SUITE")
+    print("="*80)
+    test_disabled_by_default()
+    test_helicity_and_relax_stages()
+    test_chrome_trace_export()
+    print("\n" + "="*80)
+    print("ALL TESTS COMPLETED")
+    print("="*80)
@@ -0,0 +1,78 @@
+// tests/test_thread_pool.cpp
+#include "../src/thread_pool.h"
+#include "../src/job_system.h"
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+namespace {
+
+// Distinct threads that ran a chunk of a parallel_for over n slow chunks.
+std::size_t threads_used(std::size_t n = 64) {
+    std::mutex m;
+    std::set<std::thread::id> ids;
+    sst::parallel_for(0, n, 1, [&](std::size_t, std::size_t) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        std::lock_guard<std::mutex> lk(m);
+        ids.insert(std::this_thread::get_id());
+    });
+    return ids.size();
+}
+
+int failures = 0;
+
+void check(const char* what, std::size_t got, bool ok, const std::string& want) {
+    std::cout << "    " << what << ": " << got << " thread(s) (expected " << want << ")\n";
+    if (!ok) ++failures;
+}
+
+void check(const char* what, std::size_t got, std::size_t want) {
+    check(what, got, got == want, std::to_string(want));
+}
+
+} // namespace
+
+int main() {
+    using namespace sst;
+
+    const std::size_t N = 4;
+    set_num_threads(N);
+    std::cout << "[*] Thread pool: set_num_threads(" << N << ")\n";
+    check("main thread", threads_used(), N);
+
+    // Job workers belong to the JobQueue's own pool, so their kernels still
+    // fan out across shared_pool().
+    {
+        JobQueue queue(1);
+        std::size_t in_job = 0;
+        queue.submit("probe", [&](Job&) { in_job = threads_used(); })->wait();
+        check("JobQueue job", in_job, N);
+    }
+
+    // A kernel inside a shared_pool() task is nested: inline by default,
+    // split across the pool with NestedPolicy::Shared.
+    for (NestedPolicy policy : {NestedPolicy::Serial, NestedPolicy::Shared}) {
+        set_nested_policy(policy);
+        std::size_t nested = 0;
+        shared_pool().submit([&]() { nested = threads_used(); });
+        shared_pool().wait_idle();
+        if (policy == NestedPolicy::Serial) {
+            check("nested (serial)", nested, 1);
+        } else {
+            // The other workers join in as they pick up the helper tasks.
+            check("nested (shared) fans out", nested, nested > 1, "> 1");
+        }
+    }
+    set_nested_policy(NestedPolicy::Serial);
+    set_num_threads(0);
+
+    if (failures) {
+        std::cout << "[-] " << failures << " check(s) failed.\n";
+        return 1;
+    }
+    std::cout << "[+] Done.\n";
+    return 0;
+}
@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+"""
+Comprehensive test suite for the shared thread pool controls
+(set_num_threads, set_thread_pinning, set_nested_parallelism).
+Tests all functions with LaTeX formulas, inputs, and results logged.
+"""
+
+import sys
+import os
+import multiprocessing
+import numpy as np
+
+# Add build directory to path
+build_dir = os.path.join(os.path.dirname(__file__), "../build/Debug")
+if os.path.exists(build_dir):
+    sys.path.insert(0, build_dir)
+
+try:
+    import swirl_string_core
+    HAS_SST = True
+except ImportError:
+    try:
+        import sstbindings as swirl_string_core
+        HAS_SST = True
+    except ImportError:
+        print("ERROR: Could not import swirl_string_core or sstbindings")
+        sys.exit(1)
+
+
+def log_test(func_name, latex_formula, inputs_dict, results, description=""):
+    """Log test information in structured format."""
+    print("\n" + "="*80)
+    print(f"Testing: {func_name}")
+    if description:
+        print(f"Description: {description}")
+    print("-"*80)
+    print("LaTeX Formula:")
+    print(f"  {latex_formula}")
+    print("-"*80)
+    print("Inputs:")
+    for key, value in inputs_dict.items():
+        print(f"  {key} = {value}")
+    print("-"*80)
+    print("Results:")
+    if isinstance(results, dict):
+        for key, value in results.items():
+            print(f"  {key}: {value}")
+    else:
+        print(f"  {results}")
+    print("="*80)
+
+
+def _ring(n=600, r=1e-14):
+    s = 2.0 * np.pi * np.arange(n) / n
+    return np.column_stack([r * np.cos(s), r * np.sin(s), 0.1 * r * np.sin(3 * s)]).tolist()
+
+
+def _rings():
+    s = 2.0 * np.pi * np.arange(60) / 60
+    return [np.column_stack([np.cos(s), np.sin(s), np.zeros(60)]),
+            np.column_stack([1.2 + np.cos(s), np.zeros(60), np.sin(s)])]
+
+
+def _worker_threads(_):
+    return swirl_string_core.get_num_threads()
+
+
+def test_set_get_num_threads():
+    """set_num_threads(n) is reported back; 0 restores the default."""
+    default = swirl_string_core.get_num_threads()
+    seen = {}
+    try:
+        for n in (1, 2, 3):
+            swirl_string_core.set_num_threads(n)
+            seen[n] = swirl_string_core.get_num_threads()
+        swirl_string_core.set_num_threads(0)
+        restored = swirl_string_core.get_num_threads()
+    finally:
+        swirl_string_core.set_num_threads(0)
+    log_test(
+        "set_num_threads / get_num_threads",
+        r"$N_{threads} = n \;(n > 0), \quad N_{threads}(0) = N_{default}$",
+        {"requested": [1, 2, 3]},
+        {"reported": seen, "default": default, "restored": restored},
+        "Pool size follows the setter; 0 falls back to env / CPU count"
+    )
+    assert seen == {1: 1, 2: 2, 3: 3}
+    assert default >= 1 and restored == default
+
+
+def test_results_independent_of_thread_count():
+    """Kernels give bitwise-identical results for any thread count."""
+    points = _ring()
+    masses, relaxed = {}, {}
+    try:
+        for n in (1, 2, 4):
+            swirl_string_core.set_num_threads(n)
+            masses[n] = swirl_string_core.compute_sst_mass(points, 2.0)
+            evaluator = swirl_string_core.ParticleEvaluator(_rings())
+            evaluator.relax(iterations=10, timestep=0.005)
+            relaxed[n] = np.asarray(evaluator.get_filaments()[1])
+    finally:
+        swirl_string_core.set_num_threads(0)
+    log_test(
+        "compute_sst_mass / ParticleEvaluator.relax across thread counts",
+        r"$M(N_{threads}=1) = M(N_{threads}=2) = M(N_{threads}=4)$",
+        {"points": len(points), "threads": [1, 2, 4]},
+        {"masses": masses},
+        "Per-row partial sums are reduced in a fixed order"
+    )
+    assert masses[1] == masses[2] == masses[4]
+    assert np.array_equal(relaxed[1], relaxed[2]) and np.array_equal(relaxed[1], relaxed[4])
+
+
+def test_thread_pinning():
+    """Pinning can be toggled and does not change results."""
+    points = _ring()
+    before = swirl_string_core.compute_sst_mass(points, 2.0)
+    try:
+        swirl_string_core.set_thread_pinning(True)
+        pinned = swirl_string_core.get_thread_pinning()
+        after = swirl_string_core.compute_sst_mass(points, 2.0)
+    finally:
+        swirl_string_core.set_thread_pinning(False)
+    log_test(
+        "set_thread_pinning",
+        r"$\mathrm{worker}_i \mapsto \mathrm{cpu}_{i \bmod |\mathrm{mask}|}$",
+        {"on": True},
+        {"pinned": pinned, "same_result": before == after},
+        "Workers bound to CPUs of the affinity mask"
+    )
+    assert pinned and not swirl_string_core.get_thread_pinning()
+    assert before == after
+
+
+def test_nested_parallelism_policy():
+    """The policy round-trips and rejects unknown names."""
+    assert swirl_string_core.get_nested_parallelism() == "serial"
+    swirl_string_core.set_nested_parallelism("shared")
+    shared = swirl_string_core.get_nested_parallelism()
+    swirl_string_core.set_nested_parallelism("serial")
+    try:
+        swirl_string_core.set_nested_parallelism("dynamic")
+        raised = False
+    except ValueError:
+        raised = True
+    log_test(
+        "set_nested_parallelism",
+        r"$\mathrm{policy} \in \{\mathrm{serial}, \mathrm{shared}\}$",
+        {"policies": ["shared", "serial", "dynamic"]},
+        {"shared": shared, "rejected_unknown": raised},
+        "Nested kernels run inline (serial) or split across the pool (shared)"
+    )
+    assert shared == "shared" and raised
+    assert swirl_string_core.get_nested_parallelism() == "serial"
+
+
+def test_multiprocessing_workers_default_to_one_thread():
+    """Worker processes start with one thread unless the environment says otherwise."""
+    if "SST_NUM_THREADS" in os.environ or "OMP_NUM_THREADS" in os.environ:
+        print("SKIP: SST_NUM_THREADS / OMP_NUM_THREADS set")
+        return
+    results = {}
+    for method in ("fork", "spawn"):
+        if method not in multiprocessing.get_all_start_methods():
+            continue
+        with multiprocessing.get_context(method).Pool(2) as pool:
+            results[method] = pool.map(_worker_threads, range(2))
+    log_test(
+        "get_num_threads in multiprocessing workers",
+        r"$N_{threads}(\mathrm{worker}) = 1$",
+        {"start_methods": list(results)},
+        results,
+        "A process pool of P workers uses P threads, not P * N_cpu"
+    )
+    assert results
+    assert all(n == 1 for counts in results.values() for n in counts)
+
+
+if __name__ == "__main__":
+    print("\n" + "="*80)
+    print("THREAD POOL COMPREHENSIVE TEST SUITE")
+    print("="*80)
+    test_set_get_num_threads()
+    test_results_independent_of_thread_count()
+    test_thread_pinning()
+    test_nested_parallelism_policy()
+    test_multiprocessing_workers_default_to_one_thread()
+    print("\n" + "="*80)
+    print("ALL TESTS COMPLETED")
+    print("="*80)
@@ -0,0 +1,174 @@
+// test_wasm.js - Headless Node.js test and benchmark for the WASM build
+//
+// Usage: node tests/test_wasm.js [path/to/swirl_string_core_wasm.js] [--bench]
+// Build first with: npm run build:wasm (writes dist/swirl_string_core_wasm.js)
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+
+const args = process.argv.slice(2);
+const bench = args.includes('--bench');
+const modulePath = path.resolve(args.find(a => !a.startsWith('--')) ||
+    path.join(__dirname, '..', 'dist', 'swirl_string_core_wasm.js'));
+
+if (!fs.existsSync(modulePath)) {
+    console.log('WASM module not found at', modulePath);
+    console.log('This is expected if the WASM module has not been built. Run: npm run build:wasm');
+    process.exit(0);
+}
+
+let native = null;
+try {
+    native = require('../build/Release/swirl_string_core.node');
+} catch (err) {
+    // Optional: only used for cross-checks and the speed comparison.
+}
+
+const ring = (n, radius = 1.0) => {
+    const out = new Float64Array(3 * n);
+    for (let i = 0; i < n; i++) {
+        const t = 2 * Math.PI * i / n;
+        out.set([radius * Math.cos(t), radius * Math.sin(t), 0], 3 * i);
+    }
+    return out;
+};
+const cube = (n, spacing) => {
+    const out = new Float64Array(3 * n * n * n);
+    let k = 0;
+    for (let i = 0; i < n; i++) for (let j = 0; j < n; j++) for (let l = 0; l < n; l++) {
+        out[k++] = spacing * (i - n / 2);
+        out[k++] = spacing * (j - n / 2);
+        out[k++] = spacing * (l - n / 2) + 0.05;
+    }
+    return out;
+};
+const maxDiff = (a, b) => a.reduce((m, x, i) => Math.max(m, Math.abs(x - b[i])), 0);
+const check = (cond, message) => {
+    if (!cond) throw new Error(message);
+    console.log('✓', message);
+};
+const timeIt = (fn, repeats) => {
+    const samples = [];
+    for (let r = 0; r < repeats; r++) {
+        const t0 = process.hrtime.bigint();
+        fn();
+        samples.push(Number(process.hrtime.bigint() - t0) / 1e6);
+    }
+    samples.sort((x, y) => x - y);
+    return samples[samples.length >> 1];
+};
+
+// x = sin t + 2 sin 2t, y = cos t - 2 cos 2t, z = -sin 3t (rows are harmonics 0..3)
+const TREFOIL_COEFFS = new Float64Array([
+    0, 0, 0, 0, 0, 0,
+    0, 1, 1, 0, 0, 0,
+    0, 2, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, -1,
+]);
+const TREFOIL_FSERIES = '% trefoil\n' +
+    Array.from({ length: 4 }, (_, n) => Array.from(TREFOIL_COEFFS.subarray(6 * n, 6 * n + 6)).join(' ')).join('\n') + '\n';
+
+async function testModule(sst) {
+    console.log('WASM module loaded:', modulePath);
+    console.log('Threads:', sst.hasThreads ? sst.numThreads() : 'none (single-threaded build)');
+
+    // Biot-Savart grid kernel: every input form gives the same answer.
+    const curve = ring(64);
+    const grid = cube(8, 0.3);
+    const nested = [];
+    for (let i = 0; i < grid.length; i += 3) nested.push([grid[i], grid[i + 1], grid[i + 2]]);
+    const velocity = sst.computeVelocity(curve, grid);
+    check(velocity instanceof Float64Array && velocity.length === grid.length,
+        'computeVelocity returns a Float64Array of grid.length');
+    check(maxDiff(sst.computeVelocity(curve, nested), velocity) === 0, 'nested [x, y, z] input matches Float64Array input');
+
+    const curveBuf = new sst.Vec3Buffer(64);
+    const gridBuf = new sst.Vec3Buffer(grid.length / 3);
+    const outBuf = new sst.Vec3Buffer(0);
+    curveBuf.view().set(curve);
+    gridBuf.view().set(grid);
+    sst.computeVelocityInto(curveBuf, gridBuf, outBuf);
+    check(maxDiff(outBuf.view(), velocity) === 0, 'Vec3Buffer in/out path matches the copying path');
+    curveBuf.delete();
+    gridBuf.delete();
+    outBuf.delete();
+
+    const center = sst.computeVelocity(curve, new Float64Array([0, 0, 0]));
+    check(Math.abs(center[0]) < 1e-12 && Math.abs(center[1]) < 1e-12 && center[2] > 0.4,
+        'ring induces an axial velocity at its centre');
+    if (native) {
+        const ref = native.computeVelocity(curve, grid);
+        const scale = ref.reduce((m, x) => Math.max(m, Math.abs(x)), 0);
+        check(maxDiff(ref, velocity) <= 1e-9 * scale, 'computeVelocity agrees with the native addon');
+    }
+
+    // Fourier evaluation and writhe.
+    const t = Float64Array.from({ length: 300 }, (_, i) => 2 * Math.PI * i / 300);
+    const circle = sst.evaluateFourierSeries(new Float64Array([0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0]), t);
+    check(Math.abs(circle.positions[3 * 75] - Math.cos(t[75])) < 1e-12 &&
+          Math.abs(circle.tangents[3 * 75 + 1] - Math.cos(t[75])) < 1e-12,
+        'evaluateFourierSeries reproduces the unit circle and its tangent');
+    check(Math.abs(sst.computeWrithe(ring(200))) < 1e-9, 'planar ring has zero writhe');
+    const trefoil = sst.evaluateFourierSeries(TREFOIL_COEFFS, t);
+    const wr = sst.writheGaussCurve(trefoil.positions, trefoil.tangents);
+    check(Math.abs(wr) > 3.0 && Math.abs(wr) < 3.7, `trefoil Gauss writhe ${wr.toFixed(3)} has |Wr| ~ 3.4`);
+
+    // Helicity pipeline from .fseries text.
+    const pts = sst.evaluateFseries(TREFOIL_FSERIES, 200);
+    check(pts.length === 600, 'evaluateFseries samples the largest block');
+    const inv = sst.helicityFromFseries(TREFOIL_FSERIES, 16, 0.4, 4, 200);
+    check([inv.hCharge, inv.hMass, inv.aMu].every(Number.isFinite), 'helicityFromFseries returns finite invariants');
+
+    const frames = sst.computeBishopFrames(ring(128));
+    check(Math.abs(frames.length - 2 * Math.PI) < 1e-3, 'computeBishopFrames measures the ring length');
+
+    let error = null;
+    try {
+        sst.computeVelocity('not an array', grid);
+    } catch (err) {
+        error = err;
+    }
+    check(error instanceof TypeError && /curve/.test(error.message), 'bad input raises a TypeError naming the argument');
+}
+
+function runBenchmark(sst) {
+    const curve = ring(256);
+    const grid = cube(32, 0.1);
+    const pairs = (curve.length / 3) * (grid.length / 3);
+    const report = (label, ms) =>
+        console.log(`  ${label.padEnd(28)} ${ms.toFixed(1).padStart(8)} ms  ${(pairs / ms / 1e3).toFixed(1).padStart(7)} Mpair/s`);
+
+    console.log(`\nBenchmark: computeVelocity, ${curve.length / 3} segments x ${grid.length / 3} grid points`);
+    report('wasm (Float64Array in)', timeIt(() => sst.computeVelocity(curve, grid), 5));
+    const curveBuf = new sst.Vec3Buffer(curve.length / 3);
+    const gridBuf = new sst.Vec3Buffer(grid.length / 3);
+    const outBuf = new sst.Vec3Buffer(0);
+    curveBuf.view().set(curve);
+    gridBuf.view().set(grid);
+    report('wasm (Vec3Buffer in/out)', timeIt(() => sst.computeVelocityInto(curveBuf, gridBuf, outBuf), 5));
+    curveBuf.delete();
+    gridBuf.delete();
+    outBuf.delete();
+    if (native) {
+        report('native addon', timeIt(() => native.computeVelocity(curve, grid), 5));
+    }
+
+    const t = Float64Array.from({ length: 1000 }, (_, i) => 2 * Math.PI * i / 1000);
+    const trefoil = sst.evaluateFourierSeries(TREFOIL_COEFFS, t);
+    console.log(`  ${'writheGaussCurve (1000 pts)'.padEnd(28)} ${timeIt(() => sst.writheGaussCurve(trefoil.positions, trefoil.tangents), 3).toFixed(1).padStart(8)} ms`);
+    console.log(`  ${'helicityFromFseries (32^3)'.padEnd(28)} ${timeIt(() => sst.helicityFromFseries(TREFOIL_FSERIES), 1).toFixed(1).padStart(8)} ms`);
+}
+
+const factory = require(modulePath);
+factory().then(async (sst) => {
+    await testModule(sst);
+    if (bench) runBenchmark(sst);
+    console.log('\nWASM test completed!');
+    // Idle pthread workers keep the event loop alive.
+    process.exit(0);
+}).catch((err) => {
+    console.error('✗ WASM test failed:', err.message);
+    process.exit(1);
+});